@@ -9,7 +9,7 @@ Description:   Example of automatic CPU dispatching.
                optimized for a different instruction set. The optimal version is
                selected by a dispatcher at run time.
 
-There are two examples of automatic dispatching:
+There are three examples of automatic dispatching:
 
 dispatch_example1.cpp: Uses separate function names for each version.
                        This is useful for simple cases with one or a few functions.
@@ -18,6 +18,9 @@ dispatch_example2.cpp: Uses separate namespaces for each version.
                        This is the recommended method for cases with multiple functions,
                        classes, objects, etc.
 
+dispatch_example3.cpp: Uses separate namespaces for each version, with the dispatcher
+                       generated by the macros in vcl_dispatch.h.
+
 The code has two sections: 
 
 Dispatched code: This code is compiled multiple times to generate multiple instances
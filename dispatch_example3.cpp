@@ -0,0 +1,117 @@
+/*************************  dispatch_example3.cpp   ***************************
+Author:        VCL contributors
+Date created:  2026-10-14
+Last modified: 2026-10-14
+Version:       2.03.00
+Project:       vector class library
+Description:   Example of automatic CPU dispatching using vcl_dispatch.h.
+               This shows how to compile vector code in multiple versions, each
+               optimized for a different instruction set. The optimal version is
+               selected by a dispatcher at run time.
+
+This example does the same as dispatch_example2.cpp, but the function prototypes,
+namespace names, function pointer, and dispatcher are generated by the macros
+VCL_DISPATCH_DECLARE and VCL_DISPATCH_DEFINE in vcl_dispatch.h.
+
+The code has two sections: 
+
+Dispatched code: This code is compiled multiple times to generate multiple instances
+of the compiled code, each one optimized for a different instruction set. The
+dispatched code section contains the speed-critical part of the program.
+
+Common code: This code is compiled only once, using the lowest instruction set.
+The common code section contains the dispatcher, startup code, user interface, and 
+other parts of the program that do not need advanced optimization.
+
+To compile this code, do as in this example:
+
+# Example of compiling dispatch example with Gnu or Clang compiler:
+# Compile dispatch_example3.cpp four times for different instruction sets:
+
+# Compile for AVX
+clang++ -O2 -m64 -mavx -std=c++17 -c dispatch_example3.cpp -od7.o
+
+# Compile for AVX2
+clang++ -O2 -m64 -mavx2 -mfma -std=c++17 -c dispatch_example3.cpp -od8.o
+
+# Compile for AVX512
+clang++ -O2 -m64 -mavx512f -mfma -mavx512vl -mavx512bw -mavx512dq -std=c++17 -c dispatch_example3.cpp -od10.o
+
+# The last compilation uses the lowest supported instruction set (SSE2)
+# This includes the main program, and links all versions together:
+clang++ -O2 -m64 -msse2 -std=c++17 dispatch_example3.cpp instrset_detect.cpp d7.o d8.o d10.o -otest.exe
+
+# Run the program
+./test.exe
+
+(c) Copyright 2026 VCL contributors.
+Apache License version 2.0 or later.
+******************************************************************************/
+
+#include <stdio.h>
+#include "vectorclass.h"
+#include "vcl_dispatch.h"
+
+// Declare the entry function in all versions.
+// The function type should not contain vector types:
+VCL_DISPATCH_DECLARE(myfunc, float(float const []))
+
+
+/******************************************************************************
+                             Dispatched code
+
+Everything in this section is compiled multiple times, with one version for
+each instruction set. Speed-critical vector code belongs here.
+******************************************************************************/
+
+// Enclose all multiversion code in the namespace chosen by vcl_dispatch.h
+namespace VCL_DISPATCH_NAMESPACE {
+
+    // This section may contain vectors, functions, classes, objects, etc.
+
+    // -----------------------------------------------------------------------------
+    //                       Entry function
+    // -----------------------------------------------------------------------------
+    // This is the entry function that is accessed through the dispatcher.
+    // The entry function must use arrays rather than vectors for input and output.
+    float myfunc(float const f[]) {
+        Vec16f a;                              // Vector of 16 floats
+        a.load(f);                             // Load array into vector
+        return horizontal_add(a);              // Return sum of 16 elements
+    }
+}
+
+/**********************************************************************************
+                             Common code
+
+Everything in this section is compiled only once, using the lowest instruction set. 
+
+The dispatcher must be placed here. Program main(), user interface, and other
+less critical parts of the code are also placed in the common code section.
+**********************************************************************************/
+
+#if INSTRSET == 2
+// The common code is only included in the lowest of the compiled versions
+
+// Define the dispatcher. The last parameter tells which versions are compiled.
+// The first call to myfunc goes through the dispatcher. All subsequent calls
+// go directly to the optimal version of the entry function
+VCL_DISPATCH_DEFINE(myfunc, float(float const []), dispatch_sse2 | dispatch_avx | dispatch_avx2 | dispatch_avx512)
+
+
+// ---------------------------------------------------------------------------------
+//                       Program main
+// ---------------------------------------------------------------------------------
+int main() {
+
+    // Array of 16 floats
+    float const a[16] = {1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16};
+
+    float sum = myfunc(a);                       // call function with dispatching
+
+    printf("\nsum = %8.2f \n", sum);             // print result (= 136.00)
+
+    return 0;
+}
+
+#endif  // INSTRSET == 2
@@ -1,8 +1,8 @@
 /****************************  instrset.h   **********************************
 * Author:        Agner Fog
 * Date created:  2012-05-30
-* Last modified: 2023-12-02
-* Version:       2.02.02
+* Last modified: 2026-10-14
+* Version:       2.03.00
 * Project:       vector class library
 * Description:
 * Header file for various compiler-specific tasks as well as common
@@ -113,6 +113,7 @@
 #include <stdint.h>                    // Define integer types with known size
 #include <limits.h>                    // Define INT_MAX
 #include <stdlib.h>                    // define abs(int)
+#include <stddef.h>                    // define size_t
 
 
 // functions in instrset_detect.cpp:
@@ -128,10 +129,26 @@ namespace VCL_NAMESPACE {
     bool hasAVX512VBMI2(void);         // true if AVX512VBMI2 instructions supported
     bool hasF16C(void);                // true if F16C instructions supported
     bool hasAVX512FP16(void);          // true if AVX512_FP16 instructions supported
+    bool hasAVX512BF16(void);          // true if AVX512_BF16 instructions supported
+    bool hasAVX512VNNI(void);          // true if AVX512_VNNI instructions supported
+    bool hasAVXVNNI(void);             // true if AVX-VNNI instructions supported
 
     // function in physical_processors.cpp:
     int physicalProcessors(int * logical_processors = 0);
 
+    // Structure containing all CPU features detected by cpu_features_detect().
+    // The features are detected only once. The result is saved in cpu_features_data.
+    // Use the inline functions cpu_features() and cpu_has() to read it.
+    struct CpuFeatures {
+        int      instrset;             // instruction set level as returned by instrset_detect(), -1 if not detected yet
+        int      avx10_version;        // AVX10 version number, 0 if AVX10 not supported
+        int      avx10_vector_bits;    // maximum vector size supported by AVX10: 128, 256 or 512 bits
+        int      reserved;
+        uint64_t bits;                 // feature bits, see cpu_feature_... constants
+    };
+    extern CpuFeatures cpu_features_data;        // detected CPU features, defined in instrset_detect.cpp
+    CpuFeatures const & cpu_features_detect(void); // detect all CPU features once and save them in cpu_features_data
+
 #ifdef VCL_NAMESPACE
 }
 #endif
@@ -241,6 +258,74 @@ static inline void cpuid(int output[4], int functionnumber, int ecxleaf = 0) {
 }
 
 
+// Feature bits in CpuFeatures::bits.
+// A bit is set only if the feature is supported by both the CPU and the operating system
+constexpr uint64_t cpu_feature_sse3            = uint64_t(1) <<  0;
+constexpr uint64_t cpu_feature_ssse3           = uint64_t(1) <<  1;
+constexpr uint64_t cpu_feature_sse41           = uint64_t(1) <<  2;
+constexpr uint64_t cpu_feature_sse42           = uint64_t(1) <<  3;
+constexpr uint64_t cpu_feature_popcnt          = uint64_t(1) <<  4;
+constexpr uint64_t cpu_feature_pclmulqdq       = uint64_t(1) <<  5;
+constexpr uint64_t cpu_feature_aes             = uint64_t(1) <<  6;
+constexpr uint64_t cpu_feature_avx             = uint64_t(1) <<  7;
+constexpr uint64_t cpu_feature_f16c            = uint64_t(1) <<  8;
+constexpr uint64_t cpu_feature_fma3            = uint64_t(1) <<  9;
+constexpr uint64_t cpu_feature_fma4            = uint64_t(1) << 10;
+constexpr uint64_t cpu_feature_xop             = uint64_t(1) << 11;
+constexpr uint64_t cpu_feature_avx2            = uint64_t(1) << 12;
+constexpr uint64_t cpu_feature_bmi1            = uint64_t(1) << 13;
+constexpr uint64_t cpu_feature_bmi2            = uint64_t(1) << 14;
+constexpr uint64_t cpu_feature_lzcnt           = uint64_t(1) << 15;
+constexpr uint64_t cpu_feature_gfni            = uint64_t(1) << 16;
+constexpr uint64_t cpu_feature_vaes            = uint64_t(1) << 17;
+constexpr uint64_t cpu_feature_vpclmulqdq      = uint64_t(1) << 18;
+constexpr uint64_t cpu_feature_avxvnni         = uint64_t(1) << 19;  // AVX-VNNI (VEX-coded)
+constexpr uint64_t cpu_feature_avxifma         = uint64_t(1) << 20;  // AVX-IFMA (VEX-coded)
+constexpr uint64_t cpu_feature_avxvnniint8     = uint64_t(1) << 21;  // AVX-VNNI-INT8
+constexpr uint64_t cpu_feature_avxneconvert    = uint64_t(1) << 22;  // AVX-NE-CONVERT
+constexpr uint64_t cpu_feature_avx512f         = uint64_t(1) << 23;
+constexpr uint64_t cpu_feature_avx512cd        = uint64_t(1) << 24;
+constexpr uint64_t cpu_feature_avx512er        = uint64_t(1) << 25;
+constexpr uint64_t cpu_feature_avx512pf        = uint64_t(1) << 26;
+constexpr uint64_t cpu_feature_avx512vl        = uint64_t(1) << 27;
+constexpr uint64_t cpu_feature_avx512bw        = uint64_t(1) << 28;
+constexpr uint64_t cpu_feature_avx512dq        = uint64_t(1) << 29;
+constexpr uint64_t cpu_feature_avx512ifma      = uint64_t(1) << 30;
+constexpr uint64_t cpu_feature_avx512vbmi      = uint64_t(1) << 31;
+constexpr uint64_t cpu_feature_avx512vbmi2     = uint64_t(1) << 32;
+constexpr uint64_t cpu_feature_avx512vnni      = uint64_t(1) << 33;
+constexpr uint64_t cpu_feature_avx512bitalg    = uint64_t(1) << 34;
+constexpr uint64_t cpu_feature_avx512vpopcntdq = uint64_t(1) << 35;
+constexpr uint64_t cpu_feature_avx512bf16      = uint64_t(1) << 36;
+constexpr uint64_t cpu_feature_avx512fp16      = uint64_t(1) << 37;
+constexpr uint64_t cpu_feature_avx512vp2intersect = uint64_t(1) << 38;
+constexpr uint64_t cpu_feature_amxtile         = uint64_t(1) << 39;
+constexpr uint64_t cpu_feature_amxint8         = uint64_t(1) << 40;
+constexpr uint64_t cpu_feature_amxbf16         = uint64_t(1) << 41;
+constexpr uint64_t cpu_feature_amxfp16         = uint64_t(1) << 42;
+constexpr uint64_t cpu_feature_avx10           = uint64_t(1) << 43;  // see also avx10_version and avx10_vector_bits
+constexpr uint64_t cpu_feature_sha             = uint64_t(1) << 44;
+constexpr uint64_t cpu_feature_movbe           = uint64_t(1) << 45;
+constexpr uint64_t cpu_feature_rdrand          = uint64_t(1) << 46;
+constexpr uint64_t cpu_feature_rdseed          = uint64_t(1) << 47;
+constexpr uint64_t cpu_feature_adx             = uint64_t(1) << 48;
+
+// Get the CPU features. The features are detected at the first call only.
+// Subsequent calls just read the saved values
+static inline CpuFeatures const & cpu_features() {
+    if (cpu_features_data.instrset < 0) {
+        return cpu_features_detect();            // not detected yet
+    }
+    return cpu_features_data;
+}
+
+// Check if all the features indicated in mask are supported,
+// e.g. cpu_has(cpu_feature_avx512vbmi | cpu_feature_avx512vbmi2)
+static inline bool cpu_has(uint64_t mask) {
+    return (cpu_features().bits & mask) == mask;
+}
+
+
 // Define popcount function. Gives sum of bits
 #if INSTRSET >= 6   // SSE4.2
 // The popcnt instruction is not officially part of the SSE4.2 instruction set,
@@ -376,6 +461,96 @@ constexpr int bit_scan_reverse_const(uint64_t const n) {
     return int(b);
 }
 
+// Load 16 bytes from aligned memory with a non-temporal hint. Used by the load_nt member functions.
+// The non-temporal load (movntdqa) is useful mainly for reading write-combining memory, such as
+// memory-mapped device memory. Most processors treat it as an aligned load on normal memory.
+// Will generate runtime error if p is not aligned by 16
+static inline __m128i load_nt_128(void const * p) {
+#if INSTRSET >= 5   // SSE4.1
+    return _mm_stream_load_si128((__m128i *)p);
+#else
+    return _mm_load_si128((__m128i const *)p);
+#endif
+}
+
+#if INSTRSET >= 7   // AVX
+// Load 32 bytes from aligned memory with a non-temporal hint
+static inline __m256i load_nt_256(void const * p) {
+#if INSTRSET >= 8   // AVX2
+    return _mm256_stream_load_si256((__m256i const *)p);
+#else
+    __m128i lo = load_nt_128(p);
+    __m128i hi = load_nt_128((__m128i const *)p + 1);
+    return _mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1);
+#endif
+}
+#endif
+
+#if INSTRSET >= 9   // AVX512F
+// Load 64 bytes from aligned memory with a non-temporal hint
+static inline __m512i load_nt_512(void const * p) {
+    return _mm512_stream_load_si512((void *)p);
+}
+#endif
+
+// Prefetch the cache line containing the address p + distance bytes.
+// locality = 3: prefetch into all cache levels (prefetcht0)
+// locality = 2: prefetch into level 2 cache and higher (prefetcht1)
+// locality = 1: prefetch into level 3 cache and higher (prefetcht2)
+// locality = 0: prefetch with minimum cache pollution for data that are used only once (prefetchnta)
+// A prefetch is rarely useful for sequential access because the hardware prefetcher
+// does this automatically. It may help with irregular access patterns where the
+// address is known a few hundred clock cycles in advance.
+// Example: prefetch<1024>(p + i)
+template <int distance = 0, int locality = 3>
+static inline void prefetch(void const * p) {
+    static_assert(locality >= 0 && locality <= 3, "locality must be 0 - 3");
+    // integer arithmetic because p + distance may point beyond the end of an array,
+    // which is allowed here since a prefetch never causes a memory fault
+    char const * a = (char const *)((size_t)p + distance);
+    if constexpr (locality == 3) {
+        _mm_prefetch(a, _MM_HINT_T0);
+    }
+    else if constexpr (locality == 2) {
+        _mm_prefetch(a, _MM_HINT_T1);
+    }
+    else if constexpr (locality == 1) {
+        _mm_prefetch(a, _MM_HINT_T2);
+    }
+    else {
+        _mm_prefetch(a, _MM_HINT_NTA);
+    }
+}
+
+// Size in bytes of the biggest data cache, which is normally the last level cache.
+// This is read from cpuid leaf 4 on Intel processors and leaf 0x8000001D on AMD
+// processors. Returns 0 if unknown
+static inline size_t last_level_cache_size() {
+    int abcd[4];
+    cpuid(abcd, 0);
+    int const intel_leaf = abcd[0] >= 4 ? 4 : 0;                                  // 0 if not supported
+    cpuid(abcd, 0x80000000);
+    int const amd_leaf = uint32_t(abcd[0]) >= 0x8000001Du ? int(0x8000001Du) : 0; // 0 if not supported
+    int const leafs[2] = {intel_leaf, amd_leaf};
+    size_t size = 0;
+    for (int l = 0; l < 2 && size == 0; l++) {
+        if (leafs[l] == 0) continue;
+        for (int i = 0; i < 16; i++) {
+            cpuid(abcd, leafs[l], i);
+            int type = abcd[0] & 0x1F;           // 0 = no more caches, 2 = instruction cache
+            if (type == 0) break;
+            if (type == 2) continue;
+            size_t ways       = (uint32_t(abcd[1]) >> 22) + 1;
+            size_t partitions = (uint32_t(abcd[1]) >> 12 & 0x3FF) + 1;
+            size_t linesize   = (uint32_t(abcd[1]) & 0xFFF) + 1;
+            size_t sets       = uint32_t(abcd[2]) + size_t(1);
+            size_t s = ways * partitions * linesize * sets;
+            if (s > size) size = s;
+        }
+    }
+    return size;
+}
+
 
 /*****************************************************************************
 *
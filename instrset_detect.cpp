@@ -1,8 +1,8 @@
 /**************************  instrset_detect.cpp   ****************************
 * Author:        Agner Fog
 * Date created:  2012-05-30
-* Last modified: 2022-07-20
-* Version:       2.02.00
+* Last modified: 2026-10-14
+* Version:       2.03.00
 * Project:       vector class library
 * Description:
 * Functions for checking which instruction sets are supported.
@@ -46,6 +46,9 @@ static inline uint64_t xgetbv (int ctr) {
 #endif
 }
 
+// Detected CPU features. instrset = -1 means not detected yet
+CpuFeatures cpu_features_data = {-1, 0, 0, 0, 0};
+
 /* find supported instruction set
     return value:
     0           = 80386 instruction set
@@ -60,13 +63,8 @@ static inline uint64_t xgetbv (int ctr) {
     9  or above = AVX512F
    10  or above = AVX512VL, AVX512BW, AVX512DQ
 */
-int instrset_detect(void) {
-
-    static int iset = -1;                                  // remember value for next call
-    if (iset >= 0) {
-        return iset;                                       // called before
-    }
-    iset = 0;                                              // default value
+static int instrset_level(void) {
+    int iset = 0;                                          // default value
     int abcd[4] = {0,0,0,0};                               // cpuid results
     cpuid(abcd, 0);                                        // call cpuid function 0
     if (abcd[0] == 0) return iset;                         // no further cpuid function supported
@@ -106,68 +104,176 @@ int instrset_detect(void) {
     return iset;
 }
 
+// Translate bit number bit in cpuid register reg to feature bit f
+static inline uint64_t cpuid_bit(int reg, int bit, uint64_t f) {
+    return (reg >> bit & 1) ? f : 0;
+}
+
+// Detect all CPU features. This is done only once.
+// The result is saved in cpu_features_data so that cpu_features() and cpu_has()
+// can read it without calling cpuid again
+CpuFeatures const & cpu_features_detect(void) {
+    if (cpu_features_data.instrset >= 0) {
+        return cpu_features_data;                          // called before
+    }
+    CpuFeatures f = {0, 0, 0, 0, 0};
+    f.instrset = instrset_level();
+    if (f.instrset < 2) {                                  // less than SSE2. No further features detected
+        cpu_features_data = f;
+        return cpu_features_data;
+    }
+    int abcd[4] = {0,0,0,0};                               // cpuid results
+    int r7[4]   = {0,0,0,0};                               // cpuid leaf 7 results
+    int r71[4]  = {0,0,0,0};                               // cpuid leaf 7 subleaf 1 results
+    int rx[4]   = {0,0,0,0};                               // cpuid leaf 0x80000001 results
+    uint64_t b = 0;                                        // feature bits
+    cpuid(abcd, 0);
+    int maxleaf = abcd[0];                                 // highest cpuid leaf
+    if (maxleaf >= 7) {
+        cpuid(r7, 7);                                      // leaf 7 subleaf 0
+        if (r7[0] >= 1) cpuid(r71, 7, 1);                  // leaf 7 subleaf 1
+    }
+    cpuid(abcd, 0x80000000);
+    if (uint32_t(abcd[0]) >= 0x80000001u) cpuid(rx, 0x80000001);
+    cpuid(abcd, 1);                                        // leaf 1
+
+    // features that need only SSE support in the operating system
+    b |= cpuid_bit(abcd[2],  0, cpu_feature_sse3);
+    b |= cpuid_bit(abcd[2],  9, cpu_feature_ssse3);
+    b |= cpuid_bit(abcd[2], 19, cpu_feature_sse41);
+    b |= cpuid_bit(abcd[2], 20, cpu_feature_sse42);
+    b |= cpuid_bit(abcd[2], 23, cpu_feature_popcnt);
+    b |= cpuid_bit(abcd[2],  1, cpu_feature_pclmulqdq);
+    b |= cpuid_bit(abcd[2], 25, cpu_feature_aes);
+    b |= cpuid_bit(abcd[2], 22, cpu_feature_movbe);
+    b |= cpuid_bit(abcd[2], 30, cpu_feature_rdrand);
+    b |= cpuid_bit(r7[1],    3, cpu_feature_bmi1);
+    b |= cpuid_bit(r7[1],    8, cpu_feature_bmi2);
+    b |= cpuid_bit(r7[1],   18, cpu_feature_rdseed);
+    b |= cpuid_bit(r7[1],   19, cpu_feature_adx);
+    b |= cpuid_bit(r7[1],   29, cpu_feature_sha);
+    b |= cpuid_bit(r7[2],    8, cpu_feature_gfni);
+    b |= cpuid_bit(rx[2],    5, cpu_feature_lzcnt);
+
+    if (f.instrset >= 7) {                                 // features that need AVX support in the operating system
+        b |= cpu_feature_avx;
+        b |= cpuid_bit(abcd[2], 29, cpu_feature_f16c);
+        b |= cpuid_bit(abcd[2], 12, cpu_feature_fma3);
+        b |= cpuid_bit(rx[2],   16, cpu_feature_fma4);
+        b |= cpuid_bit(rx[2],   11, cpu_feature_xop);
+        b |= cpuid_bit(r7[1],    5, cpu_feature_avx2);
+        b |= cpuid_bit(r7[2],    9, cpu_feature_vaes);
+        b |= cpuid_bit(r7[2],   10, cpu_feature_vpclmulqdq);
+        b |= cpuid_bit(r71[0],   4, cpu_feature_avxvnni);
+        b |= cpuid_bit(r71[0],  23, cpu_feature_avxifma);
+        b |= cpuid_bit(r71[3],   4, cpu_feature_avxvnniint8);
+        b |= cpuid_bit(r71[3],   5, cpu_feature_avxneconvert);
+    }
+    if (f.instrset >= 9) {                                 // features that need AVX512 support in the operating system
+        b |= cpu_feature_avx512f;
+        b |= cpuid_bit(r7[1],   28, cpu_feature_avx512cd);
+        b |= cpuid_bit(r7[1],   27, cpu_feature_avx512er);
+        b |= cpuid_bit(r7[1],   26, cpu_feature_avx512pf);
+        b |= cpuid_bit(r7[1],   31, cpu_feature_avx512vl);
+        b |= cpuid_bit(r7[1],   30, cpu_feature_avx512bw);
+        b |= cpuid_bit(r7[1],   17, cpu_feature_avx512dq);
+        b |= cpuid_bit(r7[1],   21, cpu_feature_avx512ifma);
+        b |= cpuid_bit(r7[2],    1, cpu_feature_avx512vbmi);
+        b |= cpuid_bit(r7[2],    6, cpu_feature_avx512vbmi2);
+        b |= cpuid_bit(r7[2],   11, cpu_feature_avx512vnni);
+        b |= cpuid_bit(r7[2],   12, cpu_feature_avx512bitalg);
+        b |= cpuid_bit(r7[2],   14, cpu_feature_avx512vpopcntdq);
+        b |= cpuid_bit(r7[3],    8, cpu_feature_avx512vp2intersect);
+        b |= cpuid_bit(r7[3],   23, cpu_feature_avx512fp16);
+        b |= cpuid_bit(r71[0],   5, cpu_feature_avx512bf16);
+    }
+    if (f.instrset >= 7 && (xgetbv(0) & 0x60000) == 0x60000) {
+        // AMX tile state enabled in the operating system.
+        // (Linux requires a call to arch_prctl(ARCH_REQ_XCOMP_PERM) before AMX can be used)
+        b |= cpuid_bit(r7[3],   24, cpu_feature_amxtile);
+        b |= cpuid_bit(r7[3],   25, cpu_feature_amxint8);
+        b |= cpuid_bit(r7[3],   22, cpu_feature_amxbf16);
+        b |= cpuid_bit(r71[0],  21, cpu_feature_amxfp16);
+    }
+    if (f.instrset >= 7 && (r71[3] & (1 << 19)) != 0 && maxleaf >= 0x24) {
+        // AVX10 supported. Leaf 0x24 gives version and vector sizes
+        cpuid(abcd, 0x24);
+        f.avx10_version = abcd[1] & 0xFF;
+        f.avx10_vector_bits = (abcd[1] & (1 << 18)) ? 512 : (abcd[1] & (1 << 17)) ? 256 : 128;
+        if (f.instrset < 9 && f.avx10_vector_bits > 256) {
+            f.avx10_vector_bits = 256;                     // 512 bit registers not enabled by operating system
+        }
+        b |= cpu_feature_avx10;
+    }
+    f.bits = b;
+    cpu_features_data = f;
+    return cpu_features_data;
+}
+
+// find supported instruction set. See instrset_level above for return values
+int instrset_detect(void) {
+    return cpu_features().instrset;
+}
+
 // detect if CPU supports the FMA3 instruction set
 bool hasFMA3(void) {
-    if (instrset_detect() < 7) return false;               // must have AVX
-    int abcd[4];                                           // cpuid results
-    cpuid(abcd, 1);                                        // call cpuid function 1
-    return ((abcd[2] & (1 << 12)) != 0);                   // ecx bit 12 indicates FMA3
+    return cpu_has(cpu_feature_fma3);                      // requires AVX
 }
 
 // detect if CPU supports the FMA4 instruction set
 bool hasFMA4(void) {
-    if (instrset_detect() < 7) return false;               // must have AVX
-    int abcd[4];                                           // cpuid results
-    cpuid(abcd, 0x80000001);                               // call cpuid function 0x80000001
-    return ((abcd[2] & (1 << 16)) != 0);                   // ecx bit 16 indicates FMA4
+    return cpu_has(cpu_feature_fma4);                      // requires AVX
 }
 
 // detect if CPU supports the XOP instruction set
 bool hasXOP(void) {
-    if (instrset_detect() < 7) return false;               // must have AVX
-    int abcd[4];                                           // cpuid results
-    cpuid(abcd, 0x80000001);                               // call cpuid function 0x80000001
-    return ((abcd[2] & (1 << 11)) != 0);                   // ecx bit 11 indicates XOP
+    return cpu_has(cpu_feature_xop);                       // requires AVX
 }
 
 // detect if CPU supports the AVX512ER instruction set
 bool hasAVX512ER(void) {
-    if (instrset_detect() < 9) return false;               // must have AVX512F
-    int abcd[4];                                           // cpuid results
-    cpuid(abcd, 7);                                        // call cpuid function 7
-    return ((abcd[1] & (1 << 27)) != 0);                   // ebx bit 27 indicates AVX512ER
+    return cpu_has(cpu_feature_avx512er);                  // requires AVX512F
 }
 
 // detect if CPU supports the AVX512VBMI instruction set
 bool hasAVX512VBMI(void) {
     if (instrset_detect() < 10) return false;              // must have AVX512BW
-    int abcd[4];                                           // cpuid results
-    cpuid(abcd, 7);                                        // call cpuid function 7
-    return ((abcd[2] & (1 << 1)) != 0);                    // ecx bit 1 indicates AVX512VBMI
+    return cpu_has(cpu_feature_avx512vbmi);
 }
 
 // detect if CPU supports the AVX512VBMI2 instruction set
 bool hasAVX512VBMI2(void) {
     if (instrset_detect() < 10) return false;              // must have AVX512BW
-    int abcd[4];                                           // cpuid results
-    cpuid(abcd, 7);                                        // call cpuid function 7
-    return ((abcd[2] & (1 << 6)) != 0);                    // ecx bit 6 indicates AVX512VBMI2
+    return cpu_has(cpu_feature_avx512vbmi2);
 }
 
 // detect if CPU supports the F16C instruction set
 bool hasF16C(void) {
-    if (instrset_detect() < 7) return false;               // must have AVX
-    int abcd[4];                                           // cpuid results
-    cpuid(abcd, 1);                                        // call cpuid function 1
-    return ((abcd[2] & (1 << 29)) != 0);                   // ecx bit 29 indicates F16C
+    return cpu_has(cpu_feature_f16c);                      // requires AVX
 }
 
 // detect if CPU supports the AVX512_FP16 instruction set
 bool hasAVX512FP16(void) {
     if (instrset_detect() < 10) return false;              // must have AVX512
-    int abcd[4];                                           // cpuid results
-    cpuid(abcd, 7);                                        // call cpuid function 1
-    return ((abcd[3] & (1 << 23)) != 0);                   // edx bit 23 indicates AVX512_FP16
+    return cpu_has(cpu_feature_avx512fp16);
+}
+
+// detect if CPU supports the AVX512_BF16 instruction set
+bool hasAVX512BF16(void) {
+    if (instrset_detect() < 10) return false;              // must have AVX512
+    return cpu_has(cpu_feature_avx512bf16);
+}
+
+// detect if CPU supports the AVX512_VNNI instruction set
+bool hasAVX512VNNI(void) {
+    if (instrset_detect() < 10) return false;              // must have AVX512
+    return cpu_has(cpu_feature_avx512vnni);
+}
+
+// detect if CPU supports the AVX-VNNI instruction set
+bool hasAVXVNNI(void) {
+    if (instrset_detect() < 8) return false;               // must have AVX2
+    return cpu_has(cpu_feature_avxvnni);
 }
 
 
@@ -0,0 +1,214 @@
+/****************************  vcl_dispatch.h   *******************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file with macros and templates for automatic CPU dispatching.
+* This replaces the hand-written function pointers and dispatcher functions
+* of dispatch_example1.cpp and dispatch_example2.cpp.
+*
+* The dispatched code is compiled multiple times, once for each instruction
+* set, in the same way as in dispatch_example2.cpp. Each compilation places
+* the code in a namespace named by VCL_DISPATCH_NAMESPACE:
+*
+* Namespace       Instruction set                 Compiler options (Gnu/Clang)
+* Ns_SSE2         SSE2                            -msse2
+* Ns_SSE41        SSE4.1                          -msse4.1
+* Ns_AVX          AVX                             -mavx
+* Ns_AVX2         AVX2 and FMA3                   -mavx2 -mfma
+* Ns_AVX512       AVX512F/VL/BW/DQ                -mavx512f -mavx512vl -mavx512bw -mavx512dq -mfma
+* Ns_AVX512FP16   AVX512F/VL/BW/DQ + AVX512_FP16  same + -mavx512fp16
+*
+* Usage:
+* // In a header file included in all compilations:
+* VCL_DISPATCH_DECLARE(myfunc, float(float const *, int))
+*
+* // In the dispatched code, compiled once for each instruction set:
+* namespace VCL_DISPATCH_NAMESPACE {
+*     float myfunc(float const * p, int n) { ... }
+* }
+*
+* // In the common code, compiled only once, with the lowest instruction set:
+* VCL_DISPATCH_DEFINE(myfunc, float(float const *, int), dispatch_sse2 | dispatch_avx2 | dispatch_avx512)
+*
+* // Call the function from the common code:
+* float s = myfunc(p, n);
+*
+* The first call to myfunc detects the instruction set with instrset_detect()
+* and related functions, selects the best version among the ones listed in
+* VCL_DISPATCH_DEFINE, and stores a pointer to it. All subsequent calls go
+* directly through this pointer. myfunc.init() may be called at startup to
+* do the detection in advance.
+*
+* All versions listed in VCL_DISPATCH_DEFINE must be compiled and linked.
+* The common code must be compiled only once. It must not be compiled with
+* a higher instruction set than the lowest version, because the dispatcher
+* code runs before the instruction set is known.
+* See dispatch_example3.cpp for a complete example.
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VCL_DISPATCH_H
+#define VCL_DISPATCH_H  20300
+
+#include "instrset.h"                  // instrset_detect etc.
+#include <stdio.h>                     // fprintf
+#include <atomic>                      // std::atomic
+#include <utility>                     // std::forward
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+// Flags indicating which versions of a dispatched function are available
+constexpr int dispatch_sse2        = 0x01;   // SSE2 version in namespace Ns_SSE2
+constexpr int dispatch_sse41       = 0x02;   // SSE4.1 version in namespace Ns_SSE41
+constexpr int dispatch_avx         = 0x04;   // AVX version in namespace Ns_AVX
+constexpr int dispatch_avx2        = 0x08;   // AVX2 + FMA3 version in namespace Ns_AVX2
+constexpr int dispatch_avx512      = 0x10;   // AVX512F/VL/BW/DQ version in namespace Ns_AVX512
+constexpr int dispatch_avx512fp16  = 0x20;   // AVX512_FP16 version in namespace Ns_AVX512FP16
+
+
+// Select the best version among the available versions indicated by the flags in versions.
+// Returns the flag for the selected version, or 0 if none of the versions is supported
+static inline int dispatch_select(int versions) {
+    int iset = cpu_features().instrset;                    // detect supported instruction set
+    if ((versions & dispatch_avx512fp16) && iset >= 10 && cpu_has(cpu_feature_avx512fp16)) return dispatch_avx512fp16;
+    if ((versions & dispatch_avx512) && iset >= 10) return dispatch_avx512;
+    if ((versions & dispatch_avx2) && iset >= 8 && cpu_has(cpu_feature_fma3)) return dispatch_avx2;
+    if ((versions & dispatch_avx) && iset >= 7) return dispatch_avx;
+    if ((versions & dispatch_sse41) && iset >= 5) return dispatch_sse41;
+    if ((versions & dispatch_sse2) && iset >= 2) return dispatch_sse2;
+    return 0;                                              // no version supported
+}
+
+// Error handler called when no version of a dispatched function is supported by the CPU
+static inline void dispatch_error(char const * name) {
+    fprintf(stderr, "\nError: No supported version of function %s for this instruction set\n", name);
+    abort();
+}
+
+// Identity template used for declaring a function from a function type
+template <typename F>
+using dispatch_type_t = F;
+
+
+/*****************************************************************************
+*
+*          Dispatcher class template
+*
+*****************************************************************************/
+// Dispatcher<F, Resolve, name> is a function object that calls the entry function
+// returned by Resolve. F is the function type. Resolve is called only once.
+
+template <typename F, F * (*Resolve)(), char const * (*Name)()>
+class Dispatcher;
+
+template <typename R, typename ... A, R (*(*Resolve)())(A...), char const * (*Name)()>
+class Dispatcher<R(A...), Resolve, Name> {
+public:
+    typedef R FuncType(A...);
+    // Call the selected version
+    R operator () (A ... a) const {
+        return (*pointer.load(std::memory_order_relaxed))(std::forward<A>(a)...);
+    }
+    // Select the version in advance. Returns the selected function
+    FuncType * init() const {
+        FuncType * f = Resolve();
+        if (f == nullptr) dispatch_error(Name());
+        pointer.store(f, std::memory_order_relaxed);
+        return f;
+    }
+    // Get a pointer to the selected version
+    FuncType * get() const {
+        FuncType * f = pointer.load(std::memory_order_relaxed);
+        return f == &dispatch ? init() : f;
+    }
+protected:
+    // Dispatch at the first call
+    static R dispatch(A ... a) {
+        return (*Dispatcher().init())(std::forward<A>(a)...);
+    }
+    // The pointer initially points to dispatch.
+    // After the first call it points to the selected version
+    static inline std::atomic<FuncType *> pointer {&dispatch};
+};
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+
+/*****************************************************************************
+*
+*          Macros for dispatched functions
+*
+*****************************************************************************/
+
+// Choose namespace name depending on which instruction set we compile for
+#ifndef VCL_DISPATCH_NAMESPACE
+#if   INSTRSET >= 10 && defined(__AVX512FP16__)
+#define VCL_DISPATCH_NAMESPACE Ns_AVX512FP16   // AVX512_FP16
+#elif INSTRSET >= 10
+#define VCL_DISPATCH_NAMESPACE Ns_AVX512       // AVX512VL/BW/DQ
+#elif INSTRSET >= 8
+#define VCL_DISPATCH_NAMESPACE Ns_AVX2         // AVX2
+#elif INSTRSET >= 7
+#define VCL_DISPATCH_NAMESPACE Ns_AVX          // AVX
+#elif INSTRSET >= 5
+#define VCL_DISPATCH_NAMESPACE Ns_SSE41        // SSE4.1
+#elif INSTRSET >= 2
+#define VCL_DISPATCH_NAMESPACE Ns_SSE2         // SSE2
+#else
+#error Unsupported instruction set
+#endif
+#endif  // VCL_DISPATCH_NAMESPACE
+
+// Declare function name of type type in all dispatch namespaces.
+// type is a function type, e.g. float(float const *, int). It may not contain vector types.
+// Place this at global scope in code that is compiled for all instruction sets
+#define VCL_DISPATCH_DECLARE(name, type)                                                   \
+    namespace Ns_SSE2       { NAMESPACEPREFIX dispatch_type_t<type> name; }                \
+    namespace Ns_SSE41      { NAMESPACEPREFIX dispatch_type_t<type> name; }                \
+    namespace Ns_AVX        { NAMESPACEPREFIX dispatch_type_t<type> name; }                \
+    namespace Ns_AVX2       { NAMESPACEPREFIX dispatch_type_t<type> name; }                \
+    namespace Ns_AVX512     { NAMESPACEPREFIX dispatch_type_t<type> name; }                \
+    namespace Ns_AVX512FP16 { NAMESPACEPREFIX dispatch_type_t<type> name; }
+
+// Define the dispatcher object name for the function declared with VCL_DISPATCH_DECLARE.
+// versions is a combination of the flags dispatch_sse2, dispatch_avx2, etc., indicating
+// which versions are compiled. Only these versions are linked.
+// Place this at global scope in the common code, which is compiled only once
+#define VCL_DISPATCH_DEFINE(name, type, versions)                                          \
+    template <int V>                                                                       \
+    static NAMESPACEPREFIX dispatch_type_t<type> * name##_dispatch_resolve() {             \
+        int v = NAMESPACEPREFIX dispatch_select(V);                                        \
+        if constexpr ((V & NAMESPACEPREFIX dispatch_avx512fp16) != 0) {                    \
+            if (v == NAMESPACEPREFIX dispatch_avx512fp16) return &Ns_AVX512FP16::name;     \
+        }                                                                                  \
+        if constexpr ((V & NAMESPACEPREFIX dispatch_avx512) != 0) {                        \
+            if (v == NAMESPACEPREFIX dispatch_avx512) return &Ns_AVX512::name;             \
+        }                                                                                  \
+        if constexpr ((V & NAMESPACEPREFIX dispatch_avx2) != 0) {                          \
+            if (v == NAMESPACEPREFIX dispatch_avx2) return &Ns_AVX2::name;                 \
+        }                                                                                  \
+        if constexpr ((V & NAMESPACEPREFIX dispatch_avx) != 0) {                           \
+            if (v == NAMESPACEPREFIX dispatch_avx) return &Ns_AVX::name;                   \
+        }                                                                                  \
+        if constexpr ((V & NAMESPACEPREFIX dispatch_sse41) != 0) {                         \
+            if (v == NAMESPACEPREFIX dispatch_sse41) return &Ns_SSE41::name;               \
+        }                                                                                  \
+        if constexpr ((V & NAMESPACEPREFIX dispatch_sse2) != 0) {                          \
+            if (v == NAMESPACEPREFIX dispatch_sse2) return &Ns_SSE2::name;                 \
+        }                                                                                  \
+        return nullptr;                                                                    \
+    }                                                                                      \
+    static char const * name##_dispatch_name() { return #name; }                           \
+    constexpr NAMESPACEPREFIX Dispatcher<type, &name##_dispatch_resolve<(versions)>,        \
+        &name##_dispatch_name> name {};
+
+#endif // VCL_DISPATCH_H
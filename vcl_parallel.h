@@ -0,0 +1,511 @@
+/****************************  vcl_parallel.h   *******************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining a thread pool and multithreaded versions of the array
+* functions in vector_array.h. This header is optional. It is not included by
+* vectorclass.h.
+*
+* Functions defined here:
+* parallel_transform_vec<V>(out, n, f, p...)  Multithreaded transform_vec
+* parallel_compress_vec<V>(out, n, f, p)      Multithreaded compress_vec
+* parallel_reduce_sum(p, n)                   Multithreaded reduce_sum
+* parallel_reduce_min(p, n)                   Multithreaded reduce_min
+* parallel_reduce_max(p, n)                   Multithreaded reduce_max
+* parallel_reduce_minmax_index(p, n)          Multithreaded reduce_minmax_index
+* parallel_dot(a, b, n)                       Multithreaded dot
+* parallel_sum_squares(p, n)                  Multithreaded sum_squares
+* parallel_prefix_sum(p, out, n, init)       Multithreaded prefix_sum
+* parallel_prefix_sum_exclusive(p, out, n, init) Multithreaded prefix_sum_exclusive
+* parallel_for(n, f)                          Call f(i) for i = 0 .. n-1 in parallel
+*
+* The template parameters are the same as for the functions in vector_array.h.
+* The functions use the thread pool returned by parallel_pool(). This pool
+* is created at the first call, with one thread for each physical core.
+* Call parallel_pool(threads) before any other parallel function to set a
+* different number of threads.
+*
+* The arrays are divided into chunks. The chunk boundaries are aligned to 64 byte
+* cache lines of the output array, so that no two threads write to the same cache
+* line. Each thread works first on a contiguous range of chunks, which is the same
+* in every call with the same array size. This keeps memory pages on the NUMA node
+* of the thread that first touched them. A thread that has finished its own range
+* steals chunks from the other threads.
+*
+* On Linux, the worker threads are pinned to one logical processor on each
+* physical core. The allowed processors are taken from the affinity mask of the
+* process. The calling thread works as thread 0 and is not pinned.
+*
+* Arrays shorter than about 16 kilobytes per thread, and calls from inside the
+* thread pool, are processed in the calling thread only.
+*
+* The functions f must be thread safe. They must not throw exceptions.
+* Floating point sums may differ slightly with different numbers of threads.
+*
+* Example:
+* // y[i] = sqrt(x[i]) for 100 million elements, using all cores
+* parallel_transform_vec<Vec16f>(y, n, [](Vec16f x) {return sqrt(x);}, x);
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VCL_PARALLEL_H
+#define VCL_PARALLEL_H  20300
+
+#include "vector_array.h"              // array functions
+
+#include <stdio.h>                     // fopen, fscanf
+#include <stdint.h>                    // uintptr_t
+#include <string.h>                    // memmove
+#include <atomic>                      // std::atomic
+#include <condition_variable>          // std::condition_variable
+#include <memory>                      // std::unique_ptr
+#include <mutex>                       // std::mutex
+#include <thread>                      // std::thread
+#include <vector>                      // std::vector
+
+#if defined(__linux__)
+#include <pthread.h>                   // pthread_setaffinity_np
+#include <sched.h>                     // sched_getaffinity
+#endif
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+// Minimum number of bytes per chunk
+#ifndef VCL_PARALLEL_MIN_CHUNK
+#define VCL_PARALLEL_MIN_CHUNK   16384
+#endif
+
+// Number of chunks per thread. More chunks give better load balancing
+#ifndef VCL_PARALLEL_CHUNKS_PER_THREAD
+#define VCL_PARALLEL_CHUNKS_PER_THREAD  4
+#endif
+
+
+/*****************************************************************************
+*
+*          Processor list
+*
+*****************************************************************************/
+
+// Make a list of logical processors with one processor for each physical core.
+// Only processors in the affinity mask of the process are included.
+// Returns an empty list if the processor topology is not known
+static inline std::vector<int> parallel_core_list() {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) != 0) return cpus;
+    for (int c = 0; c < CPU_SETSIZE; c++) {
+        if (!CPU_ISSET(c, &set)) continue;
+        // find the first allowed sibling of c on the same core. The list has a format like "0,64" or "0-1"
+        char name[96];
+        snprintf(name, sizeof(name), "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", c);
+        int first = c;
+        if (FILE * f = fopen(name, "r")) {
+            int a, b;
+            while (fscanf(f, "%d", &a) == 1) {
+                b = a;
+                int sep = fgetc(f);
+                if (sep == '-') {
+                    if (fscanf(f, "%d", &b) != 1) break;
+                    sep = fgetc(f);
+                }
+                for (int s = a; s <= b && s < CPU_SETSIZE; s++) {
+                    if (s >= 0 && CPU_ISSET(s, &set)) {
+                        if (s < first) first = s;
+                        break;
+                    }
+                }
+                if (sep != ',') break;
+            }
+            fclose(f);
+        }
+        if (first == c) cpus.push_back(c);
+    }
+#endif
+    return cpus;
+}
+
+// Pin the calling thread to logical processor cpu. Does nothing if not supported
+static inline void parallel_pin_thread(int cpu) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+
+/*****************************************************************************
+*
+*          class ThreadPool
+*
+*****************************************************************************/
+// ThreadPool is a persistent pool of worker threads. run(nchunks, f) calls f(c) for
+// c = 0 .. nchunks-1 and returns when all calls have finished. The calling thread
+// takes part in the work.
+//
+// The chunks are divided into one contiguous range for each thread. Each thread
+// takes chunks from the start of its own range. When that is empty, it takes chunks
+// from the ranges of the other threads.
+
+class ThreadPool {
+public:
+    // Constructor. threads = total number of threads including the calling thread.
+    // 0 means one thread for each physical core. pin = pin the worker threads to cores
+    explicit ThreadPool(int threads = 0, bool pin = true) {
+        std::vector<int> cpus = parallel_core_list();
+        if (threads <= 0) {
+            threads = cpus.empty() ? int(std::thread::hardware_concurrency()) : int(cpus.size());
+            if (threads <= 0) threads = 1;
+        }
+        nthreads = threads;
+        queues.reset(new Queue[nthreads]);
+        for (int t = 0; t < nthreads; t++) {
+            queues[t].next.store(0, std::memory_order_relaxed);
+            queues[t].end = 0;
+        }
+        for (int t = 1; t < nthreads; t++) {
+            int cpu = (pin && !cpus.empty()) ? cpus[t % cpus.size()] : -1;
+            workers.emplace_back([this, t, cpu]() {worker(t, cpu);});
+        }
+    }
+    // Destructor. Stops the worker threads
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_all();
+        for (std::thread & w : workers) w.join();
+    }
+    ThreadPool(ThreadPool const &) = delete;
+    ThreadPool & operator = (ThreadPool const &) = delete;
+    // Number of threads, including the calling thread
+    int size() const {
+        return nthreads;
+    }
+    // Call f(c) for c = 0 .. nchunks-1, distributed over the threads
+    template <typename F>
+    void run(size_t nchunks, F & f) {
+        if (nchunks == 0) return;
+        if (nthreads == 1 || nchunks == 1 || in_pool) {
+            for (size_t c = 0; c < nchunks; c++) f(c);   // single thread
+            return;
+        }
+        std::lock_guard<std::mutex> run_lock(run_mutex); // one job at a time
+        for (int t = 0; t < nthreads; t++) {
+            queues[t].next.store(nchunks * t / nthreads, std::memory_order_relaxed);
+            queues[t].end = nchunks * (t + 1) / nthreads;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job_call = [](void * context, size_t c) {(*static_cast<F*>(context))(c);};
+            job_context = &f;
+            active = nthreads - 1;
+            generation++;
+        }
+        wake.notify_all();
+        in_pool = true;
+        work(0);                                 // the calling thread is thread 0
+        in_pool = false;
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this]() {return active == 0;});
+    }
+protected:
+    // Range of chunks for one thread. Aligned to avoid false sharing
+    struct alignas(64) Queue {
+        std::atomic<size_t> next;                // next chunk to do
+        size_t end;                              // end of range
+    };
+    // Do the chunks of thread t, then steal chunks from the other threads
+    void work(int t) {
+        for (int i = 0; i < nthreads; i++) {
+            Queue & q = queues[(t + i) % nthreads];
+            for (;;) {
+                size_t c = q.next.fetch_add(1, std::memory_order_relaxed);
+                if (c >= q.end) break;
+                job_call(job_context, c);
+            }
+        }
+    }
+    // Main function of worker thread t
+    void worker(int t, int cpu) {
+        if (cpu >= 0) parallel_pin_thread(cpu);
+        in_pool = true;
+        uint64_t seen = 0;                       // last generation done
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [this, seen]() {return stop || generation != seen;});
+                if (stop) return;
+                seen = generation;
+            }
+            work(t);
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--active == 0) done.notify_one();
+        }
+    }
+    int nthreads;                                // number of threads including the calling thread
+    std::unique_ptr<Queue[]> queues;             // chunk ranges
+    std::vector<std::thread> workers;            // worker threads 1 .. nthreads-1
+    std::mutex mutex;                            // protects the members below
+    std::condition_variable wake;                // signals new job or stop
+    std::condition_variable done;                // signals that all workers have finished
+    void (*job_call)(void *, size_t) = nullptr;  // calls the function of the current job
+    void * job_context = nullptr;                // function object of the current job
+    uint64_t generation = 0;                     // job counter
+    int active = 0;                              // number of workers still working on the job
+    bool stop = false;                           // stop the workers
+    std::mutex run_mutex;                        // serializes calls to run
+    static inline thread_local bool in_pool = false; // true in the threads of any pool while working
+};
+
+// The thread pool used by the parallel functions. It is created at the first call.
+// The parameters are used only at the first call. threads = number of threads
+// including the calling thread, 0 for one thread per physical core. pin = pin
+// the worker threads to cores
+inline ThreadPool & parallel_pool(int threads = 0, bool pin = true) {
+    static ThreadPool pool(threads, pin);
+    return pool;
+}
+
+
+/*****************************************************************************
+*
+*          Chunks
+*
+*****************************************************************************/
+// Division of an array of n elements into chunks. Chunk 0 ends at a 64-byte
+// boundary of the array, and all the other chunks except the last one have
+// the same size, which is a multiple of 64 bytes and of the vector size
+
+struct ParallelChunks {
+    size_t n;                                    // number of elements
+    size_t first;                                // end of chunk 0
+    size_t size;                                 // size of the other chunks
+    size_t count;                                // number of chunks
+    size_t begin(size_t c) const {               // start of chunk c
+        return c == 0 ? 0 : first + (c - 1) * size;
+    }
+    size_t end(size_t c) const {                 // end of chunk c
+        size_t e = first + c * size;
+        return e < n ? e : n;
+    }
+};
+
+// Divide an array p of n elements into chunks for vectors of N elements and threads threads
+template <typename T>
+static inline ParallelChunks parallel_chunks(T const * p, size_t n, size_t N, int threads) {
+    size_t unit = 64 / sizeof(T);                // elements per cache line
+    if (unit < N) unit = N;
+    unit = (unit + N - 1) / N * N;               // multiple of cache line and vector size
+    size_t size = n / (size_t(threads) * VCL_PARALLEL_CHUNKS_PER_THREAD);
+    size_t min_size = VCL_PARALLEL_MIN_CHUNK / sizeof(T);
+    if (size < min_size) size = min_size;
+    size = (size + unit - 1) / unit * unit;      // round up to multiple of unit
+    size_t head = 0;                             // elements before the first 64-byte boundary
+    uintptr_t misalign = uintptr_t(p) % 64;
+    if (misalign % sizeof(T) == 0 && misalign != 0) head = (64 - misalign) / sizeof(T);
+    ParallelChunks ch;
+    ch.n = n;
+    ch.size = size;
+    ch.first = head + size;
+    ch.count = n <= ch.first ? 1 : 1 + (n - ch.first + size - 1) / size;
+    return ch;
+}
+
+// Call f(b, e) for each chunk [b, e) of an array p of n elements and vectors of N elements
+template <typename T, typename F>
+static inline void parallel_chunk_run(T const * p, size_t n, size_t N, F f) {
+    ThreadPool & pool = parallel_pool();
+    ParallelChunks ch = parallel_chunks(p, n, N, pool.size());
+    auto task = [&ch, &f](size_t c) {f(ch.begin(c), ch.end(c));};
+    pool.run(ch.count, task);
+}
+
+// Divide an array p of n elements into chunks, calculate r[c] = f(b, e) for each chunk c,
+// and combine the results in the order of the chunks with combine(r0, r1)
+template <typename R, typename T, typename F, typename C>
+static inline R parallel_chunk_reduce(T const * p, size_t n, size_t N, F f, C combine) {
+    ThreadPool & pool = parallel_pool();
+    ParallelChunks ch = parallel_chunks(p, n, N, pool.size());
+    std::vector<R> results(ch.count);
+    auto task = [&ch, &f, &results](size_t c) {results[c] = f(ch.begin(c), ch.end(c));};
+    pool.run(ch.count, task);
+    R r = results[0];
+    for (size_t c = 1; c < ch.count; c++) r = combine(r, results[c]);
+    return r;
+}
+
+
+/*****************************************************************************
+*
+*          Parallel array functions
+*
+*****************************************************************************/
+
+// Call f(i) for i = 0 .. n-1, distributed over the threads of the pool
+template <typename F>
+static inline void parallel_for(size_t n, F f) {
+    auto task = [&f](size_t i) {f(i);};
+    parallel_pool().run(n, task);
+}
+
+// Multithreaded transform_vec. The chunks are aligned to cache lines of out
+template <typename V, int U = VCL_ARRAY_UNROLL, typename F, typename TO, typename ... T>
+static inline void parallel_transform_vec(TO * out, size_t n, F f, T const * ... p) {
+    bool stream = array_use_stream(out, n);      // decided by the size of the whole array
+    parallel_chunk_run(out, n, V::size(), [&](size_t b, size_t e) {
+        F g = f;                                 // each chunk has its own copy of f, as in transform_vec
+        transform_vec_store<V, U>(out + b, e - b, g, stream, (p + b)...);
+    });
+}
+
+// Multithreaded compress_vec. Returns the number of elements stored.
+// out may be identical to p, as for compress_vec, but must not overlap partially with p.
+// If out and p are different, f is called twice for each element: first for counting,
+// then for storing. If out is identical to p, each chunk is compressed in place, and the
+// results are then moved down to their final positions one chunk at a time, in order.
+// A chunk could otherwise overwrite elements of a preceding chunk that have not been
+// read yet by another thread
+template <typename V, typename F, typename T>
+static inline size_t parallel_compress_vec(T * out, size_t n, F f, T const * p) {
+    ThreadPool & pool = parallel_pool();
+    ParallelChunks ch = parallel_chunks(p, n, V::size(), pool.size());
+    std::vector<size_t> pos(ch.count + 1);       // output position of each chunk
+    if (out == p) {
+        auto compress = [&](size_t c) {
+            pos[c + 1] = compress_vec<V>(out + ch.begin(c), ch.end(c) - ch.begin(c), f, p + ch.begin(c));
+        };
+        pool.run(ch.count, compress);
+        pos[0] = 0;
+        for (size_t c = 0; c < ch.count; c++) {
+            size_t m = pos[c + 1];               // number of elements in chunk c
+            if (m > 0 && pos[c] != ch.begin(c)) {
+                memmove(out + pos[c], out + ch.begin(c), m * sizeof(T));
+            }
+            pos[c + 1] = pos[c] + m;
+        }
+        return pos[ch.count];
+    }
+    auto count = [&](size_t c) {pos[c + 1] = count_vec<V>(ch.end(c) - ch.begin(c), f, p + ch.begin(c));};
+    pool.run(ch.count, count);
+    pos[0] = 0;
+    for (size_t c = 0; c < ch.count; c++) pos[c + 1] += pos[c];
+    auto store = [&](size_t c) {compress_vec<V>(out + pos[c], ch.end(c) - ch.begin(c), f, p + ch.begin(c));};
+    pool.run(ch.count, store);
+    return pos[ch.count];
+}
+
+// Multithreaded reduce_sum
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline auto parallel_reduce_sum(T const * p, size_t n) {
+    typedef decltype(reduce_sum<V, U>(p, n)) R;
+    return parallel_chunk_reduce<R>(p, n, array_vector_select<V, T>::size(),
+        [p](size_t b, size_t e) {return reduce_sum<V, U>(p + b, e - b);},
+        [](R const a, R const b) {return R(a + b);});
+}
+
+// Multithreaded reduce_min
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline T parallel_reduce_min(T const * p, size_t n) {
+    return parallel_chunk_reduce<T>(p, n, array_vector_select<V, T>::size(),
+        [p](size_t b, size_t e) {return reduce_min<V, U>(p + b, e - b);},
+        [](T const a, T const b) {return b < a ? b : a;});
+}
+
+// Multithreaded reduce_max
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline T parallel_reduce_max(T const * p, size_t n) {
+    return parallel_chunk_reduce<T>(p, n, array_vector_select<V, T>::size(),
+        [p](size_t b, size_t e) {return reduce_max<V, U>(p + b, e - b);},
+        [](T const a, T const b) {return b > a ? b : a;});
+}
+
+// Multithreaded reduce_minmax_index
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline MinMaxIndex<T> parallel_reduce_minmax_index(T const * p, size_t n) {
+    typedef MinMaxIndex<T> R;
+    if (n == 0) return reduce_minmax_index<V, U>(p, n);
+    return parallel_chunk_reduce<R>(p, n, array_vector_select<V, T>::size(),
+        [p](size_t b, size_t e) {
+            R r = reduce_minmax_index<V, U>(p + b, e - b);
+            r.index_min += b;  r.index_max += b;
+            return r;
+        },
+        [](R a, R const b) {                     // a is before b in the array
+            if (b.min < a.min) {
+                a.min = b.min;  a.index_min = b.index_min;
+            }
+            if (b.max > a.max) {
+                a.max = b.max;  a.index_max = b.index_max;
+            }
+            return a;
+        });
+}
+
+// Multithreaded dot
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline T parallel_dot(T const * a, T const * b, size_t n) {
+    return parallel_chunk_reduce<T>(a, n, array_vector_select<V, T>::size(),
+        [a, b](size_t i, size_t e) {return dot<V, U>(a + i, b + i, e - i);},
+        [](T const x, T const y) {return T(x + y);});
+}
+
+// Multithreaded sum_squares
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline T parallel_sum_squares(T const * p, size_t n) {
+    return parallel_chunk_reduce<T>(p, n, array_vector_select<V, T>::size(),
+        [p](size_t b, size_t e) {return sum_squares<V, U>(p + b, e - b);},
+        [](T const x, T const y) {return T(x + y);});
+}
+
+// Multithreaded prefix sums: inclusive if exclusive is false. Two passes: first the sum
+// of each chunk, then the prefix sums of each chunk starting with the sum of all
+// preceding chunks
+template <typename V, bool exclusive, typename T>
+static inline T parallel_prefix_sum_array(T const * p, T * out, size_t n, T init) {
+    ThreadPool & pool = parallel_pool();
+    ParallelChunks ch = parallel_chunks(out, n, V::size(), pool.size());
+    if (ch.count == 1 || pool.size() == 1) return prefix_sum_array<V, exclusive>(p, out, n, init);
+    std::vector<T> start(ch.count + 1);          // sum of the preceding chunks
+    auto sum = [&](size_t c) {start[c + 1] = T(reduce_sum<V>(p + ch.begin(c), ch.end(c) - ch.begin(c)));};
+    pool.run(ch.count, sum);
+    start[0] = init;
+    for (size_t c = 0; c < ch.count; c++) start[c + 1] = T(start[c] + start[c + 1]);
+    auto scan = [&](size_t c) {
+        prefix_sum_array<V, exclusive>(p + ch.begin(c), out + ch.begin(c), ch.end(c) - ch.begin(c), start[c]);
+    };
+    pool.run(ch.count, scan);
+    return start[ch.count];
+}
+
+// Multithreaded prefix_sum
+template <typename V = void, typename T>
+static inline T parallel_prefix_sum(T const * p, T * out, size_t n, T init = T(0)) {
+    return parallel_prefix_sum_array<array_vector_select<V, T>, false>(p, out, n, init);
+}
+
+// Multithreaded prefix_sum_exclusive
+template <typename V = void, typename T>
+static inline T parallel_prefix_sum_exclusive(T const * p, T * out, size_t n, T init = T(0)) {
+    return parallel_prefix_sum_array<array_vector_select<V, T>, true>(p, out, n, init);
+}
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VCL_PARALLEL_H
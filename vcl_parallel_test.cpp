@@ -0,0 +1,114 @@
+/**************************  vcl_parallel_test.cpp   **************************
+Author:        VCL contributors
+Date created:  2026-10-14
+Last modified: 2026-10-14
+Version:       2.03.00
+Project:       vector class library
+Description:   Test of the multithreaded array functions in vcl_parallel.h.
+               The results are compared with a simple scalar calculation.
+
+The test uses 4 threads, or the number given on the command line, also on a
+machine with fewer cores, so that chunks are processed concurrently.
+
+Compile and run with Gnu or Clang compiler:
+
+g++ -O2 -std=c++17 -mavx2 -mfma vcl_parallel_test.cpp -pthread -otest_parallel
+./test_parallel
+./test_parallel 16           use 16 threads
+
+The program prints the failed tests and returns a nonzero exit code if any
+test failed.
+
+(c) Copyright 2026 VCL contributors.
+Apache License version 2.0 or later.
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <vector>
+#include "vcl_parallel.h"
+
+#ifdef VCL_NAMESPACE
+using namespace VCL_NAMESPACE;
+#endif
+
+static int failures = 0;
+
+static void check(bool ok, char const * test, size_t n, int offset) {
+    if (!ok) {
+        printf("Failed: %s, n = %zu, offset = %i\n", test, n, offset);
+        failures++;
+    }
+}
+
+// Pseudo-random test data
+static uint32_t test_value(size_t i) {
+    uint32_t x = uint32_t(i) * 2654435761u;
+    return x ^ (x >> 15);
+}
+
+// parallel_compress_vec with separate output and in place, against a scalar reference.
+// offset misaligns the array relative to the cache lines
+static void test_compress(size_t n, int offset) {
+    std::vector<uint32_t> data(n + offset), out(n + offset);
+    for (size_t i = 0; i < n; i++) data[i + offset] = test_value(i);
+    auto keep = [](Vec8ui x) {return (x & 3u) != 0u;};     // keep about 3/4 of the elements
+    std::vector<uint32_t> ref;
+    for (size_t i = 0; i < n; i++) {
+        if ((test_value(i) & 3u) != 0u) ref.push_back(test_value(i));
+    }
+    uint32_t * p = data.data() + offset;
+
+    // separate output array
+    size_t c = parallel_compress_vec<Vec8ui>(out.data() + offset, n, keep, p);
+    bool ok = c == ref.size();
+    for (size_t i = 0; ok && i < c; i++) ok = out[i + offset] == ref[i];
+    check(ok, "parallel_compress_vec", n, offset);
+
+    // in place
+    c = parallel_compress_vec<Vec8ui>(p, n, keep, p);
+    ok = c == ref.size();
+    for (size_t i = 0; ok && i < c; i++) ok = p[i] == ref[i];
+    check(ok, "parallel_compress_vec in place", n, offset);
+}
+
+// parallel_transform_vec and the reductions, against a scalar reference
+static void test_transform_reduce(size_t n, int offset) {
+    std::vector<uint32_t> data(n + offset), out(n + offset);
+    for (size_t i = 0; i < n; i++) data[i + offset] = test_value(i) & 0xFFFF;
+    uint32_t const * p = data.data() + offset;
+    parallel_transform_vec<Vec8ui>(out.data() + offset, n, [](Vec8ui x) {return x * 3u + 1u;}, p);
+    uint64_t sum = 0;
+    uint32_t mn = 0xFFFFFFFF, mx = 0;
+    bool ok = true;
+    for (size_t i = 0; i < n; i++) {
+        ok = ok && out[i + offset] == p[i] * 3u + 1u;
+        sum += p[i];
+        if (p[i] < mn) mn = p[i];
+        if (p[i] > mx) mx = p[i];
+    }
+    check(ok, "parallel_transform_vec", n, offset);
+    check(parallel_reduce_sum(p, n) == sum, "parallel_reduce_sum", n, offset);
+    if (n > 0) {
+        check(parallel_reduce_min(p, n) == mn, "parallel_reduce_min", n, offset);
+        check(parallel_reduce_max(p, n) == mx, "parallel_reduce_max", n, offset);
+    }
+}
+
+int main(int argc, char * argv[]) {
+    int threads = argc > 1 ? atoi(argv[1]) : 4;
+    if (threads < 1) threads = 1;
+    parallel_pool(threads);
+    printf("Testing vcl_parallel.h with %i threads\n", parallel_pool().size());
+
+    size_t sizes[] = {0, 1, 100, 4099, 1000003, 10000019};
+    for (size_t n : sizes) {
+        for (int offset = 0; offset < 3; offset++) {
+            test_compress(n, offset);
+            test_transform_reduce(n, offset);
+        }
+    }
+    if (failures == 0) printf("All tests passed\n");
+    return failures != 0;
+}
@@ -0,0 +1,886 @@
+/****************************  vector_array.h   *******************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining templates for applying vector operations to arrays of
+* arbitrary length. The array is divided into blocks of one vector each.
+* The main loop is unrolled to hide the latency of the operations, and the
+* remaining elements at the end of the array are handled with load_partial
+* and store_partial. These functions use masked loads and stores when AVX512
+* is enabled, so that no scalar epilogue is needed.
+* Vector loads and stores that cross a cache line boundary are slow. Where the
+* block boundaries do not matter, the first elements up to the alignment boundary
+* of the output array, or of the first input array for the reductions, are done
+* in the same way as the tail. The vector blocks are then loaded with load_a and
+* stored with store_a. Arrays allocated with AlignedAllocator or AlignedVector
+* (vector_memory.h) are aligned already and need no head.
+*
+* Functions defined here:
+* for_each_vec<V>(n, f, p...)        Call f(V...) for each block of the arrays p
+* transform_vec<V>(out, n, f, p...)  Store f(V...) into out for each block of
+*                                    the arrays p
+* reduce_sum(p, n)                   Sum of array elements
+* reduce_sum_kahan(p, n)             Sum of float or double array with Kahan summation
+* reduce_min(p, n), reduce_max(p, n) Smallest or biggest array element
+* reduce_minmax_index(p, n)          Smallest and biggest element and their indexes
+* dot(a, b, n)                       Dot product of two arrays
+* sum_squares(p, n)                  Sum of squares of array elements
+* compress_vec<V>(out, n, f, p)      Store the elements of p where f(V) is true
+* count_vec<V>(n, f, p)              Count the elements of p where f(V) is true
+* prefix_sum(p, out, n, init)        Inclusive prefix sums of array p
+* prefix_sum_exclusive(p, out, n, init) Exclusive prefix sums of array p
+*
+* transform_vec writes the output with non-temporal stores if the output array
+* is bigger than the last level cache, or bigger than VCL_ARRAY_STREAM_LIMIT
+* bytes if this macro is defined.
+*
+* The vector class V is given explicitly as template parameter. An optional
+* second template parameter gives the unroll factor (1, 2, 4 or 8; default 4).
+* For the reduction functions, V is optional. The default is the biggest vector
+* class that the instruction set supports. The unroll factor is the number of
+* independent accumulators.
+*
+* Example:
+* // y[i] = a * x[i] + y[i] for i = 0 .. n-1
+* transform_vec<Vec16f>(y, n, [a](Vec16f x, Vec16f y) {return mul_add(a, x, y);}, x, y);
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_ARRAY_H
+#define VECTOR_ARRAY_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include <stddef.h>                    // define size_t
+#include <utility>                     // define std::integer_sequence
+#include <type_traits>                 // define std::conditional
+#include <limits>                      // define std::numeric_limits
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+// Default unroll factor for array functions
+#ifndef VCL_ARRAY_UNROLL
+#define VCL_ARRAY_UNROLL  4
+#endif
+
+
+/*****************************************************************************
+*
+*          Helper templates for array functions
+*
+*****************************************************************************/
+
+// Vector type V for each array of type T. Used for expanding parameter packs
+template <typename V, typename T>
+using array_vec_t = V;
+
+// Load one vector block from p + i. p + i must be aligned by the vector size if aligned is true
+template <typename V, bool aligned = false, typename T>
+static inline V array_load_block(T const * p, size_t i) {
+    V x;
+    if constexpr (aligned) {
+        x.load_a(p + i);
+    }
+    else {
+        x.load(p + i);
+    }
+    return x;
+}
+
+// Load the first r elements from p into a vector block. The rest is zero
+template <typename V, typename T>
+static inline V array_load_partial(int r, T const * p) {
+    V x(0);                                      // V().load_partial would give the signed type for unsigned V
+    x.load_partial(r, p);
+    return x;
+}
+
+// Call f with one vector block from each array, starting at index i.
+// The blocks are loaded with load_a if aligned is true
+template <typename V, bool aligned = false, typename F, typename ... T>
+static inline auto array_call_block(size_t i, F & f, T const * ... p) {
+    return f(array_load_block<V, aligned>(p, i)...);
+}
+
+// Call f for U consecutive vector blocks starting at index i
+template <typename V, bool aligned, typename F, typename ... T, int ... J>
+static inline void for_each_unrolled(size_t i, F & f, std::integer_sequence<int, J...>, T const * ... p) {
+    constexpr size_t N = V::size();
+    (array_call_block<V, aligned>(i + J * N, f, p...), ...);
+}
+
+// Store vector x at p. Use store_a if aligned is true, or a non-temporal store if nt is true.
+// p must then be aligned by the vector size
+template <bool aligned, bool nt, typename R, typename TO>
+static inline void array_store(R const & x, TO * p) {
+    if constexpr (nt) {
+        x.store_nt(p);
+    }
+    else if constexpr (aligned) {
+        x.store_a(p);
+    }
+    else {
+        x.store(p);
+    }
+}
+
+// Calculate f for U consecutive vector blocks starting at index i and store the results.
+// All results are calculated before the first store so that the calculations can
+// overlap, and so that out may be identical to one of the inputs
+template <typename V, bool sa, bool nt, bool la, typename F, typename TO, typename ... T, int ... J>
+static inline void transform_unrolled(TO * out, size_t i, F & f, std::integer_sequence<int, J...>, T const * ... p) {
+    constexpr size_t N = V::size();
+    typedef decltype(f(std::declval<array_vec_t<V, T>>()...)) R; // result vector type
+    R y[sizeof...(J)];                           // results
+    ((y[J] = array_call_block<V, la>(i + J * N, f, p...)), ...);
+    (array_store<sa, nt>(y[J], out + i + J * N), ...);
+}
+
+// Check if all the arrays p are aligned by the size of vector V, so that load_a can be used
+template <typename V, typename ... T>
+static inline bool array_aligned(T const * ... p) {
+    return ((size_t(p) % sizeof(V) == 0) && ...);
+}
+
+// Number of elements before the first element of p that is aligned by the size of vector V.
+// A vector load or store that crosses a cache line boundary is slower. The array functions
+// therefore do these elements separately, so that the rest of the array is aligned.
+// Returns 0 if the array is too small to gain from this, or if p is not aligned by the
+// element size
+template <typename V, typename T>
+static inline size_t array_align_head(T const * p, size_t n) {
+    constexpr size_t N = V::size();
+    size_t head = ((0 - size_t(p)) & (sizeof(V) - 1)) / sizeof(T);
+    if (n < 4 * N || size_t(p) % sizeof(T) != 0) head = 0;
+    return head;
+}
+
+// Arrays bigger than this number of bytes are written with non-temporal stores
+// by transform_vec. The default is the size of the last level cache
+static inline size_t array_stream_limit() {
+#ifdef VCL_ARRAY_STREAM_LIMIT
+    return VCL_ARRAY_STREAM_LIMIT;
+#else
+    static const size_t limit = last_level_cache_size();   // detected only once
+    return limit > 0 ? limit : 0x800000;         // 8 MB if unknown
+#endif
+}
+
+// Check if an output array of n elements should be written with non-temporal stores
+template <typename TO>
+static inline bool array_use_stream(TO const * out, size_t n) {
+    return n * sizeof(TO) > array_stream_limit() && size_t(out) % sizeof(TO) == 0;
+}
+
+
+/*****************************************************************************
+*
+*          for_each_vec
+*
+*****************************************************************************/
+// Call f for the whole vector blocks of the arrays p and return the number of elements
+// done. The blocks are loaded with load_a if aligned is true
+template <typename V, int U, bool aligned, typename F, typename ... T>
+static inline size_t for_each_blocks(size_t n, F & f, T const * ... p) {
+    constexpr size_t N = V::size();              // vector size
+    size_t i = 0;                                // array index
+    if constexpr (U > 1) {
+        for (; i + U * N <= n; i += U * N) {     // unrolled main loop
+            for_each_unrolled<V, aligned>(i, f, std::make_integer_sequence<int, U>(), p...);
+        }
+    }
+    for (; i + N <= n; i += N) {                 // remaining whole vectors
+        array_call_block<V, aligned>(i, f, p...);
+    }
+    return i;
+}
+
+// Call f(V const x...) for each block of V::size() elements of the arrays p.
+// All arrays must have at least n elements. f is called with one vector from
+// each array, in the order of increasing index. The last block is loaded with
+// load_partial if n is not divisible by V::size(), and the unused elements
+// are set to zero.
+// The blocks are loaded with load_a if all the arrays are aligned by the vector size
+template <typename V, int U = VCL_ARRAY_UNROLL, typename F, typename ... T>
+static inline void for_each_vec(size_t n, F f, T const * ... p) {
+    static_assert(sizeof...(T) > 0, "for_each_vec needs at least one array");
+    static_assert(U == 1 || U == 2 || U == 4 || U == 8, "unroll factor must be 1, 2, 4 or 8");
+    size_t i = array_aligned<V>(p...) ? for_each_blocks<V, U, true>(n, f, p...) : for_each_blocks<V, U, false>(n, f, p...);
+    if (i < n) {                                 // last partial vector
+        int r = int(n - i);                      // number of remaining elements
+        f(array_load_partial<V>(r, p + i)...);
+    }
+}
+
+
+/*****************************************************************************
+*
+*          transform_vec
+*
+*****************************************************************************/
+// Calculate out[i] = f(p[i]...) for i = i0 .. n-1. The whole vector blocks are stored
+// with store_a if sa is true, or with non-temporal stores if nt is true, and loaded
+// with load_a if la is true. The last incomplete block is stored normally
+template <typename V, int U, bool sa, bool nt, bool la, typename F, typename TO, typename ... T>
+static inline void transform_blocks(TO * out, size_t i, size_t n, F & f, T const * ... p) {
+    constexpr size_t N = V::size();              // vector size
+    if constexpr (U > 1) {
+        for (; i + U * N <= n; i += U * N) {     // unrolled main loop
+            transform_unrolled<V, sa, nt, la>(out, i, f, std::make_integer_sequence<int, U>(), p...);
+        }
+    }
+    for (; i + N <= n; i += N) {                 // remaining whole vectors
+        array_store<sa, nt>(array_call_block<V, la>(i, f, p...), out + i);
+    }
+    if (i < n) {                                 // last partial vector
+        int r = int(n - i);                      // number of remaining elements
+        f(array_load_partial<V>(r, p + i)...).store_partial(r, out + i);
+    }
+}
+
+// transform_blocks from index head, where out + head is aligned by the vector size.
+// The inputs are loaded with load_a if they are aligned too
+template <typename V, int U, bool nt, typename F, typename TO, typename ... T>
+static inline void transform_blocks_aligned(TO * out, size_t head, size_t n, F & f, T const * ... p) {
+    if (array_aligned<V>((p + head)...)) {
+        transform_blocks<V, U, true, nt, true>(out, head, n, f, p...);
+    }
+    else {
+        transform_blocks<V, U, true, nt, false>(out, head, n, f, p...);
+    }
+}
+
+// transform_vec with non-temporal stores if stream is true
+template <typename V, int U, typename F, typename TO, typename ... T>
+static inline void transform_vec_store(TO * out, size_t n, F & f, bool stream, T const * ... p) {
+    typedef decltype(f(std::declval<array_vec_t<V, T>>()...)) R; // result vector type
+    // The first elements are stored with a partial store so that the rest of out
+    // is aligned by the vector size. This is required by store_nt, and it avoids
+    // stores that cross a cache line boundary
+    size_t head = stream ? ((0 - size_t(out)) & (sizeof(R) - 1)) / sizeof(TO) : array_align_head<R>(out, n);
+    if (head > n) head = n;
+    if (head > 0) {
+        f(array_load_partial<V>(int(head), p)...).store_partial(int(head), out);
+    }
+    if (stream) {
+        transform_blocks_aligned<V, U, true>(out, head, n, f, p...);
+        _mm_sfence();                            // make non-temporal stores visible to other threads
+    }
+    else if (size_t(out + head) % sizeof(R) == 0) {
+        transform_blocks_aligned<V, U, false>(out, head, n, f, p...);
+    }
+    else {                                       // small array or out not aligned by the element size
+        transform_blocks<V, U, false, false, false>(out, 0, n, f, p...);
+    }
+}
+
+// Calculate out[i] = f(p[i]...) for i = 0 .. n-1, one vector block at a time.
+// f takes one vector of type V from each of the input arrays p and returns a vector
+// with the same number of elements. The element type of the returned vector must
+// match out. out may be identical to one of the inputs, but must not overlap
+// partially with any input.
+// The last incomplete block is loaded with load_partial and stored with store_partial
+// so that no element outside the arrays is read or written. If out is not aligned by the
+// vector size, the first few elements are done in the same way, so that the rest of out
+// can be stored with store_a.
+// Non-temporal stores are used if out is bigger than array_stream_limit(). This
+// avoids filling the cache with output data that will not be read again soon.
+template <typename V, int U = VCL_ARRAY_UNROLL, typename F, typename TO, typename ... T>
+static inline void transform_vec(TO * out, size_t n, F f, T const * ... p) {
+    static_assert(sizeof...(T) > 0, "transform_vec needs at least one input array");
+    static_assert(U == 1 || U == 2 || U == 4 || U == 8, "unroll factor must be 1, 2, 4 or 8");
+    typedef decltype(f(std::declval<array_vec_t<V, T>>()...)) R; // result vector type
+    static_assert(R::size() == V::size(), "f must return a vector with the same number of elements");
+    transform_vec_store<V, U>(out, n, f, array_use_stream(out, n), p...);
+}
+
+
+/*****************************************************************************
+*
+*          Default vector class for arrays
+*
+*****************************************************************************/
+// array_vector<T>::type is the biggest vector class with elements of type T that
+// the instruction set supports. It is used by the reduction functions below when
+// no vector class is specified
+template <typename T> struct array_vector;
+
+#define VCL_ARRAY_VECTOR(T, V) template <> struct array_vector<T> { typedef V type; };
+
+#if MAX_VECTOR_SIZE >= 512 && INSTRSET >= 10
+VCL_ARRAY_VECTOR(int8_t,   Vec64c)
+VCL_ARRAY_VECTOR(uint8_t,  Vec64uc)
+VCL_ARRAY_VECTOR(int16_t,  Vec32s)
+VCL_ARRAY_VECTOR(uint16_t, Vec32us)
+#elif MAX_VECTOR_SIZE >= 256 && INSTRSET >= 8
+VCL_ARRAY_VECTOR(int8_t,   Vec32c)
+VCL_ARRAY_VECTOR(uint8_t,  Vec32uc)
+VCL_ARRAY_VECTOR(int16_t,  Vec16s)
+VCL_ARRAY_VECTOR(uint16_t, Vec16us)
+#else
+VCL_ARRAY_VECTOR(int8_t,   Vec16c)
+VCL_ARRAY_VECTOR(uint8_t,  Vec16uc)
+VCL_ARRAY_VECTOR(int16_t,  Vec8s)
+VCL_ARRAY_VECTOR(uint16_t, Vec8us)
+#endif
+
+#if MAX_VECTOR_SIZE >= 512 && INSTRSET >= 9
+VCL_ARRAY_VECTOR(int32_t,  Vec16i)
+VCL_ARRAY_VECTOR(uint32_t, Vec16ui)
+VCL_ARRAY_VECTOR(int64_t,  Vec8q)
+VCL_ARRAY_VECTOR(uint64_t, Vec8uq)
+VCL_ARRAY_VECTOR(float,    Vec16f)
+VCL_ARRAY_VECTOR(double,   Vec8d)
+#elif MAX_VECTOR_SIZE >= 256 && INSTRSET >= 8
+VCL_ARRAY_VECTOR(int32_t,  Vec8i)
+VCL_ARRAY_VECTOR(uint32_t, Vec8ui)
+VCL_ARRAY_VECTOR(int64_t,  Vec4q)
+VCL_ARRAY_VECTOR(uint64_t, Vec4uq)
+VCL_ARRAY_VECTOR(float,    Vec8f)
+VCL_ARRAY_VECTOR(double,   Vec4d)
+#else
+VCL_ARRAY_VECTOR(int32_t,  Vec4i)
+VCL_ARRAY_VECTOR(uint32_t, Vec4ui)
+VCL_ARRAY_VECTOR(int64_t,  Vec2q)
+VCL_ARRAY_VECTOR(uint64_t, Vec2uq)
+#if MAX_VECTOR_SIZE >= 256 && INSTRSET >= 7
+VCL_ARRAY_VECTOR(float,    Vec8f)
+VCL_ARRAY_VECTOR(double,   Vec4d)
+#else
+VCL_ARRAY_VECTOR(float,    Vec4f)
+VCL_ARRAY_VECTOR(double,   Vec2d)
+#endif
+#endif
+
+// Vector class given explicitly
+template <typename V> struct array_vector_given { typedef V type; };
+
+// The vector class V, or array_vector<T>::type if V is void
+template <typename V, typename T>
+using array_vector_select = typename std::conditional<std::is_void<V>::value,
+    array_vector<T>, array_vector_given<V>>::type::type;
+
+
+/*****************************************************************************
+*
+*          Helper templates for reductions
+*
+*****************************************************************************/
+
+// Set all U accumulators to x
+template <typename A, int ... J>
+static inline void reduce_init(A acc[], A const x, std::integer_sequence<int, J...>) {
+    ((acc[J] = x), ...);
+}
+
+// Return f(acc, x...) where x are the vector blocks of the arrays p at index i
+template <typename V, bool aligned, typename A, typename F, typename ... T>
+static inline A reduce_call_block(A const acc, size_t i, F & f, T const * ... p) {
+    return f(acc, array_load_block<V, aligned>(p, i)...);
+}
+
+// Add the vector blocks i + J*N of the arrays p to accumulator J: acc[J] = f(acc[J], x...)
+template <typename V, bool aligned, typename A, typename F, typename ... T, int ... J>
+static inline void reduce_unrolled(A acc[], size_t i, F & f, std::integer_sequence<int, J...>, T const * ... p) {
+    constexpr size_t N = V::size();
+    ((acc[J] = reduce_call_block<V, aligned>(acc[J], i + J * N, f, p...)), ...);
+}
+
+// Combine accumulator J + S into accumulator J for J < S
+template <typename A, typename F, int ... J>
+static inline void reduce_pairs(A acc[], F & f, std::integer_sequence<int, J...>) {
+    constexpr int S = sizeof...(J);
+    ((acc[J] = f(acc[J], acc[J + S])), ...);
+}
+
+// Combine U accumulators pairwise and return the result
+template <int U, typename A, typename F>
+static inline A reduce_tree(A acc[], F & f) {
+    if constexpr (U > 1) {
+        reduce_pairs(acc, f, std::make_integer_sequence<int, U / 2>());
+        return reduce_tree<U / 2>(acc, f);
+    }
+    else {
+        return acc[0];
+    }
+}
+
+// Accumulate the whole vector blocks of the arrays p from index i with acc = f(acc, x...).
+// Accumulator J gets the blocks J, J+U, J+2U, ... The remaining blocks go to accumulator 0.
+// The blocks are loaded with load_a if aligned is true. Returns the index after the last
+// block done
+template <typename V, int U, bool aligned, typename A, typename F, typename ... T>
+static inline size_t reduce_blocks(A acc[], size_t i, size_t n, F & f, T const * ... p) {
+    constexpr size_t N = V::size();              // vector size
+    for (; i + U * N <= n; i += U * N) {         // unrolled main loop
+        reduce_unrolled<V, aligned>(acc, i, f, std::make_integer_sequence<int, U>(), p...);
+    }
+    for (; i + N <= n; i += N) {                 // remaining whole vectors
+        acc[0] = reduce_call_block<V, aligned>(acc[0], i, f, p...);
+    }
+    return i;
+}
+
+// reduce_blocks with load_a if all the arrays are aligned by the vector size at index i
+template <typename V, int U, typename A, typename F, typename ... T>
+static inline size_t reduce_blocks_aligned(A acc[], size_t i, size_t n, F & f, T const * ... p) {
+    if (array_aligned<V>((p + i)...)) {
+        return reduce_blocks<V, U, true>(acc, i, n, f, p...);
+    }
+    return reduce_blocks<V, U, false>(acc, i, n, f, p...);
+}
+
+// The first of the arrays p
+template <typename T, typename ... TT>
+static inline T const * array_first(T const * p, TT const * ...) {
+    return p;
+}
+
+// Accumulate n elements of the arrays p with acc = f(acc, x...), starting with U accumulators
+// equal to zero. The first elements up to the alignment boundary of the first array and the
+// last partial block are padded with zeros. The accumulators are combined with
+// combine(acc1, acc2)
+template <typename V, int U, typename A, typename F, typename C, typename ... T>
+static inline A reduce_array(size_t n, F f, C combine, T const * ... p) {
+    static_assert(U == 1 || U == 2 || U == 4 || U == 8, "number of accumulators must be 1, 2, 4 or 8");
+    A acc[U];
+    reduce_init(acc, A(0), std::make_integer_sequence<int, U>());
+    size_t head = array_align_head<V>(array_first(p...), n);
+    if (head > 0) {                              // first elements before the alignment boundary
+        acc[0] = f(acc[0], array_load_partial<V>(int(head), p)...);
+    }
+    size_t i = reduce_blocks_aligned<V, U>(acc, head, n, f, p...);
+    if (i < n) {                                 // last partial vector
+        acc[0] = f(acc[0], array_load_partial<V>(int(n - i), p + i)...);
+    }
+    return reduce_tree<U>(acc, combine);
+}
+
+// Accumulator for Kahan summation
+template <typename V>
+struct ReduceKahan {
+    V sum;                                       // sum
+    V comp;                                      // compensation: error of sum with opposite sign
+    ReduceKahan() = default;
+    ReduceKahan(int z) : sum(z), comp(z) {}      // used only for zero
+};
+
+// Add x to Kahan accumulator a
+template <typename V>
+static inline ReduceKahan<V> reduce_kahan_add(ReduceKahan<V> a, V const x) {
+    V y = x - a.comp;
+    V t = a.sum + y;
+    a.comp = (t - a.sum) - y;                    // the part of y that is lost in t
+    a.sum = t;
+    return a;
+}
+
+
+/*****************************************************************************
+*
+*          Reductions
+*
+*****************************************************************************/
+// These functions reduce a whole array to a single value.
+// The vector class can be given as the first template parameter, e.g. reduce_sum<Vec8f>(p, n).
+// The default is array_vector<T>::type. The second template parameter is the number of
+// independent accumulators (1, 2, 4 or 8; default VCL_ARRAY_UNROLL). Multiple accumulators
+// avoid waiting for the latency of each addition. They are combined pairwise at the end.
+// Floating point results may therefore differ slightly from a sequential sum.
+
+// Sum of n elements of array p.
+// Integer elements of 8, 16, and 32 bits are summed with extended precision, and the result
+// is 64 bits. 64-bit integers wrap around on overflow
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline auto reduce_sum(T const * p, size_t n) {
+    typedef array_vector_select<V, T> VV;
+    static_assert(std::is_same<typename vector_traits<VV>::element_type, T>::value, "Wrong vector type for array");
+    auto add = [](auto const a, auto const b) {return a + b;};
+    if constexpr (VV::elementtype() >= 15 || sizeof(T) == 8) {
+        // float, double, or 64-bit integer
+        return horizontal_add(reduce_array<VV, U, VV>(n, add, add, p));
+    }
+    else {
+        typedef decltype(extend_low(VV())) W;    // accumulator with double element size
+        typedef typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type R;
+        auto addx = [](W const a, VV const x) {return a + extend_low(x) + extend_high(x);};
+        if constexpr (sizeof(T) == 4) {
+            return R(horizontal_add(reduce_array<VV, U, W>(n, addx, add, p)));
+        }
+        else {
+            // 8-bit or 16-bit integers. Do the array in chunks so that the sum of the
+            // accumulators cannot overflow, and add each chunk with horizontal_add_x
+            constexpr size_t limit = sizeof(T) == 1 ? 127 : 32767; // max blocks per chunk
+            // elements per chunk, leaving room for the first and last partial blocks
+            constexpr size_t chunk = (limit - 2) / U * U * VV::size();
+            R sum = 0;
+            for (size_t i = 0; i < n; i += chunk) {
+                W s = reduce_array<VV, U, W>(n - i < chunk ? n - i : chunk, addx, add, p + i);
+                if constexpr (sizeof(T) == 1) {
+                    sum += R(horizontal_add_x(extend_low(s) + extend_high(s)));
+                }
+                else {
+                    sum += R(horizontal_add_x(s));
+                }
+            }
+            return sum;
+        }
+    }
+}
+
+// Sum of n elements of float or double array p with Kahan summation, which compensates for
+// the rounding errors. This is slower than reduce_sum, but much more accurate for big arrays.
+// Do not compile with -ffast-math or similar options, because these may remove the compensation
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline T reduce_sum_kahan(T const * p, size_t n) {
+    typedef array_vector_select<V, T> VV;
+    typedef ReduceKahan<VV> K;
+    static_assert(std::is_same<typename vector_traits<VV>::element_type, T>::value, "Wrong vector type for array");
+    static_assert(VV::elementtype() >= 16, "reduce_sum_kahan is for float and double");
+    auto add = [](K const a, VV const x) {return reduce_kahan_add(a, x);};
+    auto combine = [](K const a, K const b) {return reduce_kahan_add(reduce_kahan_add(a, b.sum), VV(0) - b.comp);};
+    K a = reduce_array<VV, U, K>(n, add, combine, p);
+    // add the vector elements with Kahan summation
+    T s[VV::size()], c[VV::size()];
+    a.sum.store(s);
+    a.comp.store(c);
+    T sum = 0, comp = 0;
+    for (int i = 0; i < VV::size(); i++) {
+        T y = s[i] - (c[i] + comp);
+        T t = sum + y;
+        comp = (t - sum) - y;
+        sum = t;
+    }
+    return sum;
+}
+
+// Smallest of n elements of array p. Returns the biggest possible value if n = 0.
+// The result is undefined if the array contains NAN
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline T reduce_min(T const * p, size_t n) {
+    typedef array_vector_select<V, T> VV;
+    static_assert(std::is_same<typename vector_traits<VV>::element_type, T>::value, "Wrong vector type for array");
+    constexpr size_t N = VV::size();
+    if (n < N) {                                 // less than one vector
+        T m = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+        for (size_t i = 0; i < n; i++) {
+            if (p[i] < m) m = p[i];
+        }
+        return m;
+    }
+    auto f = [](VV const a, VV const b) {return min(a, b);};
+    VV acc[U];
+    reduce_init(acc, array_load_block<VV>(p, 0), std::make_integer_sequence<int, U>());
+    // the first block is included already, so the loop can start at the alignment boundary
+    size_t i = reduce_blocks_aligned<VV, U>(acc, array_align_head<VV>(p, n), n, f, p);
+    if (i < n) {                                 // last partial vector overlaps the previous one
+        acc[0] = min(acc[0], array_load_block<VV>(p, n - N));
+    }
+    return horizontal_min(reduce_tree<U>(acc, f));
+}
+
+// Biggest of n elements of array p. Returns the lowest possible value if n = 0.
+// The result is undefined if the array contains NAN
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline T reduce_max(T const * p, size_t n) {
+    typedef array_vector_select<V, T> VV;
+    static_assert(std::is_same<typename vector_traits<VV>::element_type, T>::value, "Wrong vector type for array");
+    constexpr size_t N = VV::size();
+    if (n < N) {                                 // less than one vector
+        T m = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+        for (size_t i = 0; i < n; i++) {
+            if (p[i] > m) m = p[i];
+        }
+        return m;
+    }
+    auto f = [](VV const a, VV const b) {return max(a, b);};
+    VV acc[U];
+    reduce_init(acc, array_load_block<VV>(p, 0), std::make_integer_sequence<int, U>());
+    // the first block is included already, so the loop can start at the alignment boundary
+    size_t i = reduce_blocks_aligned<VV, U>(acc, array_align_head<VV>(p, n), n, f, p);
+    if (i < n) {                                 // last partial vector overlaps the previous one
+        acc[0] = max(acc[0], array_load_block<VV>(p, n - N));
+    }
+    return horizontal_max(reduce_tree<U>(acc, f));
+}
+
+// Dot product: sum of a[i]*b[i] for i = 0 .. n-1.
+// Integers wrap around on overflow
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline T dot(T const * a, T const * b, size_t n) {
+    typedef array_vector_select<V, T> VV;
+    static_assert(std::is_same<typename vector_traits<VV>::element_type, T>::value, "Wrong vector type for array");
+    auto add = [](VV const s, VV const t) {return s + t;};
+    if constexpr (VV::elementtype() >= 16) {
+        auto f = [](VV const s, VV const x, VV const y) {return mul_add(x, y, s);};
+        return horizontal_add(reduce_array<VV, U, VV>(n, f, add, a, b));
+    }
+    else {
+        auto f = [](VV const s, VV const x, VV const y) {return s + x * y;};
+        return horizontal_add(reduce_array<VV, U, VV>(n, f, add, a, b));
+    }
+}
+
+// Sum of squares: sum of p[i]*p[i] for i = 0 .. n-1.
+// Integers wrap around on overflow
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline T sum_squares(T const * p, size_t n) {
+    typedef array_vector_select<V, T> VV;
+    static_assert(std::is_same<typename vector_traits<VV>::element_type, T>::value, "Wrong vector type for array");
+    auto add = [](VV const s, VV const t) {return s + t;};
+    if constexpr (VV::elementtype() >= 16) {
+        auto f = [](VV const s, VV const x) {return mul_add(x, x, s);};
+        return horizontal_add(reduce_array<VV, U, VV>(n, f, add, p));
+    }
+    else {
+        auto f = [](VV const s, VV const x) {return s + x * x;};
+        return horizontal_add(reduce_array<VV, U, VV>(n, f, add, p));
+    }
+}
+
+
+/*****************************************************************************
+*
+*          reduce_minmax_index
+*
+*****************************************************************************/
+
+// Result of reduce_minmax_index
+template <typename T>
+struct MinMaxIndex {
+    T min;                                       // smallest element
+    T max;                                       // biggest element
+    size_t index_min;                            // index of the first occurrence of min
+    size_t index_max;                            // index of the first occurrence of max
+};
+
+// Accumulator for reduce_minmax_index. kmin and kmax are the loop counts where vmin and vmax were found
+template <typename V>
+struct ReduceMinMax {
+    V vmin, vmax;
+    typename vector_traits<V>::int_vector kmin, kmax;
+};
+
+// Update r with element x with index i
+template <typename T>
+static inline void reduce_minmax_element(MinMaxIndex<T> & r, T const x, size_t i) {
+    if (x < r.min || (x == r.min && i < r.index_min)) {
+        r.min = x;  r.index_min = i;
+    }
+    if (x > r.max || (x == r.max && i < r.index_max)) {
+        r.max = x;  r.index_max = i;
+    }
+}
+
+// Update accumulator J with vector block number J of group k, starting at p
+template <typename V, typename VI, int ... J>
+static inline void reduce_minmax_unrolled(ReduceMinMax<V> acc[], typename vector_traits<V>::element_type const * p,
+    VI const k, std::integer_sequence<int, J...>) {
+    constexpr int N = V::size();
+    auto update = [k](ReduceMinMax<V> & a, V const x) {
+        typedef typename vector_traits<VI>::boolean_vector BI;
+        auto lt = x < a.vmin;
+        auto gt = x > a.vmax;
+        a.vmin = select(lt, x, a.vmin);
+        a.kmin = select(BI(lt), k, a.kmin);
+        a.vmax = select(gt, x, a.vmax);
+        a.kmax = select(BI(gt), k, a.kmax);
+    };
+    (update(acc[J], array_load_block<V>(p, J * N)), ...);
+}
+
+// Set accumulator J to vector block J starting at p, found in group 0
+template <typename V, int ... J>
+static inline void reduce_minmax_init(ReduceMinMax<V> acc[], typename vector_traits<V>::element_type const * p,
+    std::integer_sequence<int, J...>) {
+    constexpr int N = V::size();
+    ((acc[J].vmin = acc[J].vmax = array_load_block<V>(p, J * N)), ...);
+    ((acc[J].kmin = acc[J].kmax = typename vector_traits<V>::int_vector(0)), ...);
+}
+
+// Update r with the first occurrences of min and max in the accumulators for the
+// chunk starting at index i
+template <typename T, typename V, int ... J>
+static inline void reduce_minmax_result(MinMaxIndex<T> & r, ReduceMinMax<V> const acc[], size_t i,
+    std::integer_sequence<int, J...>) {
+    typedef typename vector_traits<typename vector_traits<V>::int_vector>::element_type TI;
+    constexpr size_t N = V::size();
+    constexpr size_t G = sizeof...(J) * N;       // elements per group
+    auto update = [&r, i](ReduceMinMax<V> const & a, size_t j) {
+        T vmin[N], vmax[N];
+        TI kmin[N], kmax[N];
+        a.vmin.store(vmin);  a.vmax.store(vmax);
+        a.kmin.store(kmin);  a.kmax.store(kmax);
+        for (size_t e = 0; e < N; e++) {
+            size_t imin = i + size_t(kmin[e]) * G + j * N + e;
+            size_t imax = i + size_t(kmax[e]) * G + j * N + e;
+            if (vmin[e] < r.min || (vmin[e] == r.min && imin < r.index_min)) {
+                r.min = vmin[e];  r.index_min = imin;
+            }
+            if (vmax[e] > r.max || (vmax[e] == r.max && imax < r.index_max)) {
+                r.max = vmax[e];  r.index_max = imax;
+            }
+        }
+    };
+    (update(acc[J], J), ...);
+}
+
+// Smallest and biggest of n elements of array p and the indexes of their first occurrences.
+// Returns zero values and indexes if n = 0. The result is undefined if the array contains NAN
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T>
+static inline MinMaxIndex<T> reduce_minmax_index(T const * p, size_t n) {
+    typedef array_vector_select<V, T> VV;
+    typedef typename vector_traits<VV>::int_vector VI;
+    typedef typename vector_traits<VI>::element_type TI;
+    typedef ReduceMinMax<VV> A;
+    static_assert(std::is_same<typename vector_traits<VV>::element_type, T>::value, "Wrong vector type for array");
+    static_assert(U == 1 || U == 2 || U == 4 || U == 8, "number of accumulators must be 1, 2, 4 or 8");
+    constexpr size_t N = VV::size();             // vector size
+    constexpr size_t G = U * N;                  // elements per group of U vectors
+    constexpr size_t kcount = size_t(std::numeric_limits<TI>::max()) + 1; // max groups per chunk
+    MinMaxIndex<T> r = {T(0), T(0), 0, 0};
+    if (n == 0) return r;
+    r.min = r.max = p[0];
+    size_t i = 0;                                // array index
+    // Do the array in chunks so that the loop counts fit into the elements of VI
+    while (i + G <= n) {
+        size_t count = (n - i) / G;              // number of groups in this chunk
+        if (count > kcount) count = kcount;
+        A acc[U];
+        reduce_minmax_init(acc, p + i, std::make_integer_sequence<int, U>());
+        for (size_t k = 1; k < count; k++) {
+            reduce_minmax_unrolled(acc, p + i + k * G, VI(TI(k)), std::make_integer_sequence<int, U>());
+        }
+        reduce_minmax_result(r, acc, i, std::make_integer_sequence<int, U>());
+        i += count * G;
+    }
+    for (; i < n; i++) {                         // remaining elements
+        reduce_minmax_element(r, p[i], i);
+    }
+    return r;
+}
+
+
+/*****************************************************************************
+*
+*          compress_vec
+*
+*****************************************************************************/
+// Store the elements p[i] for which f gives true contiguously in out, and return the
+// number of elements stored. f takes a vector of type V and returns a boolean vector
+// of the type vector_traits<V>::boolean_vector. out must have space for n elements
+// and must not overlap with p, except that out may be identical to p.
+// The last incomplete block is loaded with load_partial, and the unused elements are
+// not stored
+template <typename V, typename F, typename T>
+static inline size_t compress_vec(T * out, size_t n, F f, T const * p) {
+    static_assert(std::is_same<typename vector_traits<V>::element_type, T>::value, "Wrong vector type for array");
+    constexpr size_t N = V::size();              // vector size
+    size_t i = 0;                                // array index
+    size_t c = 0;                                // number of elements stored
+    for (; i + N <= n; i += N) {
+        V x = array_load_block<V>(p, i);
+        c += compress_store(out + c, x, f(x));
+    }
+    if (i < n) {                                 // last partial vector
+        int r = int(n - i);                      // number of remaining elements
+        V x = array_load_partial<V>(r, p + i);
+        uint64_t m = compress_mask_bits(f(x)) & ((uint64_t(1) << r) - 1);
+        c += compress_store_bits(out + c, to_int_vector(x), m);
+    }
+    return c;
+}
+
+// Count the elements p[i] for which f gives true. f is as for compress_vec
+template <typename V, int U = VCL_ARRAY_UNROLL, typename F, typename T>
+static inline size_t count_vec(size_t n, F f, T const * p) {
+    auto add = [&f](size_t const s, V const x) {return s + size_t(vml_popcnt(compress_mask_bits(f(x))));};
+    auto sum = [](size_t const a, size_t const b) {return a + b;};
+    size_t acc[U];
+    reduce_init(acc, size_t(0), std::make_integer_sequence<int, U>());
+    size_t head = array_align_head<V>(p, n);
+    if (head > 0) {                              // first elements before the alignment boundary
+        uint64_t m = compress_mask_bits(f(array_load_partial<V>(int(head), p))) & ((uint64_t(1) << head) - 1);
+        acc[0] = size_t(vml_popcnt(m));
+    }
+    size_t i = reduce_blocks_aligned<V, U>(acc, head, n, add, p);
+    size_t c = reduce_tree<U>(acc, sum);
+    if (i < n) {                                 // last partial vector
+        int r = int(n - i);                      // number of remaining elements
+        uint64_t m = compress_mask_bits(f(array_load_partial<V>(r, p + i))) & ((uint64_t(1) << r) - 1);
+        c += size_t(vml_popcnt(m));
+    }
+    return c;
+}
+
+
+/*****************************************************************************
+*
+*          Prefix sums
+*
+*****************************************************************************/
+// prefix_sum(p, out, n, init) stores the inclusive prefix sums
+// out[i] = init + p[0] + p[1] + ... + p[i], for i = 0 .. n-1.
+// prefix_sum_exclusive(p, out, n, init) stores the exclusive prefix sums
+// out[i] = init + p[0] + ... + p[i-1]. out[0] = init.
+// Both return init + the sum of all n elements. out may be identical to p.
+// Each vector block is summed with prefix_sum(V), and the sum of the preceding blocks
+// is added. This sum is carried from one block to the next with a single addition,
+// so that the loop is not limited by the latency of the in-vector steps.
+// Integer sums wrap around on overflow. Floating point results may differ slightly
+// from a sequential sum. The vector class is optional, as for reduce_sum
+
+template <typename V, bool exclusive, typename T>
+static inline T prefix_sum_array(T const * p, T * out, size_t n, T init) {
+    static_assert(std::is_same<typename vector_traits<V>::element_type, T>::value, "Wrong vector type for array");
+    constexpr size_t N = V::size();              // vector size
+    V carry(init);                               // sum of all preceding elements, broadcast
+    size_t i = 0;                                // array index
+    for (; i + N <= n; i += N) {
+        V a = array_load_block<V>(p, i);
+        V x = prefix_sum(a);
+        V y = exclusive ? prefix_shift_up(x, std::make_integer_sequence<int, int(N)>()) : x;
+        (y + carry).store(out + i);
+        carry += broadcast_last(x);
+    }
+    if (i < n) {                                 // last partial vector
+        int r = int(n - i);                      // number of remaining elements
+        V x = prefix_sum(array_load_partial<V>(r, p + i));  // zero padding does not change the sums
+        V y = exclusive ? prefix_shift_up(x, std::make_integer_sequence<int, int(N)>()) : x;
+        (y + carry).store_partial(r, out + i);
+        carry += broadcast_last(x);
+    }
+    return carry[0];
+}
+
+// Inclusive prefix sum of array p
+template <typename V = void, typename T>
+static inline T prefix_sum(T const * p, T * out, size_t n, T init = T(0)) {
+    return prefix_sum_array<array_vector_select<V, T>, false>(p, out, n, init);
+}
+
+// Exclusive prefix sum of array p
+template <typename V = void, typename T>
+static inline T prefix_sum_exclusive(T const * p, T * out, size_t n, T init = T(0)) {
+    return prefix_sum_array<array_vector_select<V, T>, true>(p, out, n, init);
+}
+
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_ARRAY_H
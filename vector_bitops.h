@@ -0,0 +1,670 @@
+/****************************  vector_bitops.h   ******************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining bit manipulation functions on each element of integer
+* vectors. These are useful for decoding bit-packed data.
+* This header is optional. It is not included by vectorclass.h.
+*
+* Functions defined here, for all integer vector classes V:
+* a << b, a >>= b, etc.   shift each element of a by the count in the same element
+*                         of b. Counts are unsigned. Counts bigger than the number
+*                         of bits give 0, or the sign bit for signed right shifts
+* rotate_left(a, b)       rotate each element of a left by the count in the same
+*                         element of b, modulo the number of bits
+* popcount(a)             number of 1-bits in each element
+* lzcnt(a)                number of leading zero bits in each element. Gives the
+*                         number of bits in the element if it is zero
+* bit_compress(a, m)      extract the bits of each element of a at the positions
+*                         of the 1-bits in m, and pack them at the low end. Same
+*                         as the pext instruction for each element
+* bit_expand(a, m)        distribute the low bits of each element of a to the
+*                         positions of the 1-bits in m. Same as the pdep instruction
+* reverse_bits(a)         reverse the order of the bits in each element
+*
+* Functions for vectors of bytes, Vec16uc, Vec32uc, Vec64uc:
+* gf2p8_affine<b>(x, m)   affine transformation of each byte in GF(2). Bit i of the
+*                         result is the parity of (byte 7-i of m) AND x, XOR bit i of b.
+*                         m is an 8x8 bit matrix, the same for all bytes
+* gf2p8_mul(a, b)         multiplication in the finite field GF(2^8) with the
+*                         polynomial x^8 + x^4 + x^3 + x + 1, as used in AES
+*
+* The instructions used depend on the element size and the instruction set:
+* Shift:      AVX2 vpsllvd, vpsllvq, vpsrlvd, vpsrlvq, vpsravd
+*             AVX512F 512 bits and AVX512VL: vpsravq
+*             AVX512BW: vpsllvw, vpsrlvw, vpsravw, also used for 8-bit elements
+*             AVX2: 16-bit elements with vpsllvd etc. on even and odd elements
+* Rotate:     AVX512F 512 bits and AVX512VL: vprolvd, vprolvq
+*             AVX512VBMI2: vpshldvw
+* popcount:   AVX512VPOPCNTDQ: vpopcntd, vpopcntq
+*             AVX512BITALG: vpopcntb, vpopcntw
+* lzcnt:      AVX512CD: vplzcntd, vplzcntq, also used for 16-bit elements
+* gf2p8:      GFNI: gf2p8affineqb, gf2p8mulb
+* Otherwise these functions are emulated:
+* A shift by variable counts is a sequence of shifts by 1, 2, 4, ... bits, where
+* each shifted value is selected if the corresponding bit of the count is 1.
+* popcount adds the bits in parallel within each byte, and then the bytes.
+* lzcnt sets all bits below the highest 1-bit and counts the bits.
+* bit_compress and bit_expand use the parallel algorithms in Henry S. Warren:
+* Hacker's Delight, 2nd ed. 2013, section 7-4 and 7-5. These need five steps for
+* 32-bit elements and six steps for 64-bit elements. The time is independent of
+* the instruction set, so it is faster to use the scalar pext and pdep instructions
+* with BMI2 if there are only a few elements.
+* gf2p8_affine adds the columns of the matrix selected by each bit of x.
+*
+* Example:
+* // decode 4-bit fields at different positions in each element
+* Vec8ui packed, position;
+* Vec8ui field = (packed >> position) & 0xF;
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_BITOPS_H
+#define VECTOR_BITOPS_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#if MAX_VECTOR_SIZE < 512
+#error vector_bitops.h requires MAX_VECTOR_SIZE >= 512
+#endif
+
+#include <type_traits>                 // std::enable_if, std::is_integral
+#include <utility>                     // std::integer_sequence
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*          Common templates
+*
+*****************************************************************************/
+
+// Return type V if V is an integer vector class. Used for enabling the templates
+// below for integer vector classes only
+template <typename V, typename T = typename vector_traits<V>::element_type>
+using bitops_enable = typename std::enable_if<std::is_integral<T>::value, V>::type;
+
+// Number of bits in each element of V
+template <typename V>
+constexpr int bitops_element_bits() {
+    return int(sizeof(typename vector_traits<V>::element_type)) * 8;
+}
+
+// Number of bits in vector V
+template <typename V>
+constexpr int bitops_vector_bits() {
+    return V::size() * bitops_element_bits<V>();
+}
+
+// True if V is contained in a single register. False if V is emulated with
+// two vectors of half the size
+template <typename V>
+constexpr bool bitops_native() {
+    constexpr int W = bitops_vector_bits<V>();
+    if constexpr (W == 128) return true;
+    else if constexpr (W == 256) return INSTRSET >= 8;
+    else if constexpr (bitops_element_bits<V>() >= 32) return INSTRSET >= 9;
+    else return INSTRSET >= 10;
+}
+
+// Unsigned vector of the same total size as V with element size E bits
+template <int W, int E>
+struct bitops_uint_vector;
+template <> struct bitops_uint_vector<128, 16> {typedef Vec8us  type;};
+template <> struct bitops_uint_vector<128, 32> {typedef Vec4ui  type;};
+template <> struct bitops_uint_vector<128, 64> {typedef Vec2uq  type;};
+template <> struct bitops_uint_vector<256, 16> {typedef Vec16us type;};
+template <> struct bitops_uint_vector<256, 32> {typedef Vec8ui  type;};
+template <> struct bitops_uint_vector<256, 64> {typedef Vec4uq  type;};
+template <> struct bitops_uint_vector<512, 16> {typedef Vec32us type;};
+template <> struct bitops_uint_vector<512, 32> {typedef Vec16ui type;};
+template <> struct bitops_uint_vector<512, 64> {typedef Vec8uq  type;};
+
+// Unsigned vector of the same total size as V with elements of twice the size
+template <typename V>
+using bitops_wide = typename bitops_uint_vector<bitops_vector_bits<V>(), 2 * bitops_element_bits<V>()>::type;
+
+// Unsigned vector of the same total size as V with 64-bit elements
+template <typename V>
+using bitops_u64 = typename bitops_uint_vector<bitops_vector_bits<V>(), 64>::type;
+
+
+/*****************************************************************************
+*
+*          Shift by variable counts
+*
+*****************************************************************************/
+
+// Shift left a sequence of 1, 2, 4, ... bits, selected by the bits of the counts
+template <typename V>
+static inline V shift_left_serial(V a, V const b) {
+    typedef typename vector_traits<V>::uint_vector U;
+    constexpr int E = bitops_element_bits<V>();
+    U bu = U(b);
+    for (int i = 1; i < E; i <<= 1) {
+        a = select((bu & U(i)) != U(0), a << i, a);
+    }
+    return select(bu < U(E), a, V(0));
+}
+
+// Shift right a sequence of 1, 2, 4, ... bits, selected by the bits of the counts.
+// Arithmetic shift if V is signed
+template <typename V>
+static inline V shift_right_serial(V a, V const b) {
+    typedef typename vector_traits<V>::uint_vector U;
+    constexpr int E = bitops_element_bits<V>();
+    U bu = U(b);
+    V big = std::is_signed<typename vector_traits<V>::element_type>::value ? a >> (E - 1) : V(0);
+    for (int i = 1; i < E; i <<= 1) {
+        a = select((bu & U(i)) != U(0), a >> i, a);
+    }
+    return select(bu < U(E), a, big);
+}
+
+// Forward declarations
+template <typename V> static inline bitops_enable<V> operator << (V const a, V const b);
+template <typename V> static inline bitops_enable<V> operator >> (V const a, V const b);
+
+// Shift left with shifts of elements of twice the size. The even and odd elements
+// are shifted separately
+template <typename V>
+static inline V shift_left_wide(V const a, V const b) {
+    typedef bitops_wide<V> W;
+    constexpr int E = bitops_element_bits<V>();
+    W lomask = W((uint64_t(1) << E) - 1);
+    W aw = W(a), bw = W(b);
+    W lo = (aw << (bw & lomask)) & lomask;
+    W hi = (aw & W(~lomask)) << (bw >> E);
+    return V(lo | hi);
+}
+
+// Shift right with shifts of elements of twice the size
+template <typename V>
+static inline V shift_right_wide(V const a, V const b) {
+    typedef bitops_wide<V> W;
+    typedef typename vector_traits<W>::int_vector WS;
+    constexpr int E = bitops_element_bits<V>();
+    W lomask = W((uint64_t(1) << E) - 1);
+    W aw = W(a), bw = W(b);
+    if constexpr (std::is_signed<typename vector_traits<V>::element_type>::value) {
+        W lo = W(WS(aw << E) >> WS(bw & lomask)) >> E;
+        W hi = W(WS(aw) >> WS(bw >> E)) & W(~lomask);
+        return V(lo | hi);
+    }
+    else {
+        W lo = (aw & lomask) >> (bw & lomask);
+        W hi = (aw >> (bw >> E)) & W(~lomask);
+        return V(lo | hi);
+    }
+}
+
+// Shift each element of a left by the count in the same element of b
+template <typename V>
+static inline bitops_enable<V> operator << (V const a, V const b) {
+    constexpr int E = bitops_element_bits<V>();
+#if INSTRSET >= 8
+    constexpr int W = bitops_vector_bits<V>();
+#endif
+    if constexpr (!bitops_native<V>()) {
+        return V(a.get_low() << b.get_low(), a.get_high() << b.get_high());
+    }
+    else if constexpr (E >= 32) {
+#if INSTRSET >= 8  // AVX2
+        if constexpr (W == 128 && E == 32) return _mm_sllv_epi32(a, b);
+        if constexpr (W == 128 && E == 64) return _mm_sllv_epi64(a, b);
+        if constexpr (W == 256 && E == 32) return _mm256_sllv_epi32(a, b);
+        if constexpr (W == 256 && E == 64) return _mm256_sllv_epi64(a, b);
+#if INSTRSET >= 9  // AVX512F
+        if constexpr (W == 512 && E == 32) return _mm512_sllv_epi32(a, b);
+        if constexpr (W == 512 && E == 64) return _mm512_sllv_epi64(a, b);
+#endif
+#else
+        return shift_left_serial(a, b);
+#endif
+    }
+    else if constexpr (E == 16) {
+#if INSTRSET >= 10  // AVX512BW
+        if constexpr (W == 128) return _mm_sllv_epi16(a, b);
+        if constexpr (W == 256) return _mm256_sllv_epi16(a, b);
+        if constexpr (W == 512) return _mm512_sllv_epi16(a, b);
+#elif INSTRSET >= 8  // AVX2
+        return shift_left_wide(a, b);
+#else
+        return shift_left_serial(a, b);
+#endif
+    }
+    else {  // E == 8
+#if INSTRSET >= 10  // AVX512BW
+        return shift_left_wide(a, b);
+#else
+        return shift_left_serial(a, b);
+#endif
+    }
+}
+
+// Shift each element of a right by the count in the same element of b.
+// Arithmetic shift for signed elements, logical shift for unsigned elements
+template <typename V>
+static inline bitops_enable<V> operator >> (V const a, V const b) {
+    constexpr int E = bitops_element_bits<V>();
+    constexpr int W = bitops_vector_bits<V>();
+    constexpr bool S = std::is_signed<typename vector_traits<V>::element_type>::value;
+    if constexpr (!bitops_native<V>()) {
+        return V(a.get_low() >> b.get_low(), a.get_high() >> b.get_high());
+    }
+    else if constexpr (E == 32 || (E == 64 && !S)) {
+#if INSTRSET >= 8  // AVX2
+        if constexpr (W == 128 && E == 32) return S ? _mm_srav_epi32(a, b) : _mm_srlv_epi32(a, b);
+        if constexpr (W == 128 && E == 64) return _mm_srlv_epi64(a, b);
+        if constexpr (W == 256 && E == 32) return S ? _mm256_srav_epi32(a, b) : _mm256_srlv_epi32(a, b);
+        if constexpr (W == 256 && E == 64) return _mm256_srlv_epi64(a, b);
+#if INSTRSET >= 9  // AVX512F
+        if constexpr (W == 512 && E == 32) return S ? _mm512_srav_epi32(a, b) : _mm512_srlv_epi32(a, b);
+        if constexpr (W == 512 && E == 64) return _mm512_srlv_epi64(a, b);
+#endif
+#else
+        return shift_right_serial(a, b);
+#endif
+    }
+    else if constexpr (E == 64) {  // signed 64 bit
+#if INSTRSET >= 10  // AVX512VL
+        if constexpr (W == 128) return _mm_srav_epi64(a, b);
+        if constexpr (W == 256) return _mm256_srav_epi64(a, b);
+#endif
+#if INSTRSET >= 9  // AVX512F
+        if constexpr (W == 512) return _mm512_srav_epi64(a, b);
+#endif
+#if INSTRSET < 10
+        if constexpr (W < 512) return shift_right_serial(a, b);
+#endif
+    }
+    else if constexpr (E == 16) {
+#if INSTRSET >= 10  // AVX512BW
+        if constexpr (W == 128) return S ? _mm_srav_epi16(a, b) : _mm_srlv_epi16(a, b);
+        if constexpr (W == 256) return S ? _mm256_srav_epi16(a, b) : _mm256_srlv_epi16(a, b);
+        if constexpr (W == 512) return S ? _mm512_srav_epi16(a, b) : _mm512_srlv_epi16(a, b);
+#elif INSTRSET >= 8  // AVX2
+        return shift_right_wide(a, b);
+#else
+        return shift_right_serial(a, b);
+#endif
+    }
+    else {  // E == 8
+#if INSTRSET >= 10  // AVX512BW
+        return shift_right_wide(a, b);
+#else
+        return shift_right_serial(a, b);
+#endif
+    }
+}
+
+// vector operator <<= : shift left by variable counts
+template <typename V>
+static inline bitops_enable<V> & operator <<= (V & a, V const b) {
+    a = a << b;
+    return a;
+}
+
+// vector operator >>= : shift right by variable counts
+template <typename V>
+static inline bitops_enable<V> & operator >>= (V & a, V const b) {
+    a = a >> b;
+    return a;
+}
+
+// Rotate each element of a left by the count in the same element of b, modulo
+// the number of bits
+template <typename V>
+static inline bitops_enable<V> rotate_left(V const a, V const b) {
+    typedef typename vector_traits<V>::uint_vector U;
+    constexpr int E = bitops_element_bits<V>();
+#if INSTRSET >= 9
+    constexpr int W = bitops_vector_bits<V>();
+#endif
+    if constexpr (!bitops_native<V>()) {
+        return V(rotate_left(a.get_low(), b.get_low()), rotate_left(a.get_high(), b.get_high()));
+    }
+    else {
+#if INSTRSET >= 9  // AVX512F
+        if constexpr (W == 512 && E == 32) return _mm512_rolv_epi32(a, b);
+        if constexpr (W == 512 && E == 64) return _mm512_rolv_epi64(a, b);
+#endif
+#if INSTRSET >= 10  // AVX512VL
+        if constexpr (W == 128 && E == 32) return _mm_rolv_epi32(a, b);
+        if constexpr (W == 128 && E == 64) return _mm_rolv_epi64(a, b);
+        if constexpr (W == 256 && E == 32) return _mm256_rolv_epi32(a, b);
+        if constexpr (W == 256 && E == 64) return _mm256_rolv_epi64(a, b);
+#if defined (__AVX512VBMI2__)
+        if constexpr (W == 128 && E == 16) return _mm_shldv_epi16(a, a, b);
+        if constexpr (W == 256 && E == 16) return _mm256_shldv_epi16(a, a, b);
+        if constexpr (W == 512 && E == 16) return _mm512_shldv_epi16(a, a, b);
+#endif
+#endif
+        U ua = U(a);
+        U c = U(b) & U(E - 1);
+        return V((ua << c) | (ua >> ((U(E) - c) & U(E - 1))));
+    }
+}
+
+
+/*****************************************************************************
+*
+*          Bit counting
+*
+*****************************************************************************/
+
+// Count bits in parallel in each byte, then add the counts of the bytes in each element
+template <typename V>
+static inline V popcount_parallel(V const a) {
+    typedef bitops_u64<V> Q;
+    constexpr int E = bitops_element_bits<V>();
+    Q x = Q(a);
+    x = x - ((x >> 1) & Q(0x5555555555555555u));
+    x = (x & Q(0x3333333333333333u)) + ((x >> 2) & Q(0x3333333333333333u));
+    x = (x + (x >> 4)) & Q(0x0F0F0F0F0F0F0F0Fu);           // count in each byte
+    if constexpr (E >= 16) x = x + (x >> 8);
+    if constexpr (E >= 32) x = x + (x >> 16);
+    if constexpr (E >= 64) x = x + (x >> 32);
+    if constexpr (E == 16) x &= Q(0x00FF00FF00FF00FFu);
+    if constexpr (E == 32) x &= Q(0x000000FF000000FFu);
+    if constexpr (E == 64) x &= Q(0x00000000000000FFu);
+    return V(x);
+}
+
+// Number of 1-bits in each element
+template <typename V>
+static inline bitops_enable<V> popcount(V const a) {
+#if defined (__AVX512VPOPCNTDQ__) || (defined (__AVX512BITALG__) && INSTRSET >= 10)
+    constexpr int E = bitops_element_bits<V>();
+    constexpr int W = bitops_vector_bits<V>();
+#endif
+    if constexpr (!bitops_native<V>()) {
+        return V(popcount(a.get_low()), popcount(a.get_high()));
+    }
+    else {
+#if defined (__AVX512VPOPCNTDQ__)
+#if INSTRSET >= 9  // AVX512F
+        if constexpr (W == 512 && E == 32) return _mm512_popcnt_epi32(a);
+        if constexpr (W == 512 && E == 64) return _mm512_popcnt_epi64(a);
+#endif
+#if INSTRSET >= 10  // AVX512VL
+        if constexpr (W == 128 && E == 32) return _mm_popcnt_epi32(a);
+        if constexpr (W == 128 && E == 64) return _mm_popcnt_epi64(a);
+        if constexpr (W == 256 && E == 32) return _mm256_popcnt_epi32(a);
+        if constexpr (W == 256 && E == 64) return _mm256_popcnt_epi64(a);
+#endif
+#endif
+#if defined (__AVX512BITALG__) && INSTRSET >= 10
+        if constexpr (W == 128 && E == 8)  return _mm_popcnt_epi8(a);
+        if constexpr (W == 128 && E == 16) return _mm_popcnt_epi16(a);
+        if constexpr (W == 256 && E == 8)  return _mm256_popcnt_epi8(a);
+        if constexpr (W == 256 && E == 16) return _mm256_popcnt_epi16(a);
+        if constexpr (W == 512 && E == 8)  return _mm512_popcnt_epi8(a);
+        if constexpr (W == 512 && E == 16) return _mm512_popcnt_epi16(a);
+#endif
+        return popcount_parallel(a);
+    }
+}
+
+// Number of leading zero bits in each element. Gives the number of bits in
+// the element if the element is zero
+template <typename V>
+static inline bitops_enable<V> lzcnt(V const a) {
+    typedef typename vector_traits<V>::uint_vector U;
+    constexpr int E = bitops_element_bits<V>();
+#if defined (__AVX512CD__)
+    constexpr int W = bitops_vector_bits<V>();
+#endif
+    if constexpr (!bitops_native<V>()) {
+        return V(lzcnt(a.get_low()), lzcnt(a.get_high()));
+    }
+    else {
+#if defined (__AVX512CD__)
+#if INSTRSET >= 9  // AVX512F
+        if constexpr (W == 512 && E == 32) return _mm512_lzcnt_epi32(a);
+        if constexpr (W == 512 && E == 64) return _mm512_lzcnt_epi64(a);
+#endif
+#if INSTRSET >= 10  // AVX512VL
+        if constexpr (W == 128 && E == 32) return _mm_lzcnt_epi32(a);
+        if constexpr (W == 128 && E == 64) return _mm_lzcnt_epi64(a);
+        if constexpr (W == 256 && E == 32) return _mm256_lzcnt_epi32(a);
+        if constexpr (W == 256 && E == 64) return _mm256_lzcnt_epi64(a);
+        if constexpr (E == 16) {
+            // count in 32-bit elements. Insert a 1-bit to stop the count at 16 bits
+            typedef bitops_wide<V> W32;
+            W32 x = W32(a);
+            W32 lo = lzcnt(W32((x << 16) | W32(0x8000)));
+            W32 hi = lzcnt(W32(x | W32(0xFFFF))) << 16;
+            return V(lo | hi);
+        }
+#endif
+#endif
+        // set all bits below the highest 1-bit
+        U x = U(a);
+        for (int i = 1; i < E; i <<= 1) x |= x >> i;
+        return V(U(E) - popcount(x));
+    }
+}
+
+
+/*****************************************************************************
+*
+*          Bit compress and expand
+*
+*****************************************************************************/
+
+// Parallel suffix XOR of each element. Bit i of the result is the XOR of
+// bits 0 - i of x
+template <typename U>
+static inline U bitops_suffix_xor(U x) {
+    constexpr int E = bitops_element_bits<U>();
+    for (int j = 1; j < E; j <<= 1) x ^= x << j;
+    return x;
+}
+
+// Extract the bits of each element of a at the positions of the 1-bits in the
+// same element of m, and pack them at the low end of the element.
+// Hacker's Delight section 7-4
+template <typename V>
+static inline bitops_enable<V> bit_compress(V const a, V const m) {
+    typedef typename vector_traits<V>::uint_vector U;
+    constexpr int E = bitops_element_bits<V>();
+    U mm = U(m);
+    U x = U(a) & mm;                             // remove unused bits
+    U mk = U(~mm) << 1;                          // count 0-bits to the right
+    for (int i = 0; (1 << i) < E; i++) {
+        U mp = bitops_suffix_xor(mk);            // bits that move 2^i positions
+        U mv = mp & mm;
+        mm = (mm ^ mv) | (mv >> (1 << i));       // compress m
+        U t = x & mv;
+        x = (x ^ t) | (t >> (1 << i));           // compress x
+        mk &= U(~mp);
+    }
+    return V(x);
+}
+
+// Distribute the low bits of each element of a to the positions of the 1-bits
+// in the same element of m. Hacker's Delight section 7-5
+template <typename V>
+static inline bitops_enable<V> bit_expand(V const a, V const m) {
+    typedef typename vector_traits<V>::uint_vector U;
+    constexpr int E = bitops_element_bits<V>();
+    constexpr int L = E == 8 ? 3 : E == 16 ? 4 : E == 32 ? 5 : 6;  // log2(E)
+    U m0 = U(m), mm = m0;
+    U x = U(a);
+    U mk = U(~mm) << 1;
+    U mv[L];                                     // bits that move in each step
+    for (int i = 0; i < L; i++) {                // find the moves as in bit_compress
+        U mp = bitops_suffix_xor(mk);
+        mv[i] = mp & mm;
+        mm = (mm ^ mv[i]) | (mv[i] >> (1 << i));
+        mk &= U(~mp);
+    }
+    for (int i = L - 1; i >= 0; i--) {           // do the moves in reverse order
+        U t = x << (1 << i);
+        x = (x & U(~mv[i])) | (t & mv[i]);
+    }
+    return V(x & m0);
+}
+
+
+/*****************************************************************************
+*
+*          Bit reversal and GF(2^8) arithmetic
+*
+*****************************************************************************/
+
+// Emulate gf2p8_affine by adding the columns of m selected by the bits of x
+template <uint8_t b, typename V>
+static inline V gf2p8_affine_emulated(V const x, uint64_t m) {
+    V r(b);
+    for (int j = 0; j < 8; j++) {
+        uint8_t column = 0;                      // bit j of each row
+        for (int i = 0; i < 8; i++) column |= uint8_t(((m >> ((7 - i) * 8 + j)) & 1) << i);
+        r ^= select((x & uint8_t(1 << j)) != uint8_t(0), V(column), V(0));
+    }
+    return r;
+}
+
+// Affine transformation of each byte of x in GF(2): r = m * x + b.
+// Bit i of r is the parity of (byte 7-i of m) AND x, XOR bit i of b
+template <uint8_t b>
+static inline Vec16uc gf2p8_affine(Vec16uc const x, uint64_t m) {
+#if defined (__GFNI__)
+    return _mm_gf2p8affine_epi64_epi8(x, _mm_set1_epi64x((int64_t)m), b);
+#else
+    return gf2p8_affine_emulated<b>(x, m);
+#endif
+}
+
+template <uint8_t b>
+static inline Vec32uc gf2p8_affine(Vec32uc const x, uint64_t m) {
+#if INSTRSET >= 8 && defined (__GFNI__)
+    return _mm256_gf2p8affine_epi64_epi8(x, _mm256_set1_epi64x((int64_t)m), b);
+#elif INSTRSET >= 8
+    return gf2p8_affine_emulated<b>(x, m);
+#else
+    return Vec32uc(gf2p8_affine<b>(x.get_low(), m), gf2p8_affine<b>(x.get_high(), m));
+#endif
+}
+
+template <uint8_t b>
+static inline Vec64uc gf2p8_affine(Vec64uc const x, uint64_t m) {
+#if INSTRSET >= 10 && defined (__GFNI__)
+    return _mm512_gf2p8affine_epi64_epi8(x, _mm512_set1_epi64((int64_t)m), b);
+#elif INSTRSET >= 10
+    return gf2p8_affine_emulated<b>(x, m);
+#else
+    return Vec64uc(gf2p8_affine<b>(x.get_low(), m), gf2p8_affine<b>(x.get_high(), m));
+#endif
+}
+
+// Emulate gf2p8_mul by shift and add
+template <typename V>
+static inline V gf2p8_mul_emulated(V a, V b) {
+    V r(0);
+    for (int i = 0; i < 8; i++) {
+        r ^= select((b & uint8_t(1)) != uint8_t(0), a, V(0));
+        a = (a << 1) ^ select(a > uint8_t(0x7F), V(0x1B), V(0));   // reduce by the polynomial
+        b = b >> 1;
+    }
+    return r;
+}
+
+// Multiply each byte in the finite field GF(2^8) with the polynomial 0x11B
+static inline Vec16uc gf2p8_mul(Vec16uc const a, Vec16uc const b) {
+#if defined (__GFNI__)
+    return _mm_gf2p8mul_epi8(a, b);
+#else
+    return gf2p8_mul_emulated(a, b);
+#endif
+}
+
+static inline Vec32uc gf2p8_mul(Vec32uc const a, Vec32uc const b) {
+#if INSTRSET >= 8 && defined (__GFNI__)
+    return _mm256_gf2p8mul_epi8(a, b);
+#elif INSTRSET >= 8
+    return gf2p8_mul_emulated(a, b);
+#else
+    return Vec32uc(gf2p8_mul(a.get_low(), b.get_low()), gf2p8_mul(a.get_high(), b.get_high()));
+#endif
+}
+
+static inline Vec64uc gf2p8_mul(Vec64uc const a, Vec64uc const b) {
+#if INSTRSET >= 10 && defined (__GFNI__)
+    return _mm512_gf2p8mul_epi8(a, b);
+#elif INSTRSET >= 10
+    return gf2p8_mul_emulated(a, b);
+#else
+    return Vec64uc(gf2p8_mul(a.get_low(), b.get_low()), gf2p8_mul(a.get_high(), b.get_high()));
+#endif
+}
+
+// Reverse the bits in each element of E bits by swapping bits, pairs, nibbles,
+// etc. in 64-bit elements. The bytes are not swapped if bytes_only is true
+template <int E, bool bytes_only, typename Q>
+static inline Q reverse_bits_parallel(Q x) {
+    const uint64_t masks[6] = {0x5555555555555555u, 0x3333333333333333u, 0x0F0F0F0F0F0F0F0Fu,
+        0x00FF00FF00FF00FFu, 0x0000FFFF0000FFFFu, 0x00000000FFFFFFFFu};
+    for (int i = 0; (2 << i) <= (bytes_only ? 8 : E); i++) {
+        Q m(masks[i]);
+        x = ((x >> (1 << i)) & m) | ((x & m) << (1 << i));
+    }
+    return x;
+}
+
+// Reverse the order of the bytes in each element of the byte vector a with
+// elements of B bytes
+template <int B, typename V, int ... I>
+static inline V reverse_bytes_in_elements(V const a, std::integer_sequence<int, I...>) {
+    return permute_n<(I ^ (B - 1))...>(a);
+}
+
+// Reverse the order of the bits in each element
+template <typename V>
+static inline bitops_enable<V> reverse_bits(V const a) {
+    constexpr int E = bitops_element_bits<V>();
+    constexpr int W = bitops_vector_bits<V>();
+    typedef bitops_u64<V> Q;
+    if constexpr (!bitops_native<V>()) {
+        return V(reverse_bits(a.get_low()), reverse_bits(a.get_high()));
+    }
+    else if constexpr (W == 512 && INSTRSET < 10) {
+        // vector of bytes not available
+        return V(reverse_bits_parallel<E, false>(Q(a)));
+    }
+    else {
+        // reverse the bits in each byte, then permute the bytes
+        typedef typename std::conditional<W == 128, Vec16uc,
+            typename std::conditional<W == 256, Vec32uc, Vec64uc>::type>::type B;
+#if defined (__GFNI__)
+        B x = gf2p8_affine<0>(B(a), 0x8040201008040201u);
+#else
+        B x = B(reverse_bits_parallel<E, true>(Q(a)));
+#endif
+        if constexpr (E > 8) {
+            x = reverse_bytes_in_elements<E / 8>(x, std::make_integer_sequence<int, B::size()>());
+        }
+        return V(x);
+    }
+}
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_BITOPS_H
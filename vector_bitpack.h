@@ -0,0 +1,433 @@
+/****************************  vector_bitpack.h   *****************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining functions for compression of arrays of 32-bit integers:
+* bit packing with frame of reference, delta coding, zigzag coding, and
+* Stream VByte variable length coding.
+* This header is optional. It is not included by vectorclass.h.
+*
+* Functions defined here:
+* bitpack<bits>(in, out, n, base)       pack n values of bits bits each, after
+*                                       subtracting base. Returns the number of
+*                                       bytes written = bitpack_size(bits, n)
+* bitunpack<bits>(in, out, n, base)     unpack n values and add base. Returns the
+*                                       number of bytes read
+* bitpack(bits, in, out, n, base)       same, with bits determined at runtime
+* bitunpack(bits, in, out, n, base)
+* bitpack_size(bits, n)                 number of bytes for n packed values
+* bitpack_bits(in, n, base)             number of bits needed for packing the
+*                                       values minus base
+* delta_encode(in, out, n, prev)        out[i] = in[i] - in[i-1], with in[-1] = prev
+* delta_decode(in, out, n, prev)        inverse of delta_encode (prefix_sum)
+* zigzag_encode(x), zigzag_decode(x)    map signed integers to unsigned so that
+*                                       small negative numbers become small:
+*                                       0, -1, 1, -2, 2 ... becomes 0, 1, 2, 3, 4 ...
+*                                       Defined for vectors and arrays
+* streamvbyte_encode(in, n, out)        variable length coding of n values.
+*                                       Returns the number of bytes written
+* streamvbyte_decode(in, size, out, n)  decode n values from size bytes.
+*                                       Returns the number of bytes read
+* streamvbyte_max_size(n)               maximum size of n encoded values
+*
+* The packed format of bitpack is the same for all instruction sets. It consists
+* of blocks of 256 values. Each block has 8 interleaved lanes of 32 values each,
+* like the SIMD-BP128 format of Lemire and Boytsov, but with 8 lanes rather than 4.
+* Value number i of the block goes to lane i % 8. Each lane packs its 32 values of
+* bits bits into bits 32-bit words, starting with the low bits of the first word.
+* Word j of the block is stored at bytes 32*j + 4*lane. A block takes 32*bits
+* bytes. The last block is padded with values equal to base.
+*
+* The bit width is a template parameter, so that all shift counts are compile-time
+* constants and each bit width has its own unrolled kernel. A block is unpacked
+* with one vector load per word, one vector store per 8 values, and a shift, an
+* AND and an OR at most per 8 values. The functions use Vec8ui also when AVX512
+* is available, because the speed is limited by memory access rather than by the
+* vector size. bitpack(bits, ...) with a runtime bit width calls the template
+* through a table of function pointers.
+*
+* Stream VByte (Lemire, Kurz and Rupp 2018) stores the values in 1 - 4 bytes each.
+* A control byte with 2 bits for each of 4 values gives the lengths. All control
+* bytes are stored first, followed by the data bytes. Encoding and decoding use
+* pshufb (_mm_shuffle_epi8) with tables of 256 shuffle masks, where an index of -1
+* gives a zero byte. This requires SSSE3. Other instruction sets use scalar code.
+*
+* Example:
+* // compress a sorted column
+* uint32_t column[n], deltas[n], decoded[n];
+* delta_encode(column, deltas, n);
+* int bits = bitpack_bits(deltas, n);
+* uint8_t * packed = new uint8_t[bitpack_size(bits, n)];
+* bitpack(bits, deltas, packed, n);
+* // decompress
+* bitunpack(bits, packed, decoded, n);
+* delta_decode(decoded, decoded, n);
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_BITPACK_H
+#define VECTOR_BITPACK_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include "vector_array.h"              // prefix sums of arrays
+#include "vector_bitops.h"             // shifts by variable counts
+#include <stddef.h>                    // define size_t
+#include <string.h>                    // memcpy
+#include <utility>                     // std::integer_sequence
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*          Bit packing
+*
+*****************************************************************************/
+
+// Number of bytes for n values packed with bits bits each
+constexpr size_t bitpack_size(int bits, size_t n) {
+    return (n + 255) / 256 * 32 * (size_t)bits;
+}
+
+// Parameters of value s in each lane of a block with bits bits per value
+template <int bits, int s>
+struct Bitpack_position {
+    static constexpr int word  = s * bits / 32;            // word containing the first bit
+    static constexpr int shift = s * bits % 32;            // position of the first bit in word
+    static constexpr bool straddle = shift + bits > 32;    // value continues in the next word
+    static constexpr bool last = shift + bits >= 32;       // value ends at the end of word or beyond
+};
+
+// Mask for values of bits bits
+template <int bits>
+constexpr uint32_t bitpack_mask() {
+    return bits >= 32 ? 0xFFFFFFFFu : (uint32_t(1) << bits) - 1;
+}
+
+// Unpack value s of each lane. cur contains the word where the value begins.
+// The next word is loaded into cur when the value reaches the end of cur
+template <int bits, int s>
+static inline void bitunpack_step(uint8_t const * in, Vec8ui & cur, uint32_t * out, Vec8ui const base) {
+    typedef Bitpack_position<bits, s> P;
+    Vec8ui x = cur >> P::shift;
+    if constexpr (P::last && P::word + 1 < bits) {
+        Vec8ui next = Vec8ui().load(in + 32 * (P::word + 1));
+        if constexpr (P::straddle) x |= next << (32 - P::shift);
+        cur = next;
+    }
+    if constexpr (bits < 32) x &= Vec8ui(bitpack_mask<bits>());
+    (x + base).store(out + 8 * s);
+}
+
+// Pack value s of each lane into cur. cur is stored when it is full
+template <int bits, int s>
+static inline void bitpack_step(uint32_t const * in, Vec8ui & cur, uint8_t * out, Vec8ui const base) {
+    typedef Bitpack_position<bits, s> P;
+    Vec8ui x = Vec8ui().load(in + 8 * s) - base;
+    if constexpr (bits < 32) x &= Vec8ui(bitpack_mask<bits>());
+    if constexpr (P::shift == 0) cur = x;
+    else cur |= x << P::shift;
+    if constexpr (P::last) {
+        cur.store(out + 32 * P::word);
+        if constexpr (P::straddle) cur = x >> (32 - P::shift);
+    }
+}
+
+// Unpack a block of 256 values
+template <int bits, int ... S>
+static inline void bitunpack_block(uint8_t const * in, uint32_t * out, Vec8ui const base, std::integer_sequence<int, S...>) {
+    Vec8ui cur = Vec8ui().load(in);
+    (bitunpack_step<bits, S>(in, cur, out, base), ...);
+}
+
+// Pack a block of 256 values
+template <int bits, int ... S>
+static inline void bitpack_block(uint32_t const * in, uint8_t * out, Vec8ui const base, std::integer_sequence<int, S...>) {
+    Vec8ui cur(0);
+    (bitpack_step<bits, S>(in, cur, out, base), ...);
+}
+
+// Pack n values of bits bits each from in to out, after subtracting base.
+// The values minus base must be less than 2^bits. Higher bits are ignored.
+// Returns the number of bytes written, which is bitpack_size(bits, n)
+template <int bits>
+static inline size_t bitpack(uint32_t const * in, uint8_t * out, size_t n, uint32_t base = 0) {
+    static_assert(bits >= 0 && bits <= 32, "bits must be 0 - 32");
+    if constexpr (bits == 0) {
+        return 0;
+    }
+    else {
+        auto seq = std::make_integer_sequence<int, 32>();
+        size_t i = 0;
+        for (; i + 256 <= n; i += 256) {
+            bitpack_block<bits>(in + i, out, Vec8ui(base), seq);
+            out += 32 * bits;
+        }
+        if (i < n) {                             // last partial block. Pad with base
+            uint32_t buffer[256];
+            for (int j = 0; j < 256; j++) buffer[j] = i + j < n ? in[i + j] : base;
+            bitpack_block<bits>(buffer, out, Vec8ui(base), seq);
+        }
+        return bitpack_size(bits, n);
+    }
+}
+
+// Unpack n values of bits bits each from in to out, and add base.
+// Returns the number of bytes read, which is bitpack_size(bits, n)
+template <int bits>
+static inline size_t bitunpack(uint8_t const * in, uint32_t * out, size_t n, uint32_t base = 0) {
+    static_assert(bits >= 0 && bits <= 32, "bits must be 0 - 32");
+    if constexpr (bits == 0) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) Vec8ui(base).store(out + i);
+        for (; i < n; i++) out[i] = base;
+        return 0;
+    }
+    else {
+        auto seq = std::make_integer_sequence<int, 32>();
+        size_t i = 0;
+        for (; i + 256 <= n; i += 256) {
+            bitunpack_block<bits>(in, out + i, Vec8ui(base), seq);
+            in += 32 * bits;
+        }
+        if (i < n) {                             // last partial block
+            uint32_t buffer[256];
+            bitunpack_block<bits>(in, buffer, Vec8ui(base), seq);
+            memcpy(out + i, buffer, (n - i) * sizeof(uint32_t));
+        }
+        return bitpack_size(bits, n);
+    }
+}
+
+// Tables of bitpack and bitunpack for all bit widths
+template <int ... B>
+static inline size_t bitpack_dispatch(int bits, uint32_t const * in, uint8_t * out, size_t n, uint32_t base, std::integer_sequence<int, B...>) {
+    static size_t (* const table[])(uint32_t const *, uint8_t *, size_t, uint32_t) = {&bitpack<B>...};
+    return table[bits](in, out, n, base);
+}
+
+template <int ... B>
+static inline size_t bitunpack_dispatch(int bits, uint8_t const * in, uint32_t * out, size_t n, uint32_t base, std::integer_sequence<int, B...>) {
+    static size_t (* const table[])(uint8_t const *, uint32_t *, size_t, uint32_t) = {&bitunpack<B>...};
+    return table[bits](in, out, n, base);
+}
+
+// bitpack with the bit width determined at runtime. bits must be 0 - 32
+static inline size_t bitpack(int bits, uint32_t const * in, uint8_t * out, size_t n, uint32_t base = 0) {
+    return bitpack_dispatch(bits, in, out, n, base, std::make_integer_sequence<int, 33>());
+}
+
+// bitunpack with the bit width determined at runtime. bits must be 0 - 32
+static inline size_t bitunpack(int bits, uint8_t const * in, uint32_t * out, size_t n, uint32_t base = 0) {
+    return bitunpack_dispatch(bits, in, out, n, base, std::make_integer_sequence<int, 33>());
+}
+
+// Number of bits needed for packing in[0..n-1] minus base
+static inline int bitpack_bits(uint32_t const * in, size_t n, uint32_t base = 0) {
+    Vec8ui acc(0);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) acc |= Vec8ui().load(in + i) - base;
+    uint32_t a[8];
+    acc.store(a);
+    uint32_t m = a[0] | a[1] | a[2] | a[3] | a[4] | a[5] | a[6] | a[7];
+    for (; i < n; i++) m |= in[i] - base;
+    return m == 0 ? 0 : int(bit_scan_reverse(m)) + 1;
+}
+
+
+/*****************************************************************************
+*
+*          Delta and zigzag coding
+*
+*****************************************************************************/
+
+// Element N-1 of b followed by elements 0 .. N-2 of a
+template <typename V, int ... I>
+static inline V delta_previous(V const a, V const b, std::integer_sequence<int, I...>) {
+    constexpr int N = V::size();
+    return blend_n<(I == 0 ? 2 * N - 1 : I - 1)...>(a, b);
+}
+
+// out[i] = in[i] - in[i-1], with in[-1] = prev. in and out may be the same
+template <typename VV = void>
+static inline void delta_encode(uint32_t const * in, uint32_t * out, size_t n, uint32_t prev = 0) {
+    typedef array_vector_select<VV, uint32_t> V;
+    constexpr int N = V::size();
+    auto seq = std::make_integer_sequence<int, N>();
+    V last(prev);
+    size_t i = 0;
+    for (; i + N <= n; i += N) {
+        V x = V().load(in + i);
+        (x - delta_previous(x, last, seq)).store(out + i);
+        last = x;
+    }
+    if (i < n) {
+        V x;
+        x.load_partial(int(n - i), in + i);
+        (x - delta_previous(x, last, seq)).store_partial(int(n - i), out + i);
+    }
+}
+
+// Inverse of delta_encode: out[i] = prev + in[0] + ... + in[i]. in and out may be the same
+template <typename V = void>
+static inline void delta_decode(uint32_t const * in, uint32_t * out, size_t n, uint32_t prev = 0) {
+    prefix_sum<V>(in, out, n, prev);
+}
+
+// Zigzag encoding of signed integers: 0, -1, 1, -2, 2 ... becomes 0, 1, 2, 3, 4 ...
+template <typename V>
+static inline typename vector_traits<V>::uint_vector zigzag_encode(V const x) {
+    typedef typename vector_traits<V>::uint_vector U;
+    constexpr int E = int(sizeof(typename vector_traits<V>::element_type)) * 8;
+    return (U(x) << 1) ^ U(x >> (E - 1));
+}
+
+// Inverse of zigzag_encode
+template <typename U>
+static inline typename vector_traits<U>::int_vector zigzag_decode(U const x) {
+    typedef typename vector_traits<U>::int_vector V;
+    return V((x >> 1) ^ U(-V(x & 1)));
+}
+
+// Zigzag encoding of an array
+static inline void zigzag_encode(int32_t const * in, uint32_t * out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) zigzag_encode(Vec8i().load(in + i)).store(out + i);
+    Vec8i x;
+    x.load_partial(int(n - i), in + i);
+    zigzag_encode(x).store_partial(int(n - i), out + i);
+}
+
+// Zigzag decoding of an array
+static inline void zigzag_decode(uint32_t const * in, int32_t * out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) zigzag_decode(Vec8ui().load(in + i)).store(out + i);
+    Vec8ui x;
+    x.load_partial(int(n - i), in + i);
+    zigzag_decode(x).store_partial(int(n - i), out + i);
+}
+
+
+/*****************************************************************************
+*
+*          Stream VByte
+*
+*****************************************************************************/
+
+// Tables for Stream VByte, indexed by the control byte
+struct Streamvbyte_tables {
+    uint8_t length[256];                         // number of data bytes for 4 values
+    int8_t decode[256][16];                      // pshufb indexes for decoding. -1 gives 0
+    int8_t encode[256][16];                      // pshufb indexes for encoding
+    constexpr Streamvbyte_tables() : length(), decode(), encode() {
+        for (int c = 0; c < 256; c++) {
+            int pos = 0;
+            for (int k = 0; k < 16; k++) encode[c][k] = -1;
+            for (int j = 0; j < 4; j++) {
+                int len = ((c >> (2 * j)) & 3) + 1;
+                for (int b = 0; b < 4; b++) {
+                    decode[c][4 * j + b] = int8_t(b < len ? pos + b : -1);
+                    if (b < len) encode[c][pos + b] = int8_t(4 * j + b);
+                }
+                pos += len;
+            }
+            length[c] = uint8_t(pos);
+        }
+    }
+};
+
+// Maximum number of bytes for n encoded values
+constexpr size_t streamvbyte_max_size(size_t n) {
+    return (n + 3) / 4 + 4 * n;
+}
+
+// Length code of a value: number of bytes - 1
+static inline int streamvbyte_code(uint32_t x) {
+    return (x > 0xFF) + (x > 0xFFFF) + (x > 0xFFFFFF);
+}
+
+// Encode n values. out must have space for streamvbyte_max_size(n) bytes.
+// Returns the number of bytes written
+static inline size_t streamvbyte_encode(uint32_t const * in, size_t n, uint8_t * out) {
+    uint8_t * control = out;
+    uint8_t * data = out + (n + 3) / 4;
+    size_t i = 0;
+#if INSTRSET >= 4  // SSSE3
+    static constexpr Streamvbyte_tables t;
+    Vec4ui const code_shift(0, 2, 4, 6);
+    for (; i + 4 <= n; i += 4) {
+        Vec4ui x = Vec4ui().load(in + i);
+        Vec4ui code = if_add(x > 0xFF, Vec4ui(0), 1u);           // number of bytes - 1
+        code = if_add(x > 0xFFFF, code, 1u);
+        code = if_add(x > 0xFFFFFF, code, 1u);
+        uint32_t c = horizontal_add(code << code_shift);     // control byte
+        *control++ = uint8_t(c);
+        // data pointer + 16 never goes beyond the end of the buffer because there are 4 values left
+        Vec16uc(_mm_shuffle_epi8(Vec16uc(x), Vec16uc().load(t.encode[c]))).store(data);
+        data += t.length[c];
+    }
+#endif
+    for (; i < n; i += 4) {
+        int c = 0;
+        for (int j = 0; j < 4 && i + j < n; j++) {
+            uint32_t x = in[i + j];
+            int code = streamvbyte_code(x);
+            c |= code << (2 * j);
+            for (int b = 0; b <= code; b++) *data++ = uint8_t(x >> (8 * b));
+        }
+        *control++ = uint8_t(c);
+    }
+    return size_t(data - out);
+}
+
+// Decode n values from in, which contains size bytes.
+// Returns the number of bytes read, or 0 if size is too small
+static inline size_t streamvbyte_decode(uint8_t const * in, size_t size, uint32_t * out, size_t n) {
+    uint8_t const * control = in;
+    uint8_t const * data = in + (n + 3) / 4;
+    uint8_t const * end = in + size;
+    if (data > end) return 0;
+    size_t i = 0;
+#if INSTRSET >= 4  // SSSE3
+    static constexpr Streamvbyte_tables t;
+    // 16 bytes are read at a time, also where a group has fewer data bytes
+    for (; i + 4 <= n && data + 16 <= end; i += 4) {
+        int c = *control++;
+        Vec16uc x = Vec16uc().load(data);
+        Vec4ui(_mm_shuffle_epi8(x, Vec16uc().load(t.decode[c]))).store(out + i);
+        data += t.length[c];
+    }
+#endif
+    for (; i < n; i += 4) {
+        int c = *control++;
+        for (int j = 0; j < 4 && i + j < n; j++) {
+            int len = ((c >> (2 * j)) & 3) + 1;
+            if (data + len > end) return 0;
+            uint32_t x = 0;
+            for (int b = 0; b < len; b++) x |= uint32_t(data[b]) << (8 * b);
+            out[i + j] = x;
+            data += len;
+        }
+    }
+    return size_t(data - in);
+}
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_BITPACK_H
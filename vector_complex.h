@@ -0,0 +1,790 @@
+/****************************  vector_complex.h   *****************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining vectors of complex numbers and FFT butterflies.
+* This replaces complexvec.h from version 1 of the vector class library.
+* This header is optional. It is not included by vectorclass.h.
+*
+* Two memory layouts are supported:
+*
+* Complexvec<V>        Interleaved layout. The real and imaginary parts are stored
+*                      alternately in one vector V, as in an array of std::complex.
+*                      The number of complex elements is V::size()/2.
+*
+* Complexvec_split<V>  Split layout (structure of arrays). The real parts are in
+*                      one vector V and the imaginary parts in another vector V.
+*                      The number of complex elements is V::size(). Multiplication
+*                      and division need no permutations in this layout. Load and
+*                      store functions are provided both for separate arrays of real
+*                      and imaginary parts and for interleaved arrays. The split
+*                      layout is fastest when the data are stored in separate arrays
+*                      or when many operations are done between load and store.
+*
+* V can be Vec4f, Vec8f, Vec16f, Vec2d, Vec4d or Vec8d. The following type names
+* are defined. The number is the number of complex elements:
+* interleaved: Vec2cf  Vec4cf  Vec8cf   Vec1cd  Vec2cd  Vec4cd
+* split:       Vec4cfs Vec8cfs Vec16cfs Vec2cds Vec4cds Vec8cds
+*
+* Operators and functions defined for both layouts:
+* + - * /         with complex vectors, or with a real scalar as the second operand
+* conj(a)         complex conjugate
+* mul_i(a)        a * i
+* mul_minus_i(a)  a * (-i)
+* norm(a)         squared absolute value
+* abs(a)          absolute value
+* arg(a)          argument (phase angle) in the interval [-pi, pi]
+* exp(a)          complex exponential function
+* horizontal_add(a)  sum of all elements as std::complex
+*
+* The functions norm, abs and arg return a complex vector with the imaginary parts
+* zero for the interleaved layout, and a real vector V for the split layout.
+*
+* FFT butterflies for both layouts:
+* fft_butterfly4<inverse>(x0, x1, x2, x3)            radix-4 butterfly in place
+* fft_butterfly4<inverse>(x0, x1, x2, x3, w1, w2, w3) with input twiddle factors
+* fft_butterfly8<inverse>(x0, ... x7)                radix-8 butterfly in place
+* Each vector element is a separate butterfly, so a vector of N complex elements
+* does N butterflies at a time.
+*
+* Multiplication and division follow the usual formulas without the special
+* handling of infinity and NAN that std::complex uses. Division and abs may
+* overflow or underflow if the squares of the parts are outside the range of
+* the floating point type, i.e. above approximately 1E19 for float.
+*
+* The interleaved multiplication uses the fmaddsub instruction when FMA is supported,
+* or addsub with SSE3. The split multiplication uses fused multiply-and-add.
+* abs, arg and exp use sqrt, atan2, exp and sincos from vectormath_exp.h and
+* vectormath_trig.h.
+*
+* Example:
+* // multiply a signal by a complex oscillator: y[i] = x[i] * w^i
+* Vec8cfs w8 = ...;                      // w^8 in all elements
+* Vec8cfs osc = ...;                     // w^0 .. w^7
+* for (int i = 0; i < n; i += 8) {
+*     Vec8cfs x;  x.load(xp + i);        // xp is an array of std::complex<float>
+*     (x * osc).store(yp + i);
+*     osc = osc * w8;
+* }
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_COMPLEX_H
+#define VECTOR_COMPLEX_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include "vector_convert.h"            // vector_traits, permute_n, blend_n
+#include "vectormath_exp.h"            // exp
+#include "vectormath_trig.h"           // sincos, atan2
+
+#include <complex>                     // std::complex
+#include <utility>                     // std::integer_sequence
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*          Permutations of interleaved complex vectors
+*
+*****************************************************************************/
+// These functions take the sequence 0, 1, 2, ... V::size()-1 as the last
+// parameter for generating the permutation indexes
+
+// Sequence of indexes for vector V
+template <typename V>
+using complex_index = std::make_integer_sequence<int, V::size()>;
+
+// Swap the real and imaginary parts: (re, im) -> (im, re)
+template <typename V, int ... J>
+static inline V complex_swap(V const a, std::integer_sequence<int, J...>) {
+    return permute_n<(J ^ 1)...>(a);
+}
+
+// Copy the real parts to the imaginary parts: (re, im) -> (re, re)
+template <typename V, int ... J>
+static inline V complex_dup_re(V const a, std::integer_sequence<int, J...>) {
+    return permute_n<(J & ~1)...>(a);
+}
+
+// Copy the imaginary parts to the real parts: (re, im) -> (im, im)
+template <typename V, int ... J>
+static inline V complex_dup_im(V const a, std::integer_sequence<int, J...>) {
+    return permute_n<(J | 1)...>(a);
+}
+
+// Set the imaginary parts to zero: (re, im) -> (re, 0)
+template <typename V, int ... J>
+static inline V complex_zero_im(V const a, std::integer_sequence<int, J...>) {
+    return permute_n<((J & 1) ? -1 : J)...>(a);
+}
+
+// Change the sign of the imaginary parts: (re, im) -> (re, -im)
+template <typename V, int ... J>
+static inline V complex_neg_im(V const a, std::integer_sequence<int, J...>) {
+    return change_sign<(J & 1)...>(a);
+}
+
+// Change the sign of the real parts: (re, im) -> (-re, im)
+template <typename V, int ... J>
+static inline V complex_neg_re(V const a, std::integer_sequence<int, J...>) {
+    return change_sign<((J & 1) ^ 1)...>(a);
+}
+
+// Real parts from a and imaginary parts from b: (a.re, b.im)
+template <typename V, int ... J>
+static inline V complex_merge(V const a, V const b, std::integer_sequence<int, J...>) {
+    return blend_n<((J & 1) ? J + V::size() : J)...>(a, b);
+}
+
+// Split two interleaved vectors x and y into real parts and imaginary parts
+template <typename V, int ... J>
+static inline void complex_deinterleave(V const x, V const y, V & re, V & im, std::integer_sequence<int, J...>) {
+    re = blend_n<(2 * J)...>(x, y);
+    im = blend_n<(2 * J + 1)...>(x, y);
+}
+
+// Interleave real parts and imaginary parts into two vectors x and y
+template <typename V, int ... J>
+static inline void complex_interleave(V const re, V const im, V & x, V & y, std::integer_sequence<int, J...>) {
+    constexpr int N = V::size();
+    x = blend_n<((J & 1) ? N + J / 2 : J / 2)...>(re, im);
+    y = blend_n<((J & 1) ? N + N / 2 + J / 2 : N / 2 + J / 2)...>(re, im);
+}
+
+// a * b - c for the real parts and a * b + c for the imaginary parts
+static inline Vec4f complex_fmaddsub(Vec4f const a, Vec4f const b, Vec4f const c) {
+#ifdef __FMA__
+    return _mm_fmaddsub_ps(a, b, c);
+#elif INSTRSET >= 3  // SSE3
+    return _mm_addsub_ps(a * b, c);
+#else
+    return a * b + change_sign<1,0,1,0>(c);
+#endif
+}
+
+static inline Vec2d complex_fmaddsub(Vec2d const a, Vec2d const b, Vec2d const c) {
+#ifdef __FMA__
+    return _mm_fmaddsub_pd(a, b, c);
+#elif INSTRSET >= 3  // SSE3
+    return _mm_addsub_pd(a * b, c);
+#else
+    return a * b + change_sign<1,0>(c);
+#endif
+}
+
+#if MAX_VECTOR_SIZE >= 256
+static inline Vec8f complex_fmaddsub(Vec8f const a, Vec8f const b, Vec8f const c) {
+#if INSTRSET >= 7  // AVX
+#ifdef __FMA__
+    return _mm256_fmaddsub_ps(a, b, c);
+#else
+    return _mm256_addsub_ps(a * b, c);
+#endif
+#else
+    return Vec8f(complex_fmaddsub(a.get_low(), b.get_low(), c.get_low()), complex_fmaddsub(a.get_high(), b.get_high(), c.get_high()));
+#endif
+}
+
+static inline Vec4d complex_fmaddsub(Vec4d const a, Vec4d const b, Vec4d const c) {
+#if INSTRSET >= 7  // AVX
+#ifdef __FMA__
+    return _mm256_fmaddsub_pd(a, b, c);
+#else
+    return _mm256_addsub_pd(a * b, c);
+#endif
+#else
+    return Vec4d(complex_fmaddsub(a.get_low(), b.get_low(), c.get_low()), complex_fmaddsub(a.get_high(), b.get_high(), c.get_high()));
+#endif
+}
+#endif // MAX_VECTOR_SIZE >= 256
+
+#if MAX_VECTOR_SIZE >= 512
+static inline Vec16f complex_fmaddsub(Vec16f const a, Vec16f const b, Vec16f const c) {
+#if INSTRSET >= 9  // AVX512F
+    return _mm512_fmaddsub_ps(a, b, c);
+#else
+    return Vec16f(complex_fmaddsub(a.get_low(), b.get_low(), c.get_low()), complex_fmaddsub(a.get_high(), b.get_high(), c.get_high()));
+#endif
+}
+
+static inline Vec8d complex_fmaddsub(Vec8d const a, Vec8d const b, Vec8d const c) {
+#if INSTRSET >= 9  // AVX512F
+    return _mm512_fmaddsub_pd(a, b, c);
+#else
+    return Vec8d(complex_fmaddsub(a.get_low(), b.get_low(), c.get_low()), complex_fmaddsub(a.get_high(), b.get_high(), c.get_high()));
+#endif
+}
+#endif // MAX_VECTOR_SIZE >= 512
+
+
+/*****************************************************************************
+*
+*          class Complexvec: interleaved complex vector
+*
+*****************************************************************************/
+
+template <typename V>
+class Complexvec {
+public:
+    typedef typename vector_traits<V>::element_type T;
+protected:
+    V v;                                         // re, im, re, im, ...
+public:
+    // Default constructor
+    Complexvec() = default;
+    // Constructor to convert from vector with interleaved real and imaginary parts
+    Complexvec(V const x) : v(x) {}
+    // Constructor to broadcast the same complex number into all elements
+    Complexvec(T const re, T const im = 0) {
+        v = complex_merge(V(re), V(im), complex_index<V>());
+    }
+    Complexvec(std::complex<T> const z) : Complexvec(z.real(), z.imag()) {}
+    // Type cast operator to convert to vector with interleaved real and imaginary parts
+    operator V() const {
+        return v;
+    }
+    // Member function to load from array of interleaved real and imaginary parts
+    Complexvec & load(T const * p) {
+        v.load(p);
+        return *this;
+    }
+    Complexvec & load(std::complex<T> const * p) {
+        return load((T const *)p);
+    }
+    // Member function to store into array of interleaved real and imaginary parts
+    void store(T * p) const {
+        v.store(p);
+    }
+    void store(std::complex<T> * p) const {
+        store((T *)p);
+    }
+    // Partial load. Load n complex elements and set the rest to 0
+    Complexvec & load_partial(int n, std::complex<T> const * p) {
+        v.load_partial(2 * n, (T const *)p);
+        return *this;
+    }
+    // Partial store. Store n complex elements
+    void store_partial(int n, std::complex<T> * p) const {
+        v.store_partial(2 * n, (T *)p);
+    }
+    // Member function to get a single element
+    std::complex<T> extract(int index) const {
+        return std::complex<T>(v[2 * index], v[2 * index + 1]);
+    }
+    std::complex<T> operator [] (int index) const {
+        return extract(index);
+    }
+    // Member function to change a single element
+    Complexvec & insert(int index, std::complex<T> const z) {
+        v.insert(2 * index, z.real());
+        v.insert(2 * index + 1, z.imag());
+        return *this;
+    }
+    static constexpr int size() {
+        return V::size() / 2;
+    }
+};
+
+// vector operator + : add
+template <typename V>
+static inline Complexvec<V> operator + (Complexvec<V> const a, Complexvec<V> const b) {
+    return V(a) + V(b);
+}
+
+// vector operator + : add real scalar
+template <typename V>
+static inline Complexvec<V> operator + (Complexvec<V> const a, typename Complexvec<V>::T const b) {
+    return a + Complexvec<V>(b);
+}
+
+// vector operator - : subtract
+template <typename V>
+static inline Complexvec<V> operator - (Complexvec<V> const a, Complexvec<V> const b) {
+    return V(a) - V(b);
+}
+
+// vector operator - : subtract real scalar
+template <typename V>
+static inline Complexvec<V> operator - (Complexvec<V> const a, typename Complexvec<V>::T const b) {
+    return a - Complexvec<V>(b);
+}
+
+// vector operator - : unary minus
+template <typename V>
+static inline Complexvec<V> operator - (Complexvec<V> const a) {
+    return -V(a);
+}
+
+// vector operator * : complex multiply
+// (a.re + i*a.im) * (b.re + i*b.im) = (a.re*b.re - a.im*b.im) + i*(a.re*b.im + a.im*b.re)
+template <typename V>
+static inline Complexvec<V> operator * (Complexvec<V> const a, Complexvec<V> const b) {
+    V ar = complex_dup_re(V(a), complex_index<V>());       // a.re, a.re
+    V ai = complex_dup_im(V(a), complex_index<V>());       // a.im, a.im
+    V bs = complex_swap(V(b), complex_index<V>());         // b.im, b.re
+    return complex_fmaddsub(ar, V(b), ai * bs);
+}
+
+// vector operator * : multiply by real scalar
+template <typename V>
+static inline Complexvec<V> operator * (Complexvec<V> const a, typename Complexvec<V>::T const b) {
+    return V(a) * V(b);
+}
+
+// Squared absolute value in both the real part and the imaginary part
+template <typename V>
+static inline V complex_norm2(Complexvec<V> const a) {
+    V n = V(a) * V(a);
+    return n + complex_swap(n, complex_index<V>());
+}
+
+// vector operator / : complex divide. a / b = a * conj(b) / norm(b)
+template <typename V>
+static inline Complexvec<V> operator / (Complexvec<V> const a, Complexvec<V> const b) {
+    return V(a * conj(b)) / complex_norm2(b);
+}
+
+// vector operator / : divide by real scalar
+template <typename V>
+static inline Complexvec<V> operator / (Complexvec<V> const a, typename Complexvec<V>::T const b) {
+    return V(a) / V(b);
+}
+
+// vector operator += : add
+template <typename V>
+static inline Complexvec<V> & operator += (Complexvec<V> & a, Complexvec<V> const b) {
+    a = a + b;
+    return a;
+}
+
+// vector operator -= : subtract
+template <typename V>
+static inline Complexvec<V> & operator -= (Complexvec<V> & a, Complexvec<V> const b) {
+    a = a - b;
+    return a;
+}
+
+// vector operator *= : multiply
+template <typename V>
+static inline Complexvec<V> & operator *= (Complexvec<V> & a, Complexvec<V> const b) {
+    a = a * b;
+    return a;
+}
+
+// vector operator /= : divide
+template <typename V>
+static inline Complexvec<V> & operator /= (Complexvec<V> & a, Complexvec<V> const b) {
+    a = a / b;
+    return a;
+}
+
+// complex conjugate
+template <typename V>
+static inline Complexvec<V> conj(Complexvec<V> const a) {
+    return complex_neg_im(V(a), complex_index<V>());
+}
+
+// multiply by i: (re, im) -> (-im, re)
+template <typename V>
+static inline Complexvec<V> mul_i(Complexvec<V> const a) {
+    return complex_neg_re(complex_swap(V(a), complex_index<V>()), complex_index<V>());
+}
+
+// multiply by -i: (re, im) -> (im, -re)
+template <typename V>
+static inline Complexvec<V> mul_minus_i(Complexvec<V> const a) {
+    return complex_neg_im(complex_swap(V(a), complex_index<V>()), complex_index<V>());
+}
+
+// squared absolute value re^2 + im^2 in the real parts. The imaginary parts are zero
+template <typename V>
+static inline Complexvec<V> norm(Complexvec<V> const a) {
+    return complex_zero_im(complex_norm2(a), complex_index<V>());
+}
+
+// absolute value in the real parts. The imaginary parts are zero
+template <typename V>
+static inline Complexvec<V> abs(Complexvec<V> const a) {
+    return complex_zero_im(sqrt(complex_norm2(a)), complex_index<V>());
+}
+
+// argument atan2(im, re) in the real parts. The imaginary parts are zero
+template <typename V>
+static inline Complexvec<V> arg(Complexvec<V> const a) {
+    V t = atan2(complex_swap(V(a), complex_index<V>()), V(a));
+    return complex_zero_im(t, complex_index<V>());
+}
+
+// complex exponential function: exp(re) * (cos(im) + i*sin(im))
+template <typename V>
+static inline Complexvec<V> exp(Complexvec<V> const a) {
+    V e = complex_dup_re(exp(V(a)), complex_index<V>());   // exp(re) in both parts
+    V c;
+    V s = sincos(&c, complex_dup_im(V(a), complex_index<V>()));
+    return e * complex_merge(c, s, complex_index<V>());
+}
+
+// sum of all elements
+template <typename V>
+static inline std::complex<typename Complexvec<V>::T> horizontal_add(Complexvec<V> const a) {
+    V re = complex_zero_im(V(a), complex_index<V>());
+    V im = complex_zero_im(complex_swap(V(a), complex_index<V>()), complex_index<V>());
+    return std::complex<typename Complexvec<V>::T>(horizontal_add(re), horizontal_add(im));
+}
+
+
+/*****************************************************************************
+*
+*          class Complexvec_split: complex vector with separate real and
+*          imaginary parts
+*
+*****************************************************************************/
+
+template <typename V>
+class Complexvec_split {
+public:
+    typedef typename vector_traits<V>::element_type T;
+    V re;                                        // real parts
+    V im;                                        // imaginary parts
+    // Default constructor
+    Complexvec_split() = default;
+    // Constructor to build from real parts and imaginary parts
+    Complexvec_split(V const r, V const i) : re(r), im(i) {}
+    // Constructor to convert from real vector
+    Complexvec_split(V const r) : re(r), im(T(0)) {}
+    // Constructor to broadcast the same complex number into all elements
+    Complexvec_split(T const r, T const i = 0) : re(r), im(i) {}
+    Complexvec_split(std::complex<T> const z) : re(z.real()), im(z.imag()) {}
+    // Constructor to convert from two interleaved complex vectors
+    Complexvec_split(Complexvec<V> const x, Complexvec<V> const y) {
+        complex_deinterleave(V(x), V(y), re, im, complex_index<V>());
+    }
+    // Member functions to convert to two interleaved complex vectors
+    Complexvec<V> get_low() const {
+        V x, y;
+        complex_interleave(re, im, x, y, complex_index<V>());
+        return x;
+    }
+    Complexvec<V> get_high() const {
+        V x, y;
+        complex_interleave(re, im, x, y, complex_index<V>());
+        return y;
+    }
+    // Member function to load from array of std::complex
+    Complexvec_split & load(std::complex<T> const * p) {
+        T const * q = (T const *)p;
+        complex_deinterleave(V().load(q), V().load(q + V::size()), re, im, complex_index<V>());
+        return *this;
+    }
+    // Member function to load from separate arrays of real parts and imaginary parts
+    Complexvec_split & load(T const * pre, T const * pim) {
+        re.load(pre);
+        im.load(pim);
+        return *this;
+    }
+    // Member function to store into array of std::complex
+    void store(std::complex<T> * p) const {
+        V x, y;
+        complex_interleave(re, im, x, y, complex_index<V>());
+        x.store((T *)p);
+        y.store((T *)p + V::size());
+    }
+    // Member function to store into separate arrays of real parts and imaginary parts
+    void store(T * pre, T * pim) const {
+        re.store(pre);
+        im.store(pim);
+    }
+    // Partial load. Load n complex elements and set the rest to 0
+    Complexvec_split & load_partial(int n, std::complex<T> const * p) {
+        constexpr int N = V::size();
+        T const * q = (T const *)p;
+        V x, y;
+        if (2 * n >= N) {
+            x.load(q);
+            y.load_partial(2 * n - N, q + N);
+        }
+        else {
+            x.load_partial(2 * n, q);
+            y = V(T(0));
+        }
+        complex_deinterleave(x, y, re, im, complex_index<V>());
+        return *this;
+    }
+    Complexvec_split & load_partial(int n, T const * pre, T const * pim) {
+        re.load_partial(n, pre);
+        im.load_partial(n, pim);
+        return *this;
+    }
+    // Partial store. Store n complex elements
+    void store_partial(int n, std::complex<T> * p) const {
+        constexpr int N = V::size();
+        V x, y;
+        complex_interleave(re, im, x, y, complex_index<V>());
+        if (2 * n >= N) {
+            x.store((T *)p);
+            y.store_partial(2 * n - N, (T *)p + N);
+        }
+        else {
+            x.store_partial(2 * n, (T *)p);
+        }
+    }
+    void store_partial(int n, T * pre, T * pim) const {
+        re.store_partial(n, pre);
+        im.store_partial(n, pim);
+    }
+    // Member function to get a single element
+    std::complex<T> extract(int index) const {
+        return std::complex<T>(re[index], im[index]);
+    }
+    std::complex<T> operator [] (int index) const {
+        return extract(index);
+    }
+    // Member function to change a single element
+    Complexvec_split & insert(int index, std::complex<T> const z) {
+        re.insert(index, z.real());
+        im.insert(index, z.imag());
+        return *this;
+    }
+    static constexpr int size() {
+        return V::size();
+    }
+};
+
+// vector operator + : add
+template <typename V>
+static inline Complexvec_split<V> operator + (Complexvec_split<V> const a, Complexvec_split<V> const b) {
+    return Complexvec_split<V>(a.re + b.re, a.im + b.im);
+}
+
+// vector operator + : add real scalar
+template <typename V>
+static inline Complexvec_split<V> operator + (Complexvec_split<V> const a, typename Complexvec_split<V>::T const b) {
+    return Complexvec_split<V>(a.re + b, a.im);
+}
+
+// vector operator - : subtract
+template <typename V>
+static inline Complexvec_split<V> operator - (Complexvec_split<V> const a, Complexvec_split<V> const b) {
+    return Complexvec_split<V>(a.re - b.re, a.im - b.im);
+}
+
+// vector operator - : subtract real scalar
+template <typename V>
+static inline Complexvec_split<V> operator - (Complexvec_split<V> const a, typename Complexvec_split<V>::T const b) {
+    return Complexvec_split<V>(a.re - b, a.im);
+}
+
+// vector operator - : unary minus
+template <typename V>
+static inline Complexvec_split<V> operator - (Complexvec_split<V> const a) {
+    return Complexvec_split<V>(-a.re, -a.im);
+}
+
+// vector operator * : complex multiply
+template <typename V>
+static inline Complexvec_split<V> operator * (Complexvec_split<V> const a, Complexvec_split<V> const b) {
+    return Complexvec_split<V>(mul_sub(a.re, b.re, a.im * b.im), mul_add(a.re, b.im, a.im * b.re));
+}
+
+// vector operator * : multiply by real scalar
+template <typename V>
+static inline Complexvec_split<V> operator * (Complexvec_split<V> const a, typename Complexvec_split<V>::T const b) {
+    return Complexvec_split<V>(a.re * b, a.im * b);
+}
+
+// vector operator / : complex divide. a / b = a * conj(b) / norm(b)
+template <typename V>
+static inline Complexvec_split<V> operator / (Complexvec_split<V> const a, Complexvec_split<V> const b) {
+    V n = mul_add(b.re, b.re, b.im * b.im);
+    V r = mul_add(a.re, b.re, a.im * b.im);
+    V i = mul_sub(a.im, b.re, a.re * b.im);
+    return Complexvec_split<V>(r / n, i / n);
+}
+
+// vector operator / : divide by real scalar
+template <typename V>
+static inline Complexvec_split<V> operator / (Complexvec_split<V> const a, typename Complexvec_split<V>::T const b) {
+    return Complexvec_split<V>(a.re / b, a.im / b);
+}
+
+// vector operator += : add
+template <typename V>
+static inline Complexvec_split<V> & operator += (Complexvec_split<V> & a, Complexvec_split<V> const b) {
+    a = a + b;
+    return a;
+}
+
+// vector operator -= : subtract
+template <typename V>
+static inline Complexvec_split<V> & operator -= (Complexvec_split<V> & a, Complexvec_split<V> const b) {
+    a = a - b;
+    return a;
+}
+
+// vector operator *= : multiply
+template <typename V>
+static inline Complexvec_split<V> & operator *= (Complexvec_split<V> & a, Complexvec_split<V> const b) {
+    a = a * b;
+    return a;
+}
+
+// vector operator /= : divide
+template <typename V>
+static inline Complexvec_split<V> & operator /= (Complexvec_split<V> & a, Complexvec_split<V> const b) {
+    a = a / b;
+    return a;
+}
+
+// complex conjugate
+template <typename V>
+static inline Complexvec_split<V> conj(Complexvec_split<V> const a) {
+    return Complexvec_split<V>(a.re, -a.im);
+}
+
+// multiply by i
+template <typename V>
+static inline Complexvec_split<V> mul_i(Complexvec_split<V> const a) {
+    return Complexvec_split<V>(-a.im, a.re);
+}
+
+// multiply by -i
+template <typename V>
+static inline Complexvec_split<V> mul_minus_i(Complexvec_split<V> const a) {
+    return Complexvec_split<V>(a.im, -a.re);
+}
+
+// squared absolute value re^2 + im^2
+template <typename V>
+static inline V norm(Complexvec_split<V> const a) {
+    return mul_add(a.re, a.re, a.im * a.im);
+}
+
+// absolute value
+template <typename V>
+static inline V abs(Complexvec_split<V> const a) {
+    return sqrt(norm(a));
+}
+
+// argument atan2(im, re)
+template <typename V>
+static inline V arg(Complexvec_split<V> const a) {
+    return atan2(a.im, a.re);
+}
+
+// complex exponential function: exp(re) * (cos(im) + i*sin(im))
+template <typename V>
+static inline Complexvec_split<V> exp(Complexvec_split<V> const a) {
+    V e = exp(a.re);
+    V c;
+    V s = sincos(&c, a.im);
+    return Complexvec_split<V>(e * c, e * s);
+}
+
+// sum of all elements
+template <typename V>
+static inline std::complex<typename Complexvec_split<V>::T> horizontal_add(Complexvec_split<V> const a) {
+    return std::complex<typename Complexvec_split<V>::T>(horizontal_add(a.re), horizontal_add(a.im));
+}
+
+
+/*****************************************************************************
+*
+*          Type names
+*
+*****************************************************************************/
+
+typedef Complexvec<Vec4f>        Vec2cf;
+typedef Complexvec<Vec2d>        Vec1cd;
+typedef Complexvec_split<Vec4f>  Vec4cfs;
+typedef Complexvec_split<Vec2d>  Vec2cds;
+#if MAX_VECTOR_SIZE >= 256
+typedef Complexvec<Vec8f>        Vec4cf;
+typedef Complexvec<Vec4d>        Vec2cd;
+typedef Complexvec_split<Vec8f>  Vec8cfs;
+typedef Complexvec_split<Vec4d>  Vec4cds;
+#endif
+#if MAX_VECTOR_SIZE >= 512
+typedef Complexvec<Vec16f>       Vec8cf;
+typedef Complexvec<Vec8d>        Vec4cd;
+typedef Complexvec_split<Vec16f> Vec16cfs;
+typedef Complexvec_split<Vec8d>  Vec8cds;
+#endif
+
+
+/*****************************************************************************
+*
+*          FFT butterflies
+*
+*****************************************************************************/
+// These functions work with both Complexvec and Complexvec_split.
+// The forward transform is X[k] = sum(x[j] * exp(-2*pi*i*j*k/n)).
+// The inverse transform uses exp(+2*pi*i*j*k/n) and does not divide by n.
+
+// Radix-4 butterfly. Replaces x0 - x3 by their 4-point DFT
+template <bool inverse = false, typename C>
+static inline void fft_butterfly4(C & x0, C & x1, C & x2, C & x3) {
+    C a = x0 + x2;
+    C b = x0 - x2;
+    C c = x1 + x3;
+    C d = inverse ? mul_i(x1 - x3) : mul_minus_i(x1 - x3);
+    x0 = a + c;
+    x1 = b + d;
+    x2 = a - c;
+    x3 = b - d;
+}
+
+// Radix-4 butterfly with twiddle factors. x1, x2, x3 are multiplied by w1, w2, w3
+// before the butterfly, as in a decimation-in-time FFT
+template <bool inverse = false, typename C>
+static inline void fft_butterfly4(C & x0, C & x1, C & x2, C & x3, C const w1, C const w2, C const w3) {
+    x1 = x1 * w1;
+    x2 = x2 * w2;
+    x3 = x3 * w3;
+    fft_butterfly4<inverse>(x0, x1, x2, x3);
+}
+
+// Radix-8 butterfly. Replaces x0 - x7 by their 8-point DFT.
+// This is two radix-4 butterflies on the even and odd inputs, combined with the
+// factors exp(-2*pi*i*k/8) which need only additions and one multiplication by sqrt(0.5)
+template <bool inverse = false, typename C>
+static inline void fft_butterfly8(C & x0, C & x1, C & x2, C & x3, C & x4, C & x5, C & x6, C & x7) {
+    typedef typename C::T T;
+    T const r = T(0.70710678118654752440);       // sqrt(0.5)
+    fft_butterfly4<inverse>(x0, x2, x4, x6);     // even inputs
+    fft_butterfly4<inverse>(x1, x3, x5, x7);     // odd inputs
+    // multiply odd outputs by the twiddle factors exp(-+2*pi*i*k/8)
+    C o0 = x1;
+    C o1 = inverse ? (x3 + mul_i(x3)) * r : (x3 + mul_minus_i(x3)) * r;
+    C o2 = inverse ? mul_i(x5) : mul_minus_i(x5);
+    C o3 = inverse ? (mul_i(x7) - x7) * r : (mul_minus_i(x7) - x7) * r;
+    C e0 = x0, e1 = x2, e2 = x4, e3 = x6;
+    x0 = e0 + o0;
+    x1 = e1 + o1;
+    x2 = e2 + o2;
+    x3 = e3 + o3;
+    x4 = e0 - o0;
+    x5 = e1 - o1;
+    x6 = e2 - o2;
+    x7 = e3 - o3;
+}
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_COMPLEX_H
@@ -1,8 +1,8 @@
 /**************************  vector_convert.h   *******************************
 * Author:        Agner Fog
 * Date created:  2014-07-23
-* Last modified: 2022-07-20
-* Version:       2.02.00
+* Last modified: 2026-10-14
+* Version:       2.03.00
 * Project:       vector class library
 * Description:
 * Header file for conversion between different vector classes with different
@@ -23,6 +23,9 @@
 #error Incompatible versions of vector class library mixed
 #endif
 
+#include <utility>                     // std::integer_sequence
+#include <type_traits>                 // std::is_same
+
 #ifdef VCL_NAMESPACE
 namespace VCL_NAMESPACE {
 #endif
@@ -510,6 +513,148 @@ static inline Vec4f to_float (Vec2d const a) {
 *
 *****************************************************************************/
 
+// vector_traits<V>: properties of vector class V for use in templates:
+// element_type: the type of the vector elements
+// int_vector:   signed integer vector with the same number and size of elements
+// uint_vector:  unsigned integer vector with the same number and size of elements
+// boolean_vector: boolean vector type returned by comparisons
+template <typename V> struct vector_traits;
+
+#define VCL_VECTOR_TRAITS(V, T, VI, VU)                       \
+template <> struct vector_traits<V> {                         \
+    typedef T  element_type;                                  \
+    typedef VI int_vector;                                    \
+    typedef VU uint_vector;                                   \
+    typedef decltype(V() == V()) boolean_vector;              \
+};
+
+VCL_VECTOR_TRAITS(Vec16c,  int8_t,   Vec16c, Vec16uc)
+VCL_VECTOR_TRAITS(Vec16uc, uint8_t,  Vec16c, Vec16uc)
+VCL_VECTOR_TRAITS(Vec8s,   int16_t,  Vec8s,  Vec8us)
+VCL_VECTOR_TRAITS(Vec8us,  uint16_t, Vec8s,  Vec8us)
+VCL_VECTOR_TRAITS(Vec4i,   int32_t,  Vec4i,  Vec4ui)
+VCL_VECTOR_TRAITS(Vec4ui,  uint32_t, Vec4i,  Vec4ui)
+VCL_VECTOR_TRAITS(Vec2q,   int64_t,  Vec2q,  Vec2uq)
+VCL_VECTOR_TRAITS(Vec2uq,  uint64_t, Vec2q,  Vec2uq)
+VCL_VECTOR_TRAITS(Vec4f,   float,    Vec4i,  Vec4ui)
+VCL_VECTOR_TRAITS(Vec2d,   double,   Vec2q,  Vec2uq)
+#if MAX_VECTOR_SIZE >= 256
+VCL_VECTOR_TRAITS(Vec32c,  int8_t,   Vec32c, Vec32uc)
+VCL_VECTOR_TRAITS(Vec32uc, uint8_t,  Vec32c, Vec32uc)
+VCL_VECTOR_TRAITS(Vec16s,  int16_t,  Vec16s, Vec16us)
+VCL_VECTOR_TRAITS(Vec16us, uint16_t, Vec16s, Vec16us)
+VCL_VECTOR_TRAITS(Vec8i,   int32_t,  Vec8i,  Vec8ui)
+VCL_VECTOR_TRAITS(Vec8ui,  uint32_t, Vec8i,  Vec8ui)
+VCL_VECTOR_TRAITS(Vec4q,   int64_t,  Vec4q,  Vec4uq)
+VCL_VECTOR_TRAITS(Vec4uq,  uint64_t, Vec4q,  Vec4uq)
+VCL_VECTOR_TRAITS(Vec8f,   float,    Vec8i,  Vec8ui)
+VCL_VECTOR_TRAITS(Vec4d,   double,   Vec4q,  Vec4uq)
+#endif
+#if MAX_VECTOR_SIZE >= 512
+VCL_VECTOR_TRAITS(Vec64c,  int8_t,   Vec64c, Vec64uc)
+VCL_VECTOR_TRAITS(Vec64uc, uint8_t,  Vec64c, Vec64uc)
+VCL_VECTOR_TRAITS(Vec32s,  int16_t,  Vec32s, Vec32us)
+VCL_VECTOR_TRAITS(Vec32us, uint16_t, Vec32s, Vec32us)
+VCL_VECTOR_TRAITS(Vec16i,  int32_t,  Vec16i, Vec16ui)
+VCL_VECTOR_TRAITS(Vec16ui, uint32_t, Vec16i, Vec16ui)
+VCL_VECTOR_TRAITS(Vec8q,   int64_t,  Vec8q,  Vec8uq)
+VCL_VECTOR_TRAITS(Vec8uq,  uint64_t, Vec8q,  Vec8uq)
+VCL_VECTOR_TRAITS(Vec16f,  float,    Vec16i, Vec16ui)
+VCL_VECTOR_TRAITS(Vec8d,   double,   Vec8q,  Vec8uq)
+#endif
+
+// reinterpret vector as the signed integer vector with the same element size
+template <typename V>
+static inline typename vector_traits<V>::int_vector to_int_vector(V const a) {
+    typedef typename vector_traits<V>::int_vector VI;
+    if constexpr (V::elementtype() >= 15) {
+        return VI(reinterpret_i(a));             // float or double
+    }
+    else {
+        return VI(a);                            // integer
+    }
+}
+
+// reinterpret integer vector x as vector type V with the same element size
+template <typename V, typename VI>
+static inline V from_int_vector(VI const x) {
+    if constexpr (V::elementtype() == 16) {
+        return reinterpret_f(x);                 // float
+    }
+    else if constexpr (V::elementtype() == 17) {
+        return reinterpret_d(x);                 // double
+    }
+    else {
+        return V(x);                             // integer
+    }
+}
+
+// Table of element indexes 0, 1, 2, ... used by first_n_true
+template <typename T, int N>
+struct First_n_index {
+    T x[N];
+    constexpr First_n_index() : x() {
+        for (int i = 0; i < N; i++) x[i] = T(i);
+    }
+};
+
+// Boolean vector with the first n elements true and the remaining elements false.
+// This is useful for the last partial vector of a loop, where the conditional functions
+// if_add, if_fma, etc. can update an accumulator with only the valid elements in cases
+// where the zero padding of load_partial would not give a neutral result:
+// Vec8f x = Vec8f().load_partial(r, p + i);          // last r < 8 elements
+// sum = if_add(first_n_true<Vec8f>(r), sum, exp(x));  // exp(0) = 1 must not be added
+template <typename V>
+static inline typename vector_traits<V>::boolean_vector first_n_true(int n) {
+    typedef typename vector_traits<V>::int_vector VI;
+    typedef typename vector_traits<VI>::element_type T;
+    constexpr int N = V::size();
+    static constexpr First_n_index<T, N> index;
+    if (n > N) n = N;
+    if (n < 0) n = 0;
+    return typename vector_traits<V>::boolean_vector(VI().load(index.x) < VI(T(n)));
+}
+
+// permute vector a with the indexes I, calling permute2 ... permute64 depending on the number of indexes
+template <int ... I, typename V>
+static inline V permute_n(V const a) {
+    constexpr int n = sizeof...(I);
+    if constexpr (n == 2) return permute2<I...>(a);
+    else if constexpr (n == 4) return permute4<I...>(a);
+    else if constexpr (n == 8) return permute8<I...>(a);
+    else if constexpr (n == 16) return permute16<I...>(a);
+#if MAX_VECTOR_SIZE >= 256
+    else if constexpr (n == 32) return permute32<I...>(a);
+#endif
+#if MAX_VECTOR_SIZE >= 512
+    else if constexpr (n == 64) return permute64<I...>(a);
+#endif
+    else {
+        static_assert(n == 0, "Unsupported vector size");
+        return a;
+    }
+}
+
+// blend vectors a and b with the indexes I, calling blend2 ... blend64 depending on the number of indexes
+template <int ... I, typename V>
+static inline V blend_n(V const a, V const b) {
+    constexpr int n = sizeof...(I);
+    if constexpr (n == 2) return blend2<I...>(a, b);
+    else if constexpr (n == 4) return blend4<I...>(a, b);
+    else if constexpr (n == 8) return blend8<I...>(a, b);
+    else if constexpr (n == 16) return blend16<I...>(a, b);
+#if MAX_VECTOR_SIZE >= 256
+    else if constexpr (n == 32) return blend32<I...>(a, b);
+#endif
+#if MAX_VECTOR_SIZE >= 512
+    else if constexpr (n == 64) return blend64<I...>(a, b);
+#endif
+    else {
+        static_assert(n == 0, "Unsupported vector size");
+        return a;
+    }
+}
+
 // concatenate two vectors into one vector of double size
 template <typename T> auto concatenate2(T const a, T const b) {
     static_assert(sizeof(T) * 8 < MAX_VECTOR_SIZE, "Maximum vector size exceeded");
@@ -821,6 +966,672 @@ static inline V fmodulo(V const numerator, double const denominator) {
     }
 }
 
+
+/*****************************************************************************
+*
+*          Compress and expand by boolean mask
+*
+*****************************************************************************/
+// compress_masked(a, m):   the elements of a for which m is true are packed
+//                          contiguously at the start of the result. The rest is zero
+// expand_masked(a, m):     the inverse of compress_masked. The first elements of a are
+//                          placed in the positions where m is true. The rest is zero
+// compress_store(p, a, m): store the elements of a for which m is true contiguously
+//                          at p. Returns the number of elements stored. Nothing is
+//                          written beyond the stored elements
+// expand_load<V>(p, m):    load consecutive elements from p into the positions of a
+//                          vector of type V where m is true. The rest is zero. Returns
+//                          the vector. Nothing is read beyond the used elements
+//
+// These use the compress and expand instructions with AVX512 (AVX512VBMI2 for 8-bit
+// and 16-bit elements), otherwise pshufb or vpermd with a permutation derived from a
+// table. Example of a filter loop:
+// for (i = 0; i < n; i += 8) {
+//     Vec8f a = Vec8f().load(src + i);
+//     k += compress_store(dest + k, a, a > 0.f);
+// }
+
+// Table of packed 4-bit indexes for compressing and expanding 8 elements with mask m.
+// c[m] contains the position of each true bit in m in the consecutive nibbles.
+// e[m] contains in nibble i the number of true bits in m below bit i, if bit i is true.
+// Unused nibbles are 8
+struct CompressIndexTable {
+    uint32_t c[256];                             // compress table
+    uint32_t e[256];                             // expand table
+    constexpr CompressIndexTable() : c(), e() {
+        for (int m = 0; m < 256; m++) {
+            uint32_t cc = 0x88888888u, ee = 0x88888888u;
+            int k = 0;                           // number of true bits below i
+            for (int i = 0; i < 8; i++) {
+                if (m >> i & 1) {
+                    cc ^= uint32_t(i ^ 8) << 4 * k;
+                    ee ^= uint32_t(k ^ 8) << 4 * i;
+                    k++;
+                }
+            }
+            c[m] = cc;  e[m] = ee;
+        }
+    }
+};
+inline constexpr CompressIndexTable compress_index_table {};
+
+// Convert 8 packed nibbles to 8 bytes
+static inline uint64_t compress_nibbles_to_bytes(uint32_t const t) {
+    uint64_t x = t;
+    x = (x | x << 16) & 0x0000FFFF0000FFFFu;
+    x = (x | x << 8)  & 0x00FF00FF00FF00FFu;
+    x = (x | x << 4)  & 0x0F0F0F0F0F0F0F0Fu;
+    return x;
+}
+
+// Add offset to index bytes and make the unused bytes, which have the value 8,
+// negative so that pshufb sets the corresponding bytes to zero
+static inline uint64_t compress_index_bytes(uint64_t const x, uint64_t const offset = 0) {
+    return (x + offset * 0x0101010101010101u) | (x & 0x0808080808080808u) * 0x1F;
+}
+
+// Check if compress_expand can do vector type V without splitting it into halves
+template <typename V>
+constexpr bool compress_native() {
+    constexpr int esize = int(sizeof(V)) / V::size();  // element size
+#if INSTRSET >= 10 && defined (__AVX512VBMI2__)
+    constexpr bool vbmi2 = true;                 // compress and expand instructions for all element sizes
+#else
+    constexpr bool vbmi2 = false;
+#endif
+    if constexpr (sizeof(V) == 16) {
+        return true;
+    }
+    else if constexpr (sizeof(V) == 32) {
+        return vbmi2 || (INSTRSET >= 8 && esize >= 4);
+    }
+    else {
+        return vbmi2 || (INSTRSET >= 9 && esize >= 4);
+    }
+}
+
+#if INSTRSET >= 4
+// Permute 128-bit vector of 16-bit, 32-bit, or 64-bit elements with pshufb.
+// t contains the element indexes in packed nibbles. Elements with index 8 are set to zero
+template <int esize>
+static inline __m128i compress_permute_pshufb(__m128i const a, uint32_t const t) {
+    // element indexes
+    uint64_t b = compress_index_bytes(compress_nibbles_to_bytes(t));
+    __m128i idx = _mm_set_epi64x(0, int64_t(b));
+    // make byte indexes
+    if constexpr (esize == 2) {
+        idx = _mm_unpacklo_epi8(idx, idx);
+        idx = _mm_add_epi8(_mm_slli_epi16(idx, 1), _mm_set1_epi16(0x0100));
+    }
+    else if constexpr (esize == 4) {
+        idx = _mm_unpacklo_epi8(idx, idx);
+        idx = _mm_unpacklo_epi16(idx, idx);
+        idx = _mm_add_epi8(_mm_slli_epi32(idx, 2), _mm_set1_epi32(0x03020100));
+    }
+    else {
+        idx = _mm_unpacklo_epi8(idx, idx);
+        idx = _mm_unpacklo_epi16(idx, idx);
+        idx = _mm_unpacklo_epi32(idx, idx);
+        idx = _mm_add_epi8(_mm_slli_epi64(idx, 3), _mm_set1_epi64x(0x0706050403020100));
+    }
+    return _mm_shuffle_epi8(a, idx);
+}
+
+// Compress or expand 128-bit vector with pshufb
+template <bool expand, int esize>
+static inline __m128i compress_expand_pshufb(__m128i const a, uint32_t const m) {
+    uint32_t const * table = expand ? compress_index_table.e : compress_index_table.c;
+    if constexpr (esize == 1) {
+        __m128i idx;                             // pshufb index
+        // compress or expand each half and join
+        uint32_t c0 = vml_popcnt(m & 0xFF);      // number of elements in low half
+        uint64_t lo = compress_nibbles_to_bytes(table[m & 0xFF]);
+        uint64_t hi = compress_nibbles_to_bytes(table[(m >> 8) & 0xFF]);
+        if constexpr (expand) {                  // high half takes elements from position c0
+            idx = _mm_set_epi64x(int64_t(compress_index_bytes(hi, c0)), int64_t(compress_index_bytes(lo)));
+        }
+        else {                                   // high half goes to position c0
+            lo = compress_index_bytes(lo);
+            hi = compress_index_bytes(hi, 8);
+            uint64_t ilo, ihi;
+            if (c0 == 0) {
+                ilo = hi;  ihi = ~uint64_t(0);
+            }
+            else if (c0 == 8) {
+                ilo = lo;  ihi = hi;
+            }
+            else {
+                uint32_t s = c0 * 8;             // shift count
+                ilo = (lo & ((uint64_t(1) << s) - 1)) | hi << s;
+                ihi = hi >> (64 - s) | ~uint64_t(0) << s;
+            }
+            idx = _mm_set_epi64x(int64_t(ihi), int64_t(ilo));
+        }
+        return _mm_shuffle_epi8(a, idx);
+    }
+    else {
+        return compress_permute_pshufb<esize>(a, table[m & ((1u << (16 / esize)) - 1)]);
+    }
+}
+#endif
+
+#if INSTRSET >= 8
+// Permute 256-bit vector of 32-bit or 64-bit elements with vpermd.
+// t contains the element indexes in packed nibbles. Elements with index 8 are set to zero
+template <int esize>
+static inline __m256i compress_permute_permd(__m256i const a, uint32_t const t) {
+    __m256i idx;                                 // dword indexes
+    __m256i unused;                              // dwords that must be zero
+    if constexpr (esize == 4) {
+        idx = _mm256_cvtepu8_epi32(_mm_set_epi64x(0, int64_t(compress_nibbles_to_bytes(t))));
+        unused = _mm256_cmpgt_epi32(idx, _mm256_set1_epi32(7));
+    }
+    else {
+        __m256i q = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(int(compress_nibbles_to_bytes(t))));
+        idx = _mm256_or_si256(_mm256_slli_epi64(q, 1), _mm256_slli_epi64(q, 33));
+        idx = _mm256_add_epi64(idx, _mm256_set1_epi64x(int64_t(0x100000000)));
+        unused = _mm256_cmpgt_epi64(q, _mm256_set1_epi64x(7));
+    }
+    return _mm256_andnot_si256(unused, _mm256_permutevar8x32_epi32(a, idx));
+}
+
+// Compress or expand 256-bit vector of 32-bit or 64-bit elements with vpermd
+template <bool expand, int esize>
+static inline __m256i compress_expand_permd(__m256i const a, uint32_t const m) {
+    uint32_t const * table = expand ? compress_index_table.e : compress_index_table.c;
+    return compress_permute_permd<esize>(a, table[m & ((1u << (32 / esize)) - 1)]);
+}
+#endif
+
+// Compress or expand signed integer vector a with mask bits m
+template <bool expand, typename V>
+static inline V compress_expand(V const a, uint64_t const m) {
+    typedef typename vector_traits<V>::element_type T;
+    constexpr int n = V::size();                 // number of elements
+    if constexpr (!compress_native<V>()) {
+        // split into two halves
+        typedef decltype(a.get_low()) VH;        // half size vector
+        uint64_t mlo = m & ((uint64_t(1) << n / 2) - 1);  // mask for low half
+        int c0 = (int)vml_popcnt(mlo);           // number of elements in low half
+        T buf[n];
+        if constexpr (expand) {
+            a.store(buf);
+            return V(compress_expand<true>(a.get_low(), mlo), compress_expand<true>(VH().load(buf + c0), m >> n / 2));
+        }
+        else {
+            VH(0).store(buf + n / 2);
+            compress_expand<false>(a.get_low(), mlo).store(buf);
+            compress_expand<false>(a.get_high(), m >> n / 2).store(buf + c0);
+            return V().load(buf);
+        }
+    }
+    else if constexpr (sizeof(V) == 16) {
+#if INSTRSET >= 10
+        if constexpr (sizeof(T) == 4) {
+            return expand ? _mm_maskz_expand_epi32(__mmask8(m), a) : _mm_maskz_compress_epi32(__mmask8(m), a);
+        }
+        if constexpr (sizeof(T) == 8) {
+            return expand ? _mm_maskz_expand_epi64(__mmask8(m), a) : _mm_maskz_compress_epi64(__mmask8(m), a);
+        }
+#if defined (__AVX512VBMI2__)
+        if constexpr (sizeof(T) == 1) {
+            return expand ? _mm_maskz_expand_epi8(__mmask16(m), a) : _mm_maskz_compress_epi8(__mmask16(m), a);
+        }
+        if constexpr (sizeof(T) == 2) {
+            return expand ? _mm_maskz_expand_epi16(__mmask8(m), a) : _mm_maskz_compress_epi16(__mmask8(m), a);
+        }
+#endif
+#endif
+#if INSTRSET >= 4   // SSSE3
+        return compress_expand_pshufb<expand, int(sizeof(T))>(a, uint32_t(m));
+#else
+        T x[n], y[n] = {0};
+        a.store(x);
+        for (int i = 0, k = 0; i < n; i++) {
+            if (m >> i & 1) {
+                if constexpr (expand) y[i] = x[k++];
+                else y[k++] = x[i];
+            }
+        }
+        return V().load(y);
+#endif
+    }
+    else if constexpr (sizeof(V) == 32) {
+#if INSTRSET >= 10
+        if constexpr (sizeof(T) == 4) {
+            return expand ? _mm256_maskz_expand_epi32(__mmask8(m), a) : _mm256_maskz_compress_epi32(__mmask8(m), a);
+        }
+        if constexpr (sizeof(T) == 8) {
+            return expand ? _mm256_maskz_expand_epi64(__mmask8(m), a) : _mm256_maskz_compress_epi64(__mmask8(m), a);
+        }
+#if defined (__AVX512VBMI2__)
+        if constexpr (sizeof(T) == 1) {
+            return expand ? _mm256_maskz_expand_epi8(__mmask32(m), a) : _mm256_maskz_compress_epi8(__mmask32(m), a);
+        }
+        if constexpr (sizeof(T) == 2) {
+            return expand ? _mm256_maskz_expand_epi16(__mmask16(m), a) : _mm256_maskz_compress_epi16(__mmask16(m), a);
+        }
+#endif
+#endif
+#if INSTRSET >= 8
+        if constexpr (sizeof(T) >= 4) return compress_expand_permd<expand, int(sizeof(T))>(a, uint32_t(m));
+#endif
+    }
+#if MAX_VECTOR_SIZE >= 512 && INSTRSET >= 9
+    else {
+        if constexpr (sizeof(T) == 4) {
+            return expand ? _mm512_maskz_expand_epi32(__mmask16(m), a) : _mm512_maskz_compress_epi32(__mmask16(m), a);
+        }
+        if constexpr (sizeof(T) == 8) {
+            return expand ? _mm512_maskz_expand_epi64(__mmask8(m), a) : _mm512_maskz_compress_epi64(__mmask8(m), a);
+        }
+#if INSTRSET >= 10 && defined (__AVX512VBMI2__)
+        if constexpr (sizeof(T) == 1) {
+            return expand ? _mm512_maskz_expand_epi8(__mmask64(m), a) : _mm512_maskz_compress_epi8(__mmask64(m), a);
+        }
+        if constexpr (sizeof(T) == 2) {
+            return expand ? _mm512_maskz_expand_epi16(__mmask32(m), a) : _mm512_maskz_compress_epi16(__mmask32(m), a);
+        }
+#endif
+    }
+#endif
+}
+
+// Store compressed signed integer vector. Returns the number of elements stored
+template <typename V>
+static inline int compress_store_bits(void * p, V const a, uint64_t const m) {
+    if constexpr (!compress_native<V>()) {
+        constexpr int h = V::size() / 2;         // half number of elements
+        typedef typename vector_traits<V>::element_type T;
+        int c0 = compress_store_bits(p, a.get_low(), m & ((uint64_t(1) << h) - 1));
+        return c0 + compress_store_bits((T*)p + c0, a.get_high(), m >> h);
+    }
+    else {
+        int c = (int)vml_popcnt(m);
+        compress_expand<false>(a, m).store_partial(c, p);
+        return c;
+    }
+}
+
+// Load and expand signed integer vector
+template <typename V>
+static inline V expand_load_bits(void const * p, uint64_t const m) {
+    if constexpr (!compress_native<V>()) {
+        constexpr int h = V::size() / 2;         // half number of elements
+        typedef typename vector_traits<V>::element_type T;
+        typedef decltype(V().get_low()) VH;      // half size vector
+        uint64_t mlo = m & ((uint64_t(1) << h) - 1);
+        int c0 = (int)vml_popcnt(mlo);
+        return V(expand_load_bits<VH>(p, mlo), expand_load_bits<VH>((T const*)p + c0, m >> h));
+    }
+    else {
+        return compress_expand<true>(V().load_partial((int)vml_popcnt(m), p), m);
+    }
+}
+
+// Get mask bits from boolean vector. Unused bits are removed because
+// some boolean vector types have more bits than elements
+template <typename VB>
+static inline uint64_t compress_mask_bits(VB const m) {
+    return uint64_t(to_bits(m)) & ((uint64_t(2) << (VB::size() - 1)) - 1);
+}
+
+// pack the elements of a for which m is true contiguously at the start. The rest is zero
+template <typename V>
+static inline V compress_masked(V const a, typename vector_traits<V>::boolean_vector const m) {
+    return from_int_vector<V>(compress_expand<false>(to_int_vector(a), compress_mask_bits(m)));
+}
+
+// place the first elements of a into the positions where m is true. The rest is zero
+template <typename V>
+static inline V expand_masked(V const a, typename vector_traits<V>::boolean_vector const m) {
+    return from_int_vector<V>(compress_expand<true>(to_int_vector(a), compress_mask_bits(m)));
+}
+
+// store the elements of a for which m is true contiguously at p.
+// Returns the number of elements stored
+template <typename V>
+static inline int compress_store(typename vector_traits<V>::element_type * p, V const a,
+    typename vector_traits<V>::boolean_vector const m) {
+    return compress_store_bits(p, to_int_vector(a), compress_mask_bits(m));
+}
+
+// load consecutive elements from p into the positions where m is true. The rest is zero
+template <typename V>
+static inline V expand_load(typename vector_traits<V>::element_type const * p,
+    typename vector_traits<V>::boolean_vector const m) {
+    typedef typename vector_traits<V>::int_vector VI;
+    return from_int_vector<V>(expand_load_bits<VI>(p, compress_mask_bits(m)));
+}
+
+
+/*****************************************************************************
+*
+*          Interleaved load and store
+*
+*****************************************************************************/
+// load_interleaved<K>(p, a, b, ...) loads an array of structures with K members
+// of the same type into K vectors with one member in each vector:
+// a = (p[0], p[K], p[2K], ...), b = (p[1], p[K+1], p[2K+1], ...), etc.
+// store_interleaved<K>(p, a, b, ...) stores K vectors in the opposite way.
+// K can be 2, 3, or 4. The number of elements read or written is K * a.size().
+//
+// Example: convert 16 RGB pixels to planes:
+// Vec16uc r, g, b;
+// load_interleaved<3>(rgb, r, g, b);
+//
+// The shuffling is done with the blend templates, which choose the best
+// instructions for each instruction set. Vectors bigger than 128 bits are read
+// and written in 128-bit pieces ordered so that no data has to cross 128-bit
+// lanes, except when the instruction set has fast two-vector permutes across
+// lanes for the element size.
+
+// Decide whether interleaving of vector type V is done in 128-bit lanes
+template <typename V>
+constexpr bool interleave_lanes() {
+    constexpr int esize = sizeof(typename vector_traits<V>::element_type);
+    if constexpr (V::size() * esize <= 16) {
+        return false;                            // only one lane
+    }
+    else {
+#if INSTRSET >= 10 && defined(__AVX512VBMI__)
+        return false;                            // vpermt2b, vpermt2w, vpermt2d, vpermt2q
+#elif INSTRSET >= 10
+        return esize == 1;                       // vpermt2w, vpermt2d, vpermt2q
+#else
+        return true;                             // permutes across lanes are expensive
+#endif
+    }
+}
+
+// Index into the concatenation of the K vectors read from memory for element i
+// of deinterleaved vector j. n = vector size, n0 = elements per lane
+constexpr int interleave_load_index(int K, int j, int i, int n, int n0) {
+    int q = K * (i % n0) + j;                    // position in the lane of the K vectors
+    return q / n0 * n + i / n0 * n0 + q % n0;
+}
+
+// Index into the concatenation of the K vectors to interleave for element i
+// of vector m to write to memory. n = vector size, n0 = elements per lane
+constexpr int interleave_store_index(int K, int m, int i, int n, int n0) {
+    int q = m * n0 + i % n0;                     // position in the lane of the K vectors
+    return q % K * n + i / n0 * n0 + q / K;
+}
+
+// Select the elements with the indexes S from the concatenation of v[0] ... v[K-1], K = 2 or 3
+template <int K, typename V, int ... S, int ... I>
+static inline V interleave_select(V const v[], std::integer_sequence<int, S...>, std::integer_sequence<int, I...>) {
+    constexpr int n = sizeof...(I);
+    V t = blend_n<(S < 2 * n ? S : V_DC)...>(v[0], v[1]);
+    if constexpr (K == 3) {
+        t = blend_n<(S < 2 * n ? I : S - n)...>(t, v[2]);
+    }
+    return t;
+}
+
+// Deinterleave the K vectors v into d
+template <int K, typename V, int ... I>
+static inline void interleave_split(V const v[], V d[], std::integer_sequence<int, I...> s) {
+    constexpr int n = sizeof...(I);
+    constexpr int n0 = interleave_lanes<V>() ? 16 / sizeof(typename vector_traits<V>::element_type) : n;
+    if constexpr (K == 4) {
+        // split into even and odd elements twice
+        V w[4], e[2], o[2];
+        interleave_split<2>(v, w, s);
+        interleave_split<2>(v + 2, w + 2, s);
+        V we[2] = {w[0], w[2]}, wo[2] = {w[1], w[3]};
+        interleave_split<2>(we, e, s);
+        interleave_split<2>(wo, o, s);
+        d[0] = e[0];  d[1] = o[0];  d[2] = e[1];  d[3] = o[1];
+    }
+    else {
+        d[0] = interleave_select<K>(v, std::integer_sequence<int, interleave_load_index(K, 0, I, n, n0)...>(), s);
+        d[1] = interleave_select<K>(v, std::integer_sequence<int, interleave_load_index(K, 1, I, n, n0)...>(), s);
+        if constexpr (K == 3) {
+            d[2] = interleave_select<K>(v, std::integer_sequence<int, interleave_load_index(K, 2, I, n, n0)...>(), s);
+        }
+    }
+}
+
+// Interleave the K vectors v into d
+template <int K, typename V, int ... I>
+static inline void interleave_join(V const v[], V d[], std::integer_sequence<int, I...> s) {
+    constexpr int n = sizeof...(I);
+    constexpr int n0 = interleave_lanes<V>() ? 16 / sizeof(typename vector_traits<V>::element_type) : n;
+    if constexpr (K == 4) {
+        // interleave pairs twice
+        V x[4], y[2], z[2];
+        V ac[2] = {v[0], v[2]}, bd[2] = {v[1], v[3]};
+        interleave_join<2>(ac, x, s);
+        interleave_join<2>(bd, x + 2, s);
+        V x0[2] = {x[0], x[2]}, x1[2] = {x[1], x[3]};
+        interleave_join<2>(x0, y, s);
+        interleave_join<2>(x1, z, s);
+        d[0] = y[0];  d[1] = y[1];  d[2] = z[0];  d[3] = z[1];
+    }
+    else {
+        d[0] = interleave_select<K>(v, std::integer_sequence<int, interleave_store_index(K, 0, I, n, n0)...>(), s);
+        d[1] = interleave_select<K>(v, std::integer_sequence<int, interleave_store_index(K, 1, I, n, n0)...>(), s);
+        if constexpr (K == 3) {
+            d[2] = interleave_select<K>(v, std::integer_sequence<int, interleave_store_index(K, 2, I, n, n0)...>(), s);
+        }
+    }
+}
+
+// Reinterpret integer vector x as integer vector type V of the same size
+template <typename V, typename W>
+static inline V interleave_cast(W const x) {
+    if constexpr (sizeof(V) <= 32) {
+        return V(x);
+    }
+    else {
+        typedef decltype(V().get_low()) H;       // half size vector
+        return V(H(x.get_low()), H(x.get_high()));
+    }
+}
+
+// Reinterpret integer vector x as a vector of 32-bit integers
+template <typename V>
+static inline auto interleave_int32(V const x) {
+    constexpr int bytes = V::size() * sizeof(typename vector_traits<V>::element_type);
+    if constexpr (bytes == 16) {
+        return interleave_cast<Vec4i>(x);
+    }
+#if MAX_VECTOR_SIZE >= 256
+    else if constexpr (bytes == 32) {
+        return interleave_cast<Vec8i>(x);
+    }
+#endif
+#if MAX_VECTOR_SIZE >= 512
+    else {
+        return interleave_cast<Vec16i>(x);
+    }
+#endif
+}
+
+// Gather the elements of each structure member into 32-bit blocks within each group
+// of K 32-bit blocks, or do the opposite if inverse is true. For elements smaller than 32 bits
+template <int K, bool inverse, typename V, int ... I>
+static inline V interleave_group(V const a, std::integer_sequence<int, I...>) {
+    constexpr int g = 4 / sizeof(typename vector_traits<V>::element_type);  // elements per 32-bit block
+    if constexpr (inverse) {
+        return permute_n<(I / (K * g) * (K * g) + I % K * g + I % (K * g) / K)...>(a);
+    }
+    else {
+        return permute_n<(I / (K * g) * (K * g) + I % g * K + I % (K * g) / g)...>(a);
+    }
+}
+
+// Load vector m of K vectors, where 128-bit lane l comes from 128-bit piece number l*K + m of p
+template <int K, typename V, typename T>
+static inline V interleave_load_lanes(T const * p, int m) {
+    if constexpr (sizeof(V) == 16) {
+        V x;
+        x.load(p + 16 / sizeof(T) * m);
+        return x;
+    }
+    else {
+        typedef decltype(V().get_low()) H;       // half size vector
+        constexpr int h = sizeof(V) / 32;        // number of lanes in half vector
+        return V(interleave_load_lanes<K, H>(p, m), interleave_load_lanes<K, H>(p, m + K * h));
+    }
+}
+
+// Store vector m of K vectors, where 128-bit lane l goes to 128-bit piece number l*K + m of p
+template <int K, typename V, typename T>
+static inline void interleave_store_lanes(T * p, int m, V const x) {
+    if constexpr (sizeof(V) == 16) {
+        x.store(p + 16 / sizeof(T) * m);
+    }
+    else {
+        constexpr int h = sizeof(V) / 32;        // number of lanes in half vector
+        interleave_store_lanes<K>(p, m, x.get_low());
+        interleave_store_lanes<K>(p, m + K * h, x.get_high());
+    }
+}
+
+// Read K vectors from p. Vectors to interleave in 128-bit lanes are read in 128-bit pieces
+template <int K, typename V, int ... M>
+static inline void interleave_read(typename vector_traits<V>::element_type const * p, V v[], std::integer_sequence<int, M...>) {
+    if constexpr (interleave_lanes<V>()) {
+        ((v[M] = interleave_load_lanes<K, V>(p, M)), ...);
+    }
+    else {
+        (v[M].load(p + M * V::size()), ...);
+    }
+}
+
+// Write K vectors to p. Vectors to interleave in 128-bit lanes are written in 128-bit pieces
+template <int K, typename V, int ... M>
+static inline void interleave_write(typename vector_traits<V>::element_type * p, V const v[], std::integer_sequence<int, M...>) {
+    if constexpr (interleave_lanes<V>()) {
+        (interleave_store_lanes<K>(p, M, v[M]), ...);
+    }
+    else {
+        (v[M].store(p + M * V::size()), ...);
+    }
+}
+
+// Load and deinterleave K vectors from p into d
+template <typename V, int ... M>
+static inline void interleave_load(typename vector_traits<V>::element_type const * p, V d[], std::integer_sequence<int, M...> k) {
+    constexpr int K = sizeof...(M);
+    constexpr int n = V::size();
+    if constexpr (sizeof(typename vector_traits<V>::element_type) < 4 && K != 3) {
+        // deinterleave 32-bit blocks and gather the elements of each member within the blocks
+        typedef decltype(interleave_int32(V())) VW;
+        VW w[K], dw[K];
+        interleave_read<K>((int32_t const *)p, w, k);
+        ((w[M] = interleave_int32(interleave_group<K, false>(interleave_cast<V>(w[M]), std::make_integer_sequence<int, n>()))), ...);
+        interleave_split<K>(w, dw, std::make_integer_sequence<int, VW::size()>());
+        ((d[M] = interleave_cast<V>(dw[M])), ...);
+    }
+    else {
+        V v[K];
+        interleave_read<K>(p, v, k);
+        interleave_split<K>(v, d, std::make_integer_sequence<int, n>());
+    }
+}
+
+// Interleave the K vectors v and store them to p
+template <typename V, int ... M>
+static inline void interleave_store(typename vector_traits<V>::element_type * p, V const v[], std::integer_sequence<int, M...> k) {
+    constexpr int K = sizeof...(M);
+    constexpr int n = V::size();
+    if constexpr (sizeof(typename vector_traits<V>::element_type) < 4 && K != 3) {
+        // interleave 32-bit blocks and spread the elements within the blocks
+        typedef decltype(interleave_int32(V())) VW;
+        VW w[K] = {interleave_int32(v[M])...}, dw[K];
+        interleave_join<K>(w, dw, std::make_integer_sequence<int, VW::size()>());
+        ((dw[M] = interleave_int32(interleave_group<K, true>(interleave_cast<V>(dw[M]), std::make_integer_sequence<int, n>()))), ...);
+        interleave_write<K>((int32_t *)p, dw, k);
+    }
+    else {
+        V d[K];
+        interleave_join<K>(v, d, std::make_integer_sequence<int, n>());
+        interleave_write<K>(p, d, k);
+    }
+}
+
+// load K vectors from an array of structures with K members of the same type
+template <int K, typename V, typename ... R>
+static inline void load_interleaved(typename vector_traits<V>::element_type const * p, V & a, R & ... r) {
+    static_assert(K >= 2 && K <= 4, "load_interleaved supports 2, 3, or 4 vectors");
+    static_assert(sizeof...(R) + 1 == K && (std::is_same<V, R>::value && ...),
+        "load_interleaved<K> needs K vectors of the same type");
+    V d[K];
+    interleave_load(p, d, std::make_integer_sequence<int, K>());
+    a = d[0];
+    int j = 1;
+    ((r = d[j++]), ...);
+}
+
+// store K vectors to an array of structures with K members of the same type
+template <int K, typename V, typename ... R>
+static inline void store_interleaved(typename vector_traits<V>::element_type * p, V const a, R const ... r) {
+    static_assert(K >= 2 && K <= 4, "store_interleaved supports 2, 3, or 4 vectors");
+    static_assert(sizeof...(R) + 1 == K && (std::is_same<V, R>::value && ...),
+        "store_interleaved<K> needs K vectors of the same type");
+    V const v[K] = {a, r...};
+    interleave_store(p, v, std::make_integer_sequence<int, K>());
+}
+
+
+/*****************************************************************************
+*
+*          Prefix sums
+*
+*****************************************************************************/
+// prefix_sum(a) gives the inclusive scan of a: element i is a[0] + a[1] + ... + a[i].
+// prefix_sum_exclusive(a) gives the exclusive scan: element i is a[0] + ... + a[i-1],
+// and element 0 is 0.
+// The sum is made in log2(N) steps, each adding a copy of the vector shifted up by
+// 1, 2, 4, ... elements. Floating point results may therefore differ slightly from
+// a sequential sum. Integer sums wrap around on overflow.
+// The functions work for integer and floating point vectors of any size
+
+// Shift the elements of a up by k places and add
+template <int K, typename V, int ... I>
+static inline V prefix_sum_step(V const a, std::integer_sequence<int, I...> s) {
+    if constexpr (K >= int(sizeof...(I))) {
+        return a;
+    }
+    else {
+        return prefix_sum_step<K * 2>(a + permute_n<(I >= K ? I - K : -1)...>(a), s);
+    }
+}
+
+// Broadcast the last element of a to all elements
+template <typename V, int ... I>
+static inline V broadcast_last(V const a, std::integer_sequence<int, I...>) {
+    return permute_n<(I * 0 + int(sizeof...(I)) - 1)...>(a);
+}
+
+// Broadcast the last element of a to all elements
+template <typename V>
+static inline V broadcast_last(V const a) {
+    return broadcast_last(a, std::make_integer_sequence<int, V::size()>());
+}
+
+// Inclusive prefix sum
+template <typename V>
+static inline V prefix_sum(V const a) {
+    return prefix_sum_step<1>(a, std::make_integer_sequence<int, V::size()>());
+}
+
+// Shift the elements of a up by one place, inserting zero
+template <typename V, int ... I>
+static inline V prefix_shift_up(V const a, std::integer_sequence<int, I...>) {
+    return permute_n<(I - 1)...>(a);             // index -1 gives zero
+}
+
+// Exclusive prefix sum
+template <typename V>
+static inline V prefix_sum_exclusive(V const a) {
+    return prefix_shift_up(prefix_sum(a), std::make_integer_sequence<int, V::size()>());
+}
+
+
 #ifdef VCL_NAMESPACE
 }
 #endif
@@ -0,0 +1,287 @@
+/****************************  vector_convert16.h   **************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining functions for converting arrays of single precision
+* floats to and from the 16-bit floating point formats float16 and bfloat16.
+* The 16-bit numbers are stored as arrays of uint16_t bit patterns.
+*
+* Functions defined here:
+* convert_f32_to_f16<R>(src, dst, n)    Convert n floats to float16
+* convert_f16_to_f32(src, dst, n)       Convert n float16 numbers to float
+* convert_f32_to_bf16<R>(src, dst, n)   Convert n floats to bfloat16
+* convert_bf16_to_f32(src, dst, n)      Convert n bfloat16 numbers to float
+*
+* The following functions convert one vector, giving the bit patterns as 16-bit integers:
+* f32_to_f16_bits<R>(Vec8f), f32_to_f16_bits<R>(Vec16f)     float to float16
+* f16_bits_to_f32(Vec8us),   f16_bits_to_f32(Vec16us)       float16 to float
+* f32_to_bf16_bits<R>(Vec8f), f32_to_bf16_bits<R>(Vec16f)   float to bfloat16
+* bf16_bits_to_f32(Vec8us),  bf16_bits_to_f32(Vec16us)      bfloat16 to float
+*
+* The template parameter R is the rounding mode. The values are the same as
+* for the rounding control of the vcvtps2ph instruction:
+* R = 0: round to nearest or even (default)
+* R = 1: round down towards minus infinity
+* R = 2: round up towards plus infinity
+* R = 3: truncate towards zero
+* Values that are too big are converted to infinity or to the largest finite
+* value, depending on the rounding direction. NAN stays NAN.
+*
+* The float16 conversions use the F16C instructions if the code is compiled
+* for F16C (-mf16c), or the AVX512F instructions. Otherwise they are emulated.
+* The bfloat16 conversions use the AVX512_BF16 instructions for rounding mode
+* 0 where available, as described in vectorbf16.h.
+*
+* The array functions use non-temporal stores when the destination array is
+* bigger than convert16_stream_limit. This avoids polluting the cache with data
+* that will not be read again soon, and avoids reading the destination into
+* the cache before it is overwritten. The source and destination must not overlap.
+*
+* Example:
+* // convert a big array of float16 numbers, rounding towards zero
+* convert_f32_to_f16<3>(floats, halfs, n);
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_CONVERT16_H
+#define VECTOR_CONVERT16_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include "vectorfp16.h"
+#include "vectorbf16.h"
+
+#include <stddef.h>                    // define size_t
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+// Use non-temporal stores when the destination array is bigger than this number of bytes
+const size_t convert16_stream_limit = 0x400000;
+
+
+/*****************************************************************************
+*
+*          Conversion of a single vector between float and float16
+*
+*****************************************************************************/
+
+#ifndef __F16C__
+// Correction of a float16 or bfloat16 result rounded to nearest, for the directed
+// rounding modes. x is the exact value, and h is the rounded result converted back
+// to float. The return value is added to the bit pattern of the result:
+// 1 increases the magnitude by one unit in the last place, -1 decreases it.
+template <int R>
+static inline Vec8s f16_round_correction(Vec8f const x, Vec8f const h) {
+    Vec8f down = select(sign_bit(x), Vec8f(1.f), Vec8f(-1.f));  // makes the value smaller
+    Vec8f d;
+    if constexpr (R == 1) {
+        d = select(h > x, down, Vec8f(0.f));
+    }
+    else if constexpr (R == 2) {
+        d = select(h < x, -down, Vec8f(0.f));
+    }
+    else {
+        d = select(abs(h) > abs(x), Vec8f(-1.f), Vec8f(0.f));
+    }
+    return compress(truncatei(d));
+}
+#endif
+
+// Convert float to float16 with rounding mode R. Returns the bit patterns
+template <int R = 0>
+static inline Vec8us f32_to_f16_bits(Vec8f const x) {
+    static_assert(R >= 0 && R <= 3, "rounding mode must be 0 - 3");
+#ifdef __F16C__
+    return _mm256_cvtps_ph(x, R);
+#else
+    Vec8us h = __m128i(to_float16(x));           // round to nearest or even
+    if constexpr (R != 0) {
+        h += Vec8us(f16_round_correction<R>(x, to_float(Vec8h(__m128i(h)))));
+    }
+    return h;
+#endif
+}
+
+// Convert float16 bit patterns to float
+static inline Vec8f f16_bits_to_f32(Vec8us const h) {
+#ifdef __F16C__
+    return _mm256_cvtph_ps(h);
+#else
+    return to_float(Vec8h(__m128i(h)));
+#endif
+}
+
+#if MAX_VECTOR_SIZE >= 512
+template <int R = 0>
+static inline Vec16us f32_to_f16_bits(Vec16f const x) {
+    static_assert(R >= 0 && R <= 3, "rounding mode must be 0 - 3");
+#if INSTRSET >= 9
+    return _mm512_cvtps_ph(x, R);
+#else
+    return Vec16us(f32_to_f16_bits<R>(x.get_low()), f32_to_f16_bits<R>(x.get_high()));
+#endif
+}
+
+static inline Vec16f f16_bits_to_f32(Vec16us const h) {
+#if INSTRSET >= 9
+    return _mm512_cvtph_ps(h);
+#else
+    return Vec16f(f16_bits_to_f32(h.get_low()), f16_bits_to_f32(h.get_high()));
+#endif
+}
+#endif // MAX_VECTOR_SIZE >= 512
+
+
+/*****************************************************************************
+*
+*          Conversion of a single vector between float and bfloat16
+*
+*****************************************************************************/
+
+// Round float to bfloat16 with directed rounding mode R = 1 - 3, using integer
+// operations. Returns the bit patterns in the low half of each 32-bit element
+template <int R, typename VI, typename VF>
+static inline VI bf16_round_bits_directed(VF const x) {
+    VI a = VI(reinterpret_i(x));                 // bit-cast to integer
+    VI t = a >> 16;                              // truncated towards zero
+    VI r = t;
+    if constexpr (R != 3) {
+        // increase magnitude if inexact and the rounding direction is away from zero
+        auto inexact = (a & 0xFFFF) != 0;
+        auto away = R == 1 ? a < 0 : a >= 0;
+        r = if_add(inexact & away, t, 1);
+    }
+    return select(decltype(a > a)(is_nan(x)), t | 0x40, r); // make sure NAN stays NAN
+}
+
+// Convert float to bfloat16 with rounding mode R. Returns the bit patterns
+template <int R = 0>
+static inline Vec8us f32_to_bf16_bits(Vec8f const x) {
+    static_assert(R >= 0 && R <= 3, "rounding mode must be 0 - 3");
+    if constexpr (R == 0) {
+        return __m128i(to_bfloat16(x));
+    }
+    else {
+        return Vec8us(compress(bf16_round_bits_directed<R, Vec8i>(x)));
+    }
+}
+
+// Convert bfloat16 bit patterns to float
+static inline Vec8f bf16_bits_to_f32(Vec8us const h) {
+    return to_float(Vec8bf(__m128i(h)));
+}
+
+#if MAX_VECTOR_SIZE >= 512
+template <int R = 0>
+static inline Vec16us f32_to_bf16_bits(Vec16f const x) {
+    static_assert(R >= 0 && R <= 3, "rounding mode must be 0 - 3");
+    if constexpr (R == 0) {
+        return Vec16us(Vec16s(to_bfloat16(x)));
+    }
+    else {
+#if INSTRSET >= 9
+        return Vec16us(compress(bf16_round_bits_directed<R, Vec16i>(x)));
+#else
+        return Vec16us(f32_to_bf16_bits<R>(x.get_low()), f32_to_bf16_bits<R>(x.get_high()));
+#endif
+    }
+}
+
+static inline Vec16f bf16_bits_to_f32(Vec16us const h) {
+    return to_float(Vec16bf(Vec8bf(__m128i(h.get_low())), Vec8bf(__m128i(h.get_high()))));
+}
+#endif // MAX_VECTOR_SIZE >= 512
+
+
+/*****************************************************************************
+*
+*          Conversion of arrays
+*
+*****************************************************************************/
+
+// Vector classes used for the array conversions
+#if INSTRSET >= 9 && MAX_VECTOR_SIZE >= 512
+typedef Vec16f  convert16_vf;
+typedef Vec16us convert16_vh;
+#else
+typedef Vec8f   convert16_vf;
+typedef Vec8us  convert16_vh;
+#endif
+
+// Apply f to each vector block of src and store the result in dst.
+// VS is the vector class of the source, TS and TD are the element types
+template <typename VS, typename TS, typename TD, typename F>
+static inline void convert16_array(TS const * src, TD * dst, size_t n, F f) {
+    constexpr size_t N = VS::size();             // elements per vector
+    constexpr size_t B = N * sizeof(TD);         // bytes per destination vector
+    size_t i = 0;
+    VS v;
+    // use non-temporal stores if the destination is big
+    bool stream = n * sizeof(TD) > convert16_stream_limit && size_t(dst) % sizeof(TD) == 0;
+    if (stream) {
+        // convert the first elements with a partial store so that the rest of dst is aligned by B
+        size_t head = ((0 - size_t(dst)) & (B - 1)) / sizeof(TD);
+        if (head > 0) {
+            v.load_partial(int(head), src);
+            f(v).store_partial(int(head), dst);
+        }
+        for (i = head; i + N <= n; i += N) {
+            v.load(src + i);
+            f(v).store_nt(dst + i);
+        }
+    }
+    else {
+        for (; i + N <= n; i += N) {
+            v.load(src + i);
+            f(v).store(dst + i);
+        }
+    }
+    if (i < n) {                                 // remaining elements
+        v.load_partial(int(n - i), src + i);
+        f(v).store_partial(int(n - i), dst + i);
+    }
+    if (stream) {
+        _mm_sfence();                            // make non-temporal stores visible to other threads
+    }
+}
+
+// Convert n floats from src to float16 numbers in dst, with rounding mode R
+template <int R = 0>
+static inline void convert_f32_to_f16(float const * src, uint16_t * dst, size_t n) {
+    convert16_array<convert16_vf>(src, dst, n, [](convert16_vf x) {return f32_to_f16_bits<R>(x);});
+}
+
+// Convert n float16 numbers from src to floats in dst
+static inline void convert_f16_to_f32(uint16_t const * src, float * dst, size_t n) {
+    convert16_array<convert16_vh>(src, dst, n, [](convert16_vh h) {return f16_bits_to_f32(h);});
+}
+
+// Convert n floats from src to bfloat16 numbers in dst, with rounding mode R
+template <int R = 0>
+static inline void convert_f32_to_bf16(float const * src, uint16_t * dst, size_t n) {
+    convert16_array<convert16_vf>(src, dst, n, [](convert16_vf x) {return f32_to_bf16_bits<R>(x);});
+}
+
+// Convert n bfloat16 numbers from src to floats in dst
+static inline void convert_bf16_to_f32(uint16_t const * src, float * dst, size_t n) {
+    convert16_array<convert16_vh>(src, dst, n, [](convert16_vh h) {return bf16_bits_to_f32(h);});
+}
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_CONVERT16_H
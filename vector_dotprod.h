@@ -0,0 +1,321 @@
+/****************************  vector_dotprod.h   *****************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining integer dot product functions for quantized neural
+* network inference and similar applications, and a matrix multiplication
+* kernel for 8-bit integer matrices built on these functions.
+*
+* Functions defined here:
+* dot_accumulate(Vec4i  acc, Vec16uc a, Vec16c b)   acc[i] + sum of a[4i+j]*b[4i+j], j = 0..3
+* dot_accumulate(Vec8i  acc, Vec32uc a, Vec32c b)   same, 256 bit vectors
+* dot_accumulate(Vec16i acc, Vec64uc a, Vec64c b)   same, 512 bit vectors
+* dot_accumulate(Vec4i  acc, Vec8s   a, Vec8s  b)   acc[i] + a[2i]*b[2i] + a[2i+1]*b[2i+1]
+* dot_accumulate(Vec8i  acc, Vec16s  a, Vec16s b)   same, 256 bit vectors
+* dot_accumulate(Vec16i acc, Vec32s  a, Vec32s b)   same, 512 bit vectors
+* gemm_u8s8_pack_b(bp, b, ldb, K, N)                pack matrix B for gemm_u8s8
+* gemm_u8s8(M, N, K, a, lda, bp, c, ldc, accumulate) C = A * B with uint8 A, int8 B, int32 C
+*
+* The 8-bit version multiplies unsigned bytes of a with signed bytes of b.
+* The results are exact. The sums wrap around in case of overflow of the
+* 32-bit accumulator, but no saturation takes place.
+*
+* The dot_accumulate functions use the VNNI instructions vpdpbusd and vpdpwssd
+* if the code is compiled for AVX512_VNNI (-mavx512vnni) or AVX-VNNI (-mavxvnni).
+* Otherwise they are emulated with pmaddubsw and pmaddwd. The emulation needs
+* two pmaddubsw instructions for each vpdpbusd because a single pmaddubsw can
+* saturate when both bytes in a pair are big. Use hasAVX512VNNI() and hasAVXVNNI()
+* for detecting the instruction sets at runtime.
+*
+* Example:
+* // 16 dot products of 4 bytes each
+* Vec64uc a(...);  Vec64c b(...);
+* Vec16i sum = dot_accumulate(Vec16i(0), a, b);
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_DOTPROD_H
+#define VECTOR_DOTPROD_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include <string.h>                    // define memcpy
+#include <utility>                     // define std::integer_sequence
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*          Dot product of unsigned and signed 8-bit integers
+*
+*****************************************************************************/
+
+// acc[i] + a[4i]*b[4i] + a[4i+1]*b[4i+1] + a[4i+2]*b[4i+2] + a[4i+3]*b[4i+3]
+// a is unsigned, b is signed
+static inline Vec4i dot_accumulate(Vec4i const acc, Vec16uc const a, Vec16c const b) {
+#if defined(__AVX512VNNI__) && defined(__AVX512VL__)
+    return _mm_dpbusd_epi32(__m128i(acc), __m128i(a), __m128i(b));
+#elif defined(__AVXVNNI__)
+    return _mm_dpbusd_avx_epi32(__m128i(acc), __m128i(a), __m128i(b));
+#elif INSTRSET >= 4  // SSSE3
+    // split a into even and odd bytes so that pmaddubsw cannot saturate
+    __m128i mask = _mm_set1_epi16(0x00FF);
+    __m128i ae   = _mm_and_si128(a, mask);       // even bytes of a, odd bytes zero
+    __m128i ao   = _mm_andnot_si128(mask, a);    // odd bytes of a, even bytes zero
+    __m128i pe   = _mm_maddubs_epi16(ae, b);     // a[2j]*b[2j]
+    __m128i po   = _mm_maddubs_epi16(ao, b);     // a[2j+1]*b[2j+1]
+    __m128i one  = _mm_set1_epi16(1);
+    __m128i s    = _mm_add_epi32(_mm_madd_epi16(pe, one), _mm_madd_epi16(po, one));
+    return _mm_add_epi32(acc, s);
+#else  // SSE2
+    // zero-extend a and sign-extend b to 16 bits
+    __m128i ae   = _mm_and_si128(a, _mm_set1_epi16(0x00FF));
+    __m128i ao   = _mm_srli_epi16(a, 8);
+    __m128i be   = _mm_srai_epi16(_mm_slli_epi16(b, 8), 8);
+    __m128i bo   = _mm_srai_epi16(b, 8);
+    __m128i s    = _mm_add_epi32(_mm_madd_epi16(ae, be), _mm_madd_epi16(ao, bo));
+    return _mm_add_epi32(acc, s);
+#endif
+}
+
+#if MAX_VECTOR_SIZE >= 256
+static inline Vec8i dot_accumulate(Vec8i const acc, Vec32uc const a, Vec32c const b) {
+#if defined(__AVX512VNNI__) && defined(__AVX512VL__)
+    return _mm256_dpbusd_epi32(__m256i(acc), __m256i(a), __m256i(b));
+#elif defined(__AVXVNNI__)
+    return _mm256_dpbusd_avx_epi32(__m256i(acc), __m256i(a), __m256i(b));
+#elif INSTRSET >= 8  // AVX2
+    __m256i mask = _mm256_set1_epi16(0x00FF);
+    __m256i ae   = _mm256_and_si256(a, mask);
+    __m256i ao   = _mm256_andnot_si256(mask, a);
+    __m256i pe   = _mm256_maddubs_epi16(ae, b);
+    __m256i po   = _mm256_maddubs_epi16(ao, b);
+    __m256i one  = _mm256_set1_epi16(1);
+    __m256i s    = _mm256_add_epi32(_mm256_madd_epi16(pe, one), _mm256_madd_epi16(po, one));
+    return _mm256_add_epi32(acc, s);
+#else
+    return Vec8i(dot_accumulate(acc.get_low(),  a.get_low(),  b.get_low()),
+                 dot_accumulate(acc.get_high(), a.get_high(), b.get_high()));
+#endif
+}
+#endif // MAX_VECTOR_SIZE >= 256
+
+#if MAX_VECTOR_SIZE >= 512
+static inline Vec16i dot_accumulate(Vec16i const acc, Vec64uc const a, Vec64c const b) {
+#if defined(__AVX512VNNI__) && INSTRSET >= 10
+    return _mm512_dpbusd_epi32(__m512i(acc), __m512i(a), __m512i(b));
+#elif INSTRSET >= 10  // AVX512BW
+    __m512i mask = _mm512_set1_epi16(0x00FF);
+    __m512i ae   = _mm512_and_si512(a, mask);
+    __m512i ao   = _mm512_andnot_si512(mask, a);
+    __m512i pe   = _mm512_maddubs_epi16(ae, b);
+    __m512i po   = _mm512_maddubs_epi16(ao, b);
+    __m512i one  = _mm512_set1_epi16(1);
+    __m512i s    = _mm512_add_epi32(_mm512_madd_epi16(pe, one), _mm512_madd_epi16(po, one));
+    return _mm512_add_epi32(acc, s);
+#else
+    return Vec16i(dot_accumulate(acc.get_low(),  Vec32uc(a.get_low()),  b.get_low()),
+                  dot_accumulate(acc.get_high(), Vec32uc(a.get_high()), b.get_high()));
+#endif
+}
+#endif // MAX_VECTOR_SIZE >= 512
+
+
+/*****************************************************************************
+*
+*          Dot product of signed 16-bit integers
+*
+*****************************************************************************/
+
+// acc[i] + a[2i]*b[2i] + a[2i+1]*b[2i+1]
+static inline Vec4i dot_accumulate(Vec4i const acc, Vec8s const a, Vec8s const b) {
+#if defined(__AVX512VNNI__) && defined(__AVX512VL__)
+    return _mm_dpwssd_epi32(__m128i(acc), __m128i(a), __m128i(b));
+#elif defined(__AVXVNNI__)
+    return _mm_dpwssd_avx_epi32(__m128i(acc), __m128i(a), __m128i(b));
+#else
+    return _mm_add_epi32(acc, _mm_madd_epi16(a, b));
+#endif
+}
+
+#if MAX_VECTOR_SIZE >= 256
+static inline Vec8i dot_accumulate(Vec8i const acc, Vec16s const a, Vec16s const b) {
+#if defined(__AVX512VNNI__) && defined(__AVX512VL__)
+    return _mm256_dpwssd_epi32(__m256i(acc), __m256i(a), __m256i(b));
+#elif defined(__AVXVNNI__)
+    return _mm256_dpwssd_avx_epi32(__m256i(acc), __m256i(a), __m256i(b));
+#elif INSTRSET >= 8  // AVX2
+    return _mm256_add_epi32(acc, _mm256_madd_epi16(a, b));
+#else
+    return Vec8i(dot_accumulate(acc.get_low(),  a.get_low(),  b.get_low()),
+                 dot_accumulate(acc.get_high(), a.get_high(), b.get_high()));
+#endif
+}
+#endif // MAX_VECTOR_SIZE >= 256
+
+#if MAX_VECTOR_SIZE >= 512
+static inline Vec16i dot_accumulate(Vec16i const acc, Vec32s const a, Vec32s const b) {
+#if defined(__AVX512VNNI__) && INSTRSET >= 10
+    return _mm512_dpwssd_epi32(__m512i(acc), __m512i(a), __m512i(b));
+#elif INSTRSET >= 10  // AVX512BW
+    return _mm512_add_epi32(acc, _mm512_madd_epi16(a, b));
+#else
+    return Vec16i(dot_accumulate(acc.get_low(),  a.get_low(),  b.get_low()),
+                  dot_accumulate(acc.get_high(), a.get_high(), b.get_high()));
+#endif
+}
+#endif // MAX_VECTOR_SIZE >= 512
+
+
+/*****************************************************************************
+*
+*          Matrix multiplication of 8-bit integer matrices
+*
+******************************************************************************
+*
+* gemm_u8s8 computes C = A * B, or C += A * B if accumulate is true, where
+* A is an M x K matrix of unsigned bytes, B is a K x N matrix of signed bytes,
+* and C is an M x N matrix of 32-bit integers. All matrices are stored by rows.
+* lda and ldc are the row strides of A and C, counted as elements.
+*
+* B must first be packed with gemm_u8s8_pack_b. The packed matrix can be reused
+* for any number of A matrices, as is typical for the weights of a neural network.
+* The packed layout is the same for all instruction sets. It consists of panels
+* of 16 columns. Each panel contains, for every group of 4 rows of B, the 4 bytes
+* of column 0, then the 4 bytes of column 1, etc. This is the order that
+* dot_accumulate(Vec16i, Vec64uc, Vec64c) needs. K is rounded up to a multiple of
+* 4 and N to a multiple of 16 with zero padding.
+*
+* The micro-kernel keeps a block of rows x 16 columns of C in registers while it
+* runs through K. Each step broadcasts 4 bytes from each row of A and multiplies
+* them with 64 bytes of packed B.
+*
+*****************************************************************************/
+
+#if MAX_VECTOR_SIZE >= 512
+
+// Size in bytes of packed B matrix
+static inline size_t gemm_u8s8_packed_size(int K, int N) {
+    return size_t((K + 3) / 4) * size_t((N + 15) / 16) * 64;
+}
+
+// Pack K x N matrix b with row stride ldb into bp. bp must have gemm_u8s8_packed_size(K, N) bytes
+static inline void gemm_u8s8_pack_b(int8_t * bp, int8_t const * b, int ldb, int K, int N) {
+    int K4 = (K + 3) / 4;                        // number of groups of 4 rows
+    for (int j0 = 0; j0 < N; j0 += 16) {         // loop through panels
+        for (int k4 = 0; k4 < K4; k4++) {        // loop through groups of 4 rows
+            for (int j = 0; j < 16; j++) {
+                for (int kk = 0; kk < 4; kk++) {
+                    int k = k4 * 4 + kk;
+                    *bp++ = (k < K && j0 + j < N) ? b[size_t(k) * ldb + j0 + j] : int8_t(0);
+                }
+            }
+        }
+    }
+}
+
+// Number of rows of C in each block of the micro-kernel
+#if INSTRSET >= 9
+const int gemm_u8s8_rows = 8;                    // 32 vector registers
+#elif INSTRSET >= 8
+const int gemm_u8s8_rows = 4;                    // each Vec16i uses 2 registers
+#else
+const int gemm_u8s8_rows = 2;                    // each Vec16i uses 4 registers
+#endif
+
+// Read 4 bytes from p and broadcast them to all elements of a Vec64uc
+static inline Vec64uc gemm_u8s8_broadcast4(uint8_t const * p) {
+    int32_t x;
+    memcpy(&x, p, 4);
+#if INSTRSET >= 9
+    return Vec64uc(__m512i(Vec16i(x)));
+#else
+    return Vec64uc(Vec512b(Vec16i(x)));
+#endif
+}
+
+// One step of the micro-kernel: multiply 4 bytes from column k of each row J of A
+// with 64 bytes of packed B and add to accumulator J
+template <int ... J>
+static inline void gemm_u8s8_step(Vec16i acc[], uint8_t const * const ap[], int k, Vec64c const bv,
+std::integer_sequence<int, J...>) {
+    ((acc[J] = dot_accumulate(acc[J], gemm_u8s8_broadcast4(ap[J] + k), bv)), ...);
+}
+
+// Store or add accumulator J to row J of C if J < rows
+static inline void gemm_u8s8_store1(Vec16i acc, int cols, int32_t * cr, bool accumulate) {
+    if (accumulate) acc += Vec16i().load_partial(cols, cr);
+    acc.store_partial(cols, cr);
+}
+
+template <int ... J>
+static inline void gemm_u8s8_store(Vec16i const acc[], int rows, int cols, int32_t * c, int ldc, bool accumulate,
+std::integer_sequence<int, J...>) {
+    ((J < rows ? gemm_u8s8_store1(acc[J], cols, c + size_t(J) * ldc, accumulate) : void()), ...);
+}
+
+// Micro-kernel: compute a block of rows x cols of C. rows <= R, cols <= 16
+template <int R>
+static inline void gemm_u8s8_kernel(int rows, int cols, int K, uint8_t const * a, int lda,
+int8_t const * bp, int32_t * c, int ldc, bool accumulate) {
+    uint8_t const * ap[R];
+    Vec16i acc[R];
+    for (int r = 0; r < R; r++) {
+        // rows beyond the end repeat the last row. The results are discarded
+        ap[r] = a + size_t(r < rows ? r : rows - 1) * lda;
+        acc[r] = Vec16i(0);
+    }
+    int k = 0;
+    for (; k + 4 <= K; k += 4) {                 // loop through groups of 4 columns of A
+        gemm_u8s8_step(acc, ap, k, Vec64c().load(bp + k * 16), std::make_integer_sequence<int, R>());
+    }
+    if (k < K) {                                 // last incomplete group of 4
+        // copy to a zero-padded buffer to avoid reading beyond the end of the rows.
+        // Column k of A is column 0 of the buffer
+        uint8_t tail[R][4] = {};
+        for (int r = 0; r < R; r++) {
+            for (int kk = k; kk < K; kk++) tail[r][kk - k] = ap[r][kk];
+            ap[r] = tail[r];
+        }
+        gemm_u8s8_step(acc, ap, 0, Vec64c().load(bp + k * 16), std::make_integer_sequence<int, R>());
+    }
+    gemm_u8s8_store(acc, rows, cols, c, ldc, accumulate, std::make_integer_sequence<int, R>());
+}
+
+// C = A * B or C += A * B, where B has been packed with gemm_u8s8_pack_b
+static inline void gemm_u8s8(int M, int N, int K, uint8_t const * a, int lda,
+int8_t const * bp, int32_t * c, int ldc, bool accumulate = false) {
+    const int R = gemm_u8s8_rows;
+    size_t panel = size_t((K + 3) / 4) * 64;     // size of each panel of packed B
+    for (int j0 = 0; j0 < N; j0 += 16) {         // loop through panels of 16 columns
+        int cols = N - j0 < 16 ? N - j0 : 16;
+        int8_t const * bpj = bp + size_t(j0 / 16) * panel;
+        for (int i0 = 0; i0 < M; i0 += R) {      // loop through blocks of rows
+            int rows = M - i0 < R ? M - i0 : R;
+            gemm_u8s8_kernel<R>(rows, cols, K, a + size_t(i0) * lda, lda, bpj,
+                c + size_t(i0) * ldc + j0, ldc, accumulate);
+        }
+    }
+}
+
+#endif // MAX_VECTOR_SIZE >= 512
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_DOTPROD_H
@@ -0,0 +1,419 @@
+/***************************  vector_expression.h   ***************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining expression templates for elementwise operations on whole
+* arrays. An expression such as y = exp(a*x + b) * c, where x and y are arrays, is
+* evaluated in a single loop over the arrays, one vector block at a time. Each
+* array is loaded once and the result is stored once for each block, and no
+* temporary arrays are needed. Applying transform_vec once for each operation
+* would read and write the whole arrays for each operation, which is limited by
+* memory bandwidth for big arrays.
+* This header is optional. It is not included by vectorclass.h.
+*
+* Classes and functions defined here:
+* ArrayView<T>              Reference to an existing array of n elements of type T.
+*                           An expression assigned to an ArrayView is evaluated
+*                           and stored in the array
+* evaluate<V, U>(y, e)      Evaluate expression e into ArrayView y with vector
+*                           class V and unroll factor U
+* array_function(f, e...)   Expression that applies f to vector blocks of the
+*                           expressions e. f is called with one vector block
+*                           of each operand
+* Operators:                + - * / & | ^ < <= > >= == != && || and unary - ~ !
+*                           on expressions and scalars
+* Functions:                sqrt, abs, square, round, truncate, floor, ceil, exp,
+*                           exp2, exp10, expm1, log, log2, log10, log1p, cbrt,
+*                           sin, cos, tan, asin, acos, atan, sinh, cosh, tanh,
+*                           asinh, acosh, atanh, pow, atan2, min, max, mul_add,
+*                           select
+*
+* The operators and functions build an expression tree; nothing is calculated until
+* the expression is assigned to an ArrayView. The leaves of the tree are ArrayViews
+* and scalars. Each node applies the operator or function of the vector classes to
+* the vector blocks of its operands, so the results are the same as with the vector
+* classes. The math functions are the ones in vectormath_exp.h, vectormath_trig.h,
+* and vectormath_hyp.h or vectormath_lib.h. Include the math headers you need.
+*
+* The evaluation uses transform_vec from vector_array.h with one input array for
+* each ArrayView in the expression. The vector class is array_vector<T>::type
+* unless given explicitly with evaluate<V>. The last partial vector is handled
+* with load_partial and store_partial, as in transform_vec, and big output arrays
+* are written with non-temporal stores.
+*
+* All arrays in an expression must have at least as many elements as the
+* destination. The destination may be one of the arrays in the expression, for
+* example y += x, but it must not overlap partially with any of them. All arrays
+* and scalars in an expression must have the same element type. Scalars are
+* converted to this type.
+*
+* Assigning one ArrayView to another copies the elements. ArrayView does not own
+* the array; the array must exist as long as the ArrayView is used.
+*
+* Example:
+* #include "vector_expression.h"
+* #include "vectormath_exp.h"
+* float xdata[1000], ydata[1000];
+* ArrayView<float> x(xdata, 1000), y(ydata, 1000);
+* y = exp(2.f * x + 1.f) * 0.5f;         // one loop over x and y
+* y += select(x > 0.f, x, 0.f);          // another loop
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_EXPRESSION_H
+#define VECTOR_EXPRESSION_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include "vector_array.h"              // transform_vec, array_vector
+#include <stddef.h>                    // define size_t
+#include <tuple>                       // std::tuple, std::apply
+#include <type_traits>                 // std::enable_if
+#include <utility>                     // std::index_sequence
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*          Expression nodes
+*
+*****************************************************************************/
+// Each expression class has:
+// element_type:   the element type of the arrays
+// leaves:         the number of ArrayViews in the expression
+// arrays():       a std::tuple of pointers to the data of these ArrayViews
+// eval<V, K>(x...)  the value of the expression for one vector block. x are the
+//                 vector blocks of all the arrays of the whole expression, and K
+//                 is the index in x of the first array of this expression
+
+// Base class of all array expressions
+struct ArrayExpression {};
+
+template <typename E>
+struct is_array_expression : std::is_base_of<ArrayExpression, E> {};
+
+// Scalar operand. It is broadcast to all vector elements
+template <typename T>
+class ArrayScalar : public ArrayExpression {
+public:
+    typedef T element_type;
+    static constexpr int leaves = 0;
+    ArrayScalar(T const x) : value(x) {}
+    std::tuple<> arrays() const {
+        return std::tuple<>();
+    }
+    template <typename V, int K, typename ... X>
+    V eval(X const & ...) const {
+        return V(value);
+    }
+protected:
+    T value;
+};
+
+// Reference to an array of n elements
+template <typename T>
+class ArrayView : public ArrayExpression {
+public:
+    typedef typename std::remove_const<T>::type element_type;
+    static constexpr int leaves = 1;
+protected:
+    T * p;                                       // data
+    size_t n;                                    // number of elements
+public:
+    ArrayView(T * p, size_t n) : p(p), n(n) {}
+    // View of a container with data() and size(), e.g. std::vector or AlignedVector,
+    // or a view of non-const elements converted to a view of const elements
+    template <typename C, typename = decltype(std::declval<C &>().data()),
+        typename std::enable_if<!std::is_same<typename std::remove_const<C>::type, ArrayView>::value, int>::type = 0>
+    ArrayView(C & c) : p(c.data()), n(c.size()) {}
+    ArrayView(ArrayView const &) = default;
+    T * data() const {
+        return p;
+    }
+    size_t size() const {
+        return n;
+    }
+    T & operator [] (size_t i) const {
+        return p[i];
+    }
+    // View of m elements starting at index i
+    ArrayView sub(size_t i, size_t m) const {
+        return ArrayView(p + i, m);
+    }
+    std::tuple<element_type const *> arrays() const {
+        return std::tuple<element_type const *>(p);
+    }
+    template <typename V, int K, typename ... X>
+    V eval(X const & ... x) const {
+        return std::get<K>(std::tie(x...));
+    }
+    // Evaluate expression e and store the result in this array
+    template <typename E, typename std::enable_if<is_array_expression<E>::value, int>::type = 0>
+    ArrayView & operator = (E const & e) {
+        evaluate(*this, e);
+        return *this;
+    }
+    // Copy the elements of a
+    ArrayView & operator = (ArrayView const & a) {
+        evaluate(*this, a);
+        return *this;
+    }
+    // Set all elements to x
+    ArrayView & operator = (element_type const x) {
+        evaluate(*this, ArrayScalar<element_type>(x));
+        return *this;
+    }
+    template <typename E>
+    ArrayView & operator += (E const & e) {
+        return *this = *this + e;
+    }
+    template <typename E>
+    ArrayView & operator -= (E const & e) {
+        return *this = *this - e;
+    }
+    template <typename E>
+    ArrayView & operator *= (E const & e) {
+        return *this = *this * e;
+    }
+    template <typename E>
+    ArrayView & operator /= (E const & e) {
+        return *this = *this / e;
+    }
+};
+
+// Index of the first array of operand J: the number of arrays in the operands before J
+template <int J, typename ... E>
+constexpr int array_leaf_offset() {
+    int count[] = {0, E::leaves...};
+    int s = 0;
+    for (int k = 0; k <= J; k++) s += count[k];
+    return s;
+}
+
+// Function f applied to the vector blocks of the operands e
+template <typename F, typename ... E>
+class ArrayFunction : public ArrayExpression {
+public:
+    typedef typename std::tuple_element<0, std::tuple<E...>>::type::element_type element_type;
+    static_assert((std::is_same<typename E::element_type, element_type>::value && ...),
+        "All arrays and scalars in an expression must have the same element type");
+    static constexpr int leaves = (0 + ... + E::leaves);
+protected:
+    F f;                                         // function
+    std::tuple<E...> operands;
+    template <typename V, int K, size_t ... J, typename ... X>
+    auto eval_operands(std::index_sequence<J...>, X const & ... x) const {
+        return f(std::get<J>(operands).template eval<V, K + array_leaf_offset<int(J), E...>()>(x...)...);
+    }
+public:
+    ArrayFunction(F const & f, E const & ... e) : f(f), operands(e...) {}
+    auto arrays() const {
+        return std::apply([](E const & ... e) {return std::tuple_cat(e.arrays()...);}, operands);
+    }
+    template <typename V, int K, typename ... X>
+    auto eval(X const & ... x) const {
+        return eval_operands<V, K>(std::index_sequence_for<E...>(), x...);
+    }
+};
+
+
+/*****************************************************************************
+*
+*          Operands
+*
+*****************************************************************************/
+
+// The first type in A that is an expression
+template <typename A>
+struct array_first_is {
+    typedef A type;
+};
+
+template <typename ... A>
+struct array_first_expression {};
+
+template <typename A, typename ... B>
+struct array_first_expression<A, B...> : std::conditional<is_array_expression<A>::value,
+    array_first_is<A>, array_first_expression<B...>>::type {};
+
+// Element type of an expression with operands A. The first expression in A decides
+template <typename ... A>
+using array_element_t = typename array_first_expression<A...>::type::element_type;
+
+// Used for enabling the operators and functions below when at least one operand is an
+// expression and the other operands are expressions or can be converted to its element type
+template <typename ... A>
+using array_operands_enable = typename std::enable_if<((is_array_expression<A>::value
+    || std::is_convertible<A, array_element_t<A...>>::value) && ...), int>::type;
+
+// An expression operand as it is, or a scalar operand converted to ArrayScalar<T>
+template <typename T, typename A>
+static inline auto array_operand(A const & a) {
+    if constexpr (is_array_expression<A>::value) {
+        return a;
+    }
+    else {
+        return ArrayScalar<T>(T(a));
+    }
+}
+
+// Expression that applies f to the vector blocks of the operands a. Scalar operands are
+// converted to the element type of the first expression in a. Use this for functions
+// that are not defined below, e.g.
+// y = array_function([](auto const a) {return approx_recipr(a);}, x);
+template <typename F, typename ... A, array_operands_enable<A...> = 0>
+static inline auto array_function(F const & f, A const & ... a) {
+    typedef array_element_t<A...> T;
+    return ArrayFunction<F, decltype(array_operand<T>(a))...>(f, array_operand<T>(a)...);
+}
+
+
+/*****************************************************************************
+*
+*          Operators and functions
+*
+*****************************************************************************/
+// Each of these applies the operator or function with the same name to the vector blocks.
+// The operand names x, y, z are used inside the lambdas so that the macros can use a, b, c
+
+#define VCL_ARRAY_OPERATOR1(op)                                                          \
+template <typename A, array_operands_enable<A> = 0>                                     \
+static inline auto operator op (A const & a) {                                           \
+    return array_function([](auto const x) {return op x;}, a);                          \
+}
+
+#define VCL_ARRAY_OPERATOR2(op)                                                          \
+template <typename A, typename B, array_operands_enable<A, B> = 0>                      \
+static inline auto operator op (A const & a, B const & b) {                              \
+    return array_function([](auto const x, auto const y) {return x op y;}, a, b);       \
+}
+
+#define VCL_ARRAY_FUNCTION1(name)                                                        \
+template <typename A, array_operands_enable<A> = 0>                                     \
+static inline auto name(A const & a) {                                                   \
+    return array_function([](auto const x) {return name(x);}, a);                       \
+}
+
+#define VCL_ARRAY_FUNCTION2(name)                                                        \
+template <typename A, typename B, array_operands_enable<A, B> = 0>                      \
+static inline auto name(A const & a, B const & b) {                                      \
+    return array_function([](auto const x, auto const y) {return name(x, y);}, a, b);   \
+}
+
+#define VCL_ARRAY_FUNCTION3(name)                                                        \
+template <typename A, typename B, typename C, array_operands_enable<A, B, C> = 0>       \
+static inline auto name(A const & a, B const & b, C const & c) {                         \
+    return array_function([](auto const x, auto const y, auto const z) {return name(x, y, z);}, a, b, c); \
+}
+
+VCL_ARRAY_OPERATOR1(-)
+VCL_ARRAY_OPERATOR1(~)
+VCL_ARRAY_OPERATOR1(!)
+
+VCL_ARRAY_OPERATOR2(+)
+VCL_ARRAY_OPERATOR2(-)
+VCL_ARRAY_OPERATOR2(*)
+VCL_ARRAY_OPERATOR2(/)
+VCL_ARRAY_OPERATOR2(&)
+VCL_ARRAY_OPERATOR2(|)
+VCL_ARRAY_OPERATOR2(^)
+VCL_ARRAY_OPERATOR2(<)
+VCL_ARRAY_OPERATOR2(<=)
+VCL_ARRAY_OPERATOR2(>)
+VCL_ARRAY_OPERATOR2(>=)
+VCL_ARRAY_OPERATOR2(==)
+VCL_ARRAY_OPERATOR2(!=)
+VCL_ARRAY_OPERATOR2(&&)
+VCL_ARRAY_OPERATOR2(||)
+
+VCL_ARRAY_FUNCTION1(sqrt)
+VCL_ARRAY_FUNCTION1(abs)
+VCL_ARRAY_FUNCTION1(square)
+VCL_ARRAY_FUNCTION1(round)
+VCL_ARRAY_FUNCTION1(truncate)
+VCL_ARRAY_FUNCTION1(floor)
+VCL_ARRAY_FUNCTION1(ceil)
+VCL_ARRAY_FUNCTION1(exp)
+VCL_ARRAY_FUNCTION1(exp2)
+VCL_ARRAY_FUNCTION1(exp10)
+VCL_ARRAY_FUNCTION1(expm1)
+VCL_ARRAY_FUNCTION1(log)
+VCL_ARRAY_FUNCTION1(log2)
+VCL_ARRAY_FUNCTION1(log10)
+VCL_ARRAY_FUNCTION1(log1p)
+VCL_ARRAY_FUNCTION1(cbrt)
+VCL_ARRAY_FUNCTION1(sin)
+VCL_ARRAY_FUNCTION1(cos)
+VCL_ARRAY_FUNCTION1(tan)
+VCL_ARRAY_FUNCTION1(asin)
+VCL_ARRAY_FUNCTION1(acos)
+VCL_ARRAY_FUNCTION1(atan)
+VCL_ARRAY_FUNCTION1(sinh)
+VCL_ARRAY_FUNCTION1(cosh)
+VCL_ARRAY_FUNCTION1(tanh)
+VCL_ARRAY_FUNCTION1(asinh)
+VCL_ARRAY_FUNCTION1(acosh)
+VCL_ARRAY_FUNCTION1(atanh)
+
+VCL_ARRAY_FUNCTION2(pow)
+VCL_ARRAY_FUNCTION2(atan2)
+VCL_ARRAY_FUNCTION2(min)
+VCL_ARRAY_FUNCTION2(max)
+
+VCL_ARRAY_FUNCTION3(mul_add)
+VCL_ARRAY_FUNCTION3(select)
+
+#undef VCL_ARRAY_OPERATOR1
+#undef VCL_ARRAY_OPERATOR2
+#undef VCL_ARRAY_FUNCTION1
+#undef VCL_ARRAY_FUNCTION2
+#undef VCL_ARRAY_FUNCTION3
+
+
+/*****************************************************************************
+*
+*          Evaluation
+*
+*****************************************************************************/
+// Evaluate expression e and store the result in y. The vector class V is optional. The
+// default is array_vector<T>::type. U is the unroll factor for transform_vec
+template <typename V = void, int U = VCL_ARRAY_UNROLL, typename T, typename E>
+static inline void evaluate(ArrayView<T> const & y, E const & e) {
+    typedef typename ArrayView<T>::element_type TE;
+    typedef array_vector_select<V, TE> VV;
+    static_assert(!std::is_const<T>::value, "Cannot assign to a view of a const array");
+    static_assert(is_array_expression<E>::value, "e must be an array expression");
+    static_assert(std::is_same<typename E::element_type, TE>::value, "The expression must have the same element type as the array");
+    auto f = [&e](auto const ... x) {return e.template eval<VV, 0>(x...);};
+    auto r = [&f](auto const * ... p) {return f(((void)p, VV())...);};   // used only for the result type
+    static_assert(std::is_same<decltype(std::apply(r, e.arrays())), VV>::value,
+        "The expression must give a vector of the array type, not a boolean vector. Use select for comparisons");
+    if constexpr (E::leaves > 0) {
+        std::apply([&](auto const * ... p) {transform_vec<VV, U>(y.data(), y.size(), f, p...);}, e.arrays());
+    }
+    else {
+        // no arrays in the expression. transform_vec needs one input, and y is loaded but not used
+        auto g = [&f](VV const) {return f();};
+        transform_vec<VV, U>(y.data(), y.size(), g, static_cast<TE const *>(y.data()));
+    }
+}
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_EXPRESSION_H
@@ -0,0 +1,327 @@
+/****************************  vector_hash.h   *******************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining hash functions. The lane hash functions hash each
+* element of an integer vector separately, e.g. for probing a hash table with
+* many keys at a time. The CRC32C function hashes an array of bytes.
+*
+* Functions defined here:
+* hash_lanes(Vec4ui/Vec8ui/Vec16ui x, seed)   hash each 32-bit element of x
+* hash_lanes(Vec2uq/Vec4uq/Vec8uq x, seed)    hash each 64-bit element of x
+* hash_bucket<bits>(x)                        multiply-shift hash of each element,
+*                                             giving a bucket index of bits bits
+* crc32c(data, n, crc)                        CRC32C checksum of n bytes
+*
+* hash_lanes uses the finalizer of MurmurHash3 for 32-bit elements and the
+* finalizer of SplitMix64 for 64-bit elements. All bits of the result depend
+* on all bits of the input. hash_bucket<bits> is faster but weaker. It multiplies
+* by an odd constant and takes the high bits of the product. This is good
+* enough for hash tables with keys that are not deliberately chosen to collide.
+* The results are the same for all instruction sets and vector sizes.
+*
+* Multiplication of 64-bit integers is emulated with 32-bit multiplications
+* if AVX512DQ is not available. hash_lanes of 64-bit elements is therefore
+* relatively slow without AVX512DQ.
+*
+* crc32c uses the Castagnoli polynomial, as in iSCSI, SSE4.2 and many file
+* formats. It gives the same result as the crc32 instruction with the usual
+* inversion of the start value and the result. crc32c(b, nb, crc32c(a, na)) is
+* the checksum of a followed by b. The implementation depends on the instruction
+* set that the code is compiled for:
+* VPCLMULQDQ and AVX512:  folding with 512-bit carry-less multiplication
+* PCLMULQDQ and SSE4.2:   folding with 128-bit carry-less multiplication
+* SSE4.2:                 crc32 instruction
+* other:                  table lookup
+* Use cpu_has(cpu_feature_pclmulqdq) and cpu_has(cpu_feature_vpclmulqdq) for
+* detecting these instructions at runtime, as explained in vcl_dispatch.h.
+*
+* Example:
+* // probe a hash table with 16 keys at a time
+* Vec16ui keys;  keys.load(k);
+* Vec16ui h = hash_lanes(keys) & (table_size - 1);     // table_size is a power of 2
+* Vec16i found = lookup<table_size>(Vec16i(h), table);  // table of int32_t keys
+* Vec16ib match = found == Vec16i(keys);
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_HASH_H
+#define VECTOR_HASH_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include <stddef.h>                    // define size_t
+#include <string.h>                    // define memcpy
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*          Hash of each vector element
+*
+*****************************************************************************/
+
+// Hash each 32-bit element. Finalizer of MurmurHash3
+template <typename V>
+static inline V hash_lanes_32(V x, uint32_t seed) {
+    x ^= V(seed);
+    x ^= x >> 16;
+    x *= V(0x85EBCA6Bu);
+    x ^= x >> 13;
+    x *= V(0xC2B2AE35u);
+    x ^= x >> 16;
+    return x;
+}
+
+// Hash each 64-bit element. Finalizer of SplitMix64
+template <typename V>
+static inline V hash_lanes_64(V x, uint64_t seed) {
+    x += V(seed + 0x9E3779B97F4A7C15u);
+    x ^= x >> 30;
+    x *= V(0xBF58476D1CE4E5B9u);
+    x ^= x >> 27;
+    x *= V(0x94D049BB133111EBu);
+    x ^= x >> 31;
+    return x;
+}
+
+static inline Vec4ui hash_lanes(Vec4ui const x, uint32_t seed = 0) {
+    return hash_lanes_32(x, seed);
+}
+
+static inline Vec2uq hash_lanes(Vec2uq const x, uint64_t seed = 0) {
+    return hash_lanes_64(x, seed);
+}
+
+#if MAX_VECTOR_SIZE >= 256
+static inline Vec8ui hash_lanes(Vec8ui const x, uint32_t seed = 0) {
+    return hash_lanes_32(x, seed);
+}
+
+static inline Vec4uq hash_lanes(Vec4uq const x, uint64_t seed = 0) {
+    return hash_lanes_64(x, seed);
+}
+#endif // MAX_VECTOR_SIZE >= 256
+
+#if MAX_VECTOR_SIZE >= 512
+static inline Vec16ui hash_lanes(Vec16ui const x, uint32_t seed = 0) {
+    return hash_lanes_32(x, seed);
+}
+
+static inline Vec8uq hash_lanes(Vec8uq const x, uint64_t seed = 0) {
+    return hash_lanes_64(x, seed);
+}
+#endif // MAX_VECTOR_SIZE >= 512
+
+
+// Multiply-shift hash. Gives a value in the interval 0 <= h < 2^bits for each element.
+// Works with Vec4ui, Vec8ui, Vec16ui, Vec2uq, Vec4uq, Vec8uq
+template <int bits, typename V>
+static inline V hash_bucket(V const x) {
+    constexpr int elementbits = int(sizeof(x) * 8 / V::size());
+    static_assert(bits > 0 && bits <= elementbits, "hash_bucket: bits out of range");
+    if constexpr (elementbits == 32) {
+        return (x * V(0x9E3779B1u)) >> (32 - bits);
+    }
+    else {
+        return (x * V(0x9E3779B97F4A7C15u)) >> (64 - bits);
+    }
+}
+
+
+/*****************************************************************************
+*
+*          CRC32C checksum of an array of bytes
+*
+*****************************************************************************/
+
+// Bit-reflected Castagnoli polynomial
+const uint32_t crc32c_polynomial = 0x82F63B78u;
+
+#if INSTRSET < 6
+// Table for calculating CRC32C one byte at a time
+struct Crc32c_table {
+    uint32_t t[256];
+};
+
+constexpr Crc32c_table crc32c_make_table() {
+    Crc32c_table tab = {};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int j = 0; j < 8; j++) {
+            c = (c & 1) ? (c >> 1) ^ crc32c_polynomial : c >> 1;
+        }
+        tab.t[i] = c;
+    }
+    return tab;
+}
+#endif
+
+// Update crc with one byte, without inversion
+static inline uint32_t crc32c_u8(uint32_t crc, uint8_t x) {
+#if INSTRSET >= 6   // SSE4.2
+    return _mm_crc32_u8(crc, x);
+#else
+    static constexpr Crc32c_table table = crc32c_make_table();
+    return table.t[(crc ^ x) & 0xFF] ^ (crc >> 8);
+#endif
+}
+
+// Update crc with 8 bytes, without inversion
+static inline uint32_t crc32c_u64(uint32_t crc, uint64_t x) {
+#if INSTRSET >= 6 && defined(__x86_64__)
+    return uint32_t(_mm_crc32_u64(crc, x));
+#elif INSTRSET >= 6
+    crc = _mm_crc32_u32(crc, uint32_t(x));
+    return _mm_crc32_u32(crc, uint32_t(x >> 32));
+#else
+    for (int i = 0; i < 8; i++) {
+        crc = crc32c_u8(crc, uint8_t(x >> i * 8));
+    }
+    return crc;
+#endif
+}
+
+#if INSTRSET >= 6 && defined(__PCLMUL__)
+// x^n modulo the CRC32C polynomial, bit-reflected and shifted left by one, as
+// needed for folding with carry-less multiplication
+constexpr uint64_t crc32c_fold_constant(int n) {
+    uint32_t r = 0x80000000u;                    // x^0, bit-reflected
+    for (int i = 0; i < n; i++) {
+        r = (r & 1) ? (r >> 1) ^ crc32c_polynomial : r >> 1;
+    }
+    return uint64_t(r) << 1;
+}
+
+// Constants for folding a 128-bit block by a distance of d bits
+template <int d>
+static inline __m128i crc32c_fold_constants() {
+    constexpr uint64_t klo = crc32c_fold_constant(d + 32);   // for the low 64 bits
+    constexpr uint64_t khi = crc32c_fold_constant(d - 32);   // for the high 64 bits
+    return _mm_set_epi64x(int64_t(khi), int64_t(klo));
+}
+
+// Fold the 128-bit block x forward by the distance given by k and combine it
+// with the block y at that position. The result has the same CRC as x and y
+static inline __m128i crc32c_fold(__m128i const x, __m128i const k, __m128i const y) {
+    __m128i lo = _mm_clmulepi64_si128(x, k, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(x, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), y);
+}
+
+#if defined(__VPCLMULQDQ__) && INSTRSET >= 10
+// Same, for four 128-bit blocks at a time
+static inline __m512i crc32c_fold(__m512i const x, __m512i const k, __m512i const y) {
+    __m512i lo = _mm512_clmulepi64_epi128(x, k, 0x00);
+    __m512i hi = _mm512_clmulepi64_epi128(x, k, 0x11);
+    return _mm512_ternarylogic_epi64(lo, hi, y, 0x96);  // lo ^ hi ^ y
+}
+#endif
+
+// CRC32C of n >= 64 bytes, without inversion. The bytes are folded down to a
+// 128-bit block with the same CRC. Less than 16 bytes are left in p and n
+static inline uint32_t crc32c_folding(uint32_t crc, uint8_t const * & p, size_t & n) {
+    __m128i x0, x1, x2, x3;
+    __m128i k512 = crc32c_fold_constants<512>();
+#if defined(__VPCLMULQDQ__) && INSTRSET >= 10
+    __m512i z = _mm512_loadu_si512(p);
+    z = _mm512_xor_si512(z, _mm512_castsi128_si512(_mm_cvtsi32_si128(int(crc)))); // start value
+    p += 64;  n -= 64;
+    if (n >= 192) {
+        // fold four 512-bit blocks at a time
+        __m512i z1 = _mm512_loadu_si512(p);
+        __m512i z2 = _mm512_loadu_si512(p + 64);
+        __m512i z3 = _mm512_loadu_si512(p + 128);
+        p += 192;  n -= 192;
+        __m512i k2048 = _mm512_broadcast_i32x4(crc32c_fold_constants<2048>());
+        while (n >= 256) {
+            z  = crc32c_fold(z,  k2048, _mm512_loadu_si512(p));
+            z1 = crc32c_fold(z1, k2048, _mm512_loadu_si512(p + 64));
+            z2 = crc32c_fold(z2, k2048, _mm512_loadu_si512(p + 128));
+            z3 = crc32c_fold(z3, k2048, _mm512_loadu_si512(p + 192));
+            p += 256;  n -= 256;
+        }
+        __m512i kz = _mm512_broadcast_i32x4(k512);
+        z = crc32c_fold(z, kz, z1);
+        z = crc32c_fold(z, kz, z2);
+        z = crc32c_fold(z, kz, z3);
+    }
+    while (n >= 64) {
+        z = crc32c_fold(z, _mm512_broadcast_i32x4(k512), _mm512_loadu_si512(p));
+        p += 64;  n -= 64;
+    }
+    x0 = _mm512_castsi512_si128(z);
+    x1 = _mm512_extracti32x4_epi32(z, 1);
+    x2 = _mm512_extracti32x4_epi32(z, 2);
+    x3 = _mm512_extracti32x4_epi32(z, 3);
+#else
+    x0 = _mm_loadu_si128((__m128i const *)p);
+    x1 = _mm_loadu_si128((__m128i const *)(p + 16));
+    x2 = _mm_loadu_si128((__m128i const *)(p + 32));
+    x3 = _mm_loadu_si128((__m128i const *)(p + 48));
+    x0 = _mm_xor_si128(x0, _mm_cvtsi32_si128(int(crc)));    // start value
+    p += 64;  n -= 64;
+    // fold four 128-bit blocks at a time
+    while (n >= 64) {
+        x0 = crc32c_fold(x0, k512, _mm_loadu_si128((__m128i const *)p));
+        x1 = crc32c_fold(x1, k512, _mm_loadu_si128((__m128i const *)(p + 16)));
+        x2 = crc32c_fold(x2, k512, _mm_loadu_si128((__m128i const *)(p + 32)));
+        x3 = crc32c_fold(x3, k512, _mm_loadu_si128((__m128i const *)(p + 48)));
+        p += 64;  n -= 64;
+    }
+#endif
+    // fold the four blocks into one
+    __m128i k128 = crc32c_fold_constants<128>();
+    x1 = crc32c_fold(x0, k128, x1);
+    x2 = crc32c_fold(x1, k128, x2);
+    x3 = crc32c_fold(x2, k128, x3);
+    while (n >= 16) {
+        x3 = crc32c_fold(x3, k128, _mm_loadu_si128((__m128i const *)p));
+        p += 16;  n -= 16;
+    }
+    // CRC of the remaining 128-bit block
+    uint64_t x[2];
+    _mm_storeu_si128((__m128i *)x, x3);
+    return crc32c_u64(crc32c_u64(0, x[0]), x[1]);
+}
+#endif // __PCLMUL__
+
+// CRC32C checksum of n bytes. crc is the checksum of preceding data, if any
+static inline uint32_t crc32c(void const * data, size_t n, uint32_t crc = 0) {
+    uint8_t const * p = (uint8_t const *)data;
+    crc = ~crc;
+#if INSTRSET >= 6 && defined(__PCLMUL__)
+    if (n >= 256) {
+        crc = crc32c_folding(crc, p, n);
+    }
+#endif
+    for (; n >= 8; n -= 8, p += 8) {
+        uint64_t x;
+        memcpy(&x, p, 8);
+        crc = crc32c_u64(crc, x);
+    }
+    for (; n > 0; n--) {
+        crc = crc32c_u8(crc, *p++);
+    }
+    return ~crc;
+}
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_HASH_H
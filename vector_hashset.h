@@ -0,0 +1,390 @@
+/****************************  vector_hashset.h   ****************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining a hash set and a bloom filter for 32-bit integer keys,
+* with vectorized lookup of 16 keys at a time. These are intended for the
+* probe phase of hash joins and similar applications where the same table is
+* searched for many keys.
+*
+* Classes defined here:
+* SimdHashSet<T>     Set of 32-bit integer keys. T = uint32_t or int32_t
+* SimdBloomFilter    Bloom filter for 32-bit integer keys
+*
+* Member functions of both classes:
+* insert(key)            insert one key
+* insert(keys, n)        insert n keys from an array
+* contains(key)          check if a key is contained
+* contains(Vec16ui keys) check 16 keys at a time. Returns a boolean vector
+* find(keys, n, index)   check an array of n keys. The indexes of the keys that are
+*                        contained are stored in index. Returns the number of found keys.
+*                        SimdHashSet::find stores the indexes in no particular order
+*
+* SimdHashSet uses open addressing with linear probing. The table size is a
+* power of 2 and is kept at least twice the number of keys. The vectorized
+* lookup hashes 16 keys with hash_lanes, gathers the slots, and moves the keys
+* that are neither found nor at an empty slot to the next slot. With AVX512,
+* the find function loads a new key into each element as soon as the previous
+* key is resolved, so that a single long probe sequence does not stall the
+* other elements. The batch insert function is vectorized in the same way when
+* AVX512CD is available. The vpconflictd instruction is used for detecting
+* duplicate keys and keys that want the same empty slot in the same batch.
+* Keys cannot be removed.
+*
+* SimdBloomFilter is a split block bloom filter. Each key sets one bit in each
+* of the eight 32-bit words of a 256-bit block. The false positive rate is
+* approximately 0.5% with 10 bits per key and 0.1% with 16 bits per key. A bloom
+* filter costs less memory and is faster than a hash set, but it may give false
+* positives. It never gives false negatives.
+*
+* The lookup functions use masked gather instructions with AVX512, gather
+* instructions with AVX2, and scalar loads otherwise.
+*
+* Example:
+* SimdHashSet<uint32_t> set;
+* set.insert(build_keys, nbuild);                      // build phase
+* uint32_t * matches = new uint32_t[nprobe];
+* size_t m = set.find(probe_keys, nprobe, matches);    // probe phase
+* // matches[0 .. m-1] contains the indexes of the probe keys that are in the set
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_HASHSET_H
+#define VECTOR_HASHSET_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#if MAX_VECTOR_SIZE < 512
+#error vector_hashset.h requires MAX_VECTOR_SIZE >= 512
+#endif
+
+#include "vector_hash.h"               // hash_lanes
+#include "vector_convert.h"            // compress_store
+
+#include <stddef.h>                    // define size_t
+#include <limits.h>                    // define INT_MAX
+#include <type_traits>                 // std::is_integral
+#include <vector>                      // std::vector
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*          Helper functions
+*
+*****************************************************************************/
+
+// Gather table[index] for the elements where active is true. Other elements get src
+static inline Vec16ui hashset_gather(Vec16ui const index, Vec16ib const active, Vec16ui const src, uint32_t const * table) {
+#if INSTRSET >= 9
+    return _mm512_mask_i32gather_epi32(src, __mmask16(active), index, (int const *)table, 4);
+#else
+    return select(active, Vec16ui(lookup<INT_MAX>(Vec16i(index), table)), src);
+#endif
+}
+
+// Index of each element: (0, 1, 2, ..., 15)
+static inline Vec16ui hashset_lane_index() {
+    return Vec16ui(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+}
+
+// Call f(Vec16ui keys, Vec16ib valid, i) for each block of 16 keys from an array of n keys.
+// The last block is padded with the first key
+template <typename T, typename F>
+static inline void hashset_for_blocks(T const * keys, size_t n, F f) {
+    Vec16ui k;
+    size_t i;
+    for (i = 0; i + 16 <= n; i += 16) {
+        k.load(keys + i);
+        f(k, Vec16ib(true), i);
+    }
+    if (i < n) {
+        Vec16ib valid = hashset_lane_index() < uint32_t(n - i);
+        k.load_partial(int(n - i), keys + i);
+        f(select(valid, k, Vec16ui(uint32_t(keys[0]))), valid, i);
+    }
+}
+
+
+/*****************************************************************************
+*
+*          class template SimdHashSet
+*
+*****************************************************************************/
+
+template <typename T>
+class SimdHashSet {
+    static_assert(std::is_integral<T>::value && sizeof(T) == 4, "SimdHashSet needs 32-bit integer keys");
+protected:
+    static constexpr uint32_t empty_slot = 0xFFFFFFFFu;  // marks empty slots in table
+    std::vector<uint32_t> table;                     // slots
+    uint32_t mask;                                   // table size - 1
+    size_t count;                                    // number of keys
+    bool has_empty_key;                              // the key that equals empty_slot is contained
+    // Hash of one key. Same as hash_lanes
+    static uint32_t hash1(uint32_t key) {
+        return hash_lanes_32(key, 0u);
+    }
+    // Insert key that is not equal to empty_slot. The table must have space for it
+    bool insert_slot(uint32_t key) {
+        uint32_t h = hash1(key) & mask;
+        while (table[h] != empty_slot) {
+            if (table[h] == key) return false;       // already contained
+            h = (h + 1) & mask;
+        }
+        table[h] = key;
+        count++;
+        return true;
+    }
+public:
+    // Constructor. n is the expected number of keys
+    SimdHashSet(size_t n = 0) {
+        mask = 0;  count = 0;  has_empty_key = false;
+        reserve(n);
+    }
+    // Make room for n keys without growing the table
+    void reserve(size_t n) {
+        size_t size = 32;
+        while (size < 2 * n) size *= 2;              // table size is a power of 2 >= 2 * n
+        if (size <= table.size()) return;
+        std::vector<uint32_t> old(size, empty_slot);
+        old.swap(table);
+        mask = uint32_t(size - 1);
+        count = has_empty_key;
+        for (uint32_t k : old) {                     // rehash old keys
+            if (k != empty_slot) insert_slot(k);
+        }
+    }
+    // Remove all keys
+    void clear() {
+        table.assign(table.size(), empty_slot);
+        count = 0;  has_empty_key = false;
+    }
+    // Number of keys
+    size_t size() const {
+        return count;
+    }
+    // Insert one key. Returns true if it was not already contained
+    bool insert(T const key) {
+        if (uint32_t(key) == empty_slot) {
+            if (has_empty_key) return false;
+            has_empty_key = true;  count++;
+            return true;
+        }
+        reserve(count + 1);
+        return insert_slot(uint32_t(key));
+    }
+    // Insert n keys. Returns the number of keys that were not already contained
+    size_t insert(T const * keys, size_t n) {
+        size_t count0 = count;
+        reserve(count + n);
+#if INSTRSET >= 9 && defined(__AVX512CD__)
+        hashset_for_blocks(keys, n, [this](Vec16ui k, Vec16ib valid, size_t) {
+            Vec16ib e = valid & (k == empty_slot);
+            if (horizontal_or(e) && !has_empty_key) {
+                has_empty_key = true;  count++;
+            }
+            // remove duplicates within the block. The padding in the last block duplicates the first key
+            __m512i conflicts = _mm512_conflict_epi32(k);
+            Vec16ib active = andnot(valid & !e, Vec16ib(_mm512_test_epi32_mask(conflicts, conflicts)));
+            Vec16ui h = hash_lanes(k) & mask;
+            while (horizontal_or(active)) {
+                Vec16ui s = hashset_gather(h, active, empty_slot, table.data());
+                Vec16ib found = active & (s == k);   // already contained
+                Vec16ib free  = active & (s == empty_slot);
+                // if more than one key wants the same empty slot, the first one gets it
+                __m512i same = _mm512_and_si512(_mm512_conflict_epi32(h), _mm512_set1_epi32(int(to_bits(free))));
+                Vec16ib win = andnot(free, Vec16ib(_mm512_test_epi32_mask(same, same)));
+                _mm512_mask_i32scatter_epi32(table.data(), __mmask16(win), h, k, 4);
+                count += vml_popcnt(uint32_t(to_bits(win)));
+                active = andnot(active, found | win);
+                h = (h + 1) & mask;                  // the rest go to the next slot
+            }
+        });
+#else
+        for (size_t i = 0; i < n; i++) {
+            insert(keys[i]);
+        }
+#endif
+        return count - count0;
+    }
+    // Check if one key is contained
+    bool contains(T const key) const {
+        uint32_t k = uint32_t(key);
+        if (k == empty_slot) return has_empty_key;
+        uint32_t h = hash1(k) & mask;
+        while (table[h] != empty_slot) {
+            if (table[h] == k) return true;
+            h = (h + 1) & mask;
+        }
+        return false;
+    }
+    // One probe step for 16 keys k at slots h. Returns the keys that are found.
+    // The keys that are found or have reached an empty slot are removed from active.
+    // A key equal to empty_slot always reaches an empty slot and is found if has_empty_key
+    Vec16ib probe_step(Vec16ui const k, Vec16ui & h, Vec16ib & active) const {
+        Vec16ui s = hashset_gather(h, active, empty_slot, table.data());
+        Vec16ib empty = s == empty_slot;
+        Vec16ib hit = active & (s == k) & (!empty | Vec16ib(has_empty_key));
+        active = andnot(active, (s == k) | empty);   // stop at key or empty slot
+        h = (h + 1) & mask;                          // the rest go to the next slot
+        return hit;
+    }
+    // Check 16 keys at a time
+    Vec16ib contains(Vec16ui const keys) const {
+        Vec16ib found  = false;
+        Vec16ib active = true;
+        Vec16ui h = hash_lanes(keys) & mask;
+        while (horizontal_or(active)) {
+            found |= probe_step(keys, h, active);
+        }
+        return found;
+    }
+    // Check n keys. The indexes of the keys that are contained are stored in index,
+    // in no particular order. Returns the number of keys found
+    size_t find(T const * keys, size_t n, uint32_t * index) const {
+        size_t c = 0;                                // number of keys found
+#if INSTRSET >= 9
+        // Each element that has finished its key gets the next key from the array, so
+        // that the elements are kept busy when some keys need more probe steps than others
+        size_t next = 0;                             // next key to load
+        Vec16ui k = 0, h = 0;                        // keys and slots
+        Vec16ui pos = 0;                             // index of each key
+        Vec16ib active = false;                      // elements that have a key
+        while (true) {
+            if (next < n && !horizontal_and(active)) {
+                // load new keys into the idle elements
+                Vec16ib idle = !active;
+                Vec16ui rank = expand_masked(hashset_lane_index(), idle); // number of idle elements below
+                Vec16ib load = idle & (rank < uint32_t(n - next));
+                k   = select(load, expand_load<Vec16ui>((uint32_t const *)keys + next, load), k);
+                pos = select(load, rank + uint32_t(next), pos);
+                h   = select(load, hash_lanes(k) & mask, h);
+                active |= load;
+                next += (size_t)horizontal_count(load);
+            }
+            else if (!horizontal_or(active)) {
+                break;                               // finished
+            }
+            c += compress_store(index + c, pos, probe_step(k, h, active));
+        }
+#else
+        // Without the AVX512 compress and expand instructions, it is faster to do 16 keys at a time
+        hashset_for_blocks(keys, n, [&](Vec16ui k, Vec16ib valid, size_t i) {
+            Vec16ib found = contains(k) & valid;
+            c += compress_store(index + c, hashset_lane_index() + uint32_t(i), found);
+        });
+#endif
+        return c;
+    }
+};
+
+
+/*****************************************************************************
+*
+*          class SimdBloomFilter
+*
+*****************************************************************************/
+
+class SimdBloomFilter {
+protected:
+    std::vector<uint32_t> words;                     // blocks of 8 words
+    uint32_t blockmask;                              // number of blocks - 1
+    // multipliers for the bit position in each word
+    static uint32_t salt(int j) {
+        static const uint32_t s[8] = {
+            0x47B6137Bu, 0x44974D91u, 0x8824AD5Bu, 0xA2B7289Du,
+            0x705495C7u, 0x2DF1424Bu, 0x9EFC4947u, 0x5C6BFB31u};
+        return s[j];
+    }
+    // 1 << s for each element
+    static Vec16ui bit_mask(Vec16ui const s) {
+#if INSTRSET >= 9
+        return _mm512_sllv_epi32(_mm512_set1_epi32(1), s);
+#else
+        static const uint32_t pow2[32] = {
+            1u<<0,  1u<<1,  1u<<2,  1u<<3,  1u<<4,  1u<<5,  1u<<6,  1u<<7,
+            1u<<8,  1u<<9,  1u<<10, 1u<<11, 1u<<12, 1u<<13, 1u<<14, 1u<<15,
+            1u<<16, 1u<<17, 1u<<18, 1u<<19, 1u<<20, 1u<<21, 1u<<22, 1u<<23,
+            1u<<24, 1u<<25, 1u<<26, 1u<<27, 1u<<28, 1u<<29, 1u<<30, 1u<<31};
+        return Vec16ui(lookup<32>(Vec16i(s), pow2));
+#endif
+    }
+public:
+    // Constructor. n is the expected number of keys
+    SimdBloomFilter(size_t n = 0, int bits_per_key = 10) {
+        size_t blocks = 1;
+        while (blocks * 256 < n * size_t(bits_per_key)) blocks *= 2; // number of 256-bit blocks
+        words.assign(blocks * 8, 0);
+        blockmask = uint32_t(blocks - 1);
+    }
+    // Remove all keys
+    void clear() {
+        words.assign(words.size(), 0);
+    }
+    // Insert one key
+    void insert(uint32_t const key) {
+        uint32_t h = hash_lanes_32(key, 0u);
+        uint32_t * block = words.data() + (h & blockmask) * 8;
+        for (int j = 0; j < 8; j++) {
+            block[j] |= 1u << ((h * salt(j)) >> 27);
+        }
+    }
+    // Insert n keys
+    void insert(uint32_t const * keys, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            insert(keys[i]);
+        }
+    }
+    // Check if one key may be contained
+    bool contains(uint32_t const key) const {
+        uint32_t h = hash_lanes_32(key, 0u);
+        uint32_t const * block = words.data() + (h & blockmask) * 8;
+        for (int j = 0; j < 8; j++) {
+            if ((block[j] & 1u << ((h * salt(j)) >> 27)) == 0) return false;
+        }
+        return true;
+    }
+    // Check 16 keys at a time. The result is true for the keys that may be contained
+    Vec16ib contains(Vec16ui const keys) const {
+        Vec16ui h = hash_lanes(keys);
+        Vec16ui base = (h & blockmask) << 3;         // index of first word of block
+        Vec16ib maybe = true;
+        for (int j = 0; j < 8; j++) {
+            Vec16ui w = hashset_gather(base + uint32_t(j), maybe, 0, words.data());
+            maybe &= (w & bit_mask((h * salt(j)) >> 27)) != 0;
+            if (!horizontal_or(maybe)) break;        // no key can be contained
+        }
+        return maybe;
+    }
+    // Check n keys. The indexes of the keys that may be contained are stored in index.
+    // Returns the number of keys stored in index
+    size_t find(uint32_t const * keys, size_t n, uint32_t * index) const {
+        size_t c = 0;
+        hashset_for_blocks(keys, n, [&](Vec16ui k, Vec16ib valid, size_t i) {
+            Vec16ib found = contains(k) & valid;
+            c += compress_store(index + c, hashset_lane_index() + uint32_t(i), found);
+        });
+        return c;
+    }
+};
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_HASHSET_H
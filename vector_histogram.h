@@ -0,0 +1,332 @@
+/***************************  vector_histogram.h   ****************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining functions for histograms of small integer keys and for
+* radix sorting of 32-bit unsigned integers.
+* This header is optional. It is not included by vectorclass.h.
+*
+* Functions defined here:
+* histogram<Bins>(p, n, bins)            Count the keys p[0..n-1] of type uint8_t
+*                                        or uint16_t that are less than Bins.
+*                                        bins[k] = number of keys equal to k
+* radix_histogram<Bits>(p, n, shift, bins)  Histogram of the digits
+*                                        (p[i] >> shift) & (2^Bits - 1) of 32-bit keys
+* radix_partition<Bits>(in, out, n, shift)  Stable partition of 32-bit keys by the
+*                                        digit (in[i] >> shift) & (2^Bits - 1)
+* radix_sort(p, n, buffer)               Sort n 32-bit unsigned integers with four
+*                                        radix_partition passes of 8 bits.
+*                                        buffer must have space for n elements
+*
+* The histogram functions overwrite bins[0 .. Bins-1].
+*
+* Two methods are used for counting:
+*
+* 1. Replicated sub-histograms. Consecutive keys are counted in different copies of
+* the histogram, so that an increment does not have to wait for the previous
+* increment of the same counter when the same key occurs several times in a row.
+* The copies are added with vector instructions at the end. This is the fastest
+* method for keys of 8 bits and radix digits with up to 1024 bins.
+*
+* 2. Conflict detection (AVX512CD). 16 keys are converted to 32-bit indexes.
+* vpconflictd gives for each element a mask of the preceding elements with the same
+* index. The popcount of this mask is the rank of the element among the equal
+* elements. The counters are read with a gather, rank + 1 is added, and the sums
+* are written with a scatter. Elements with the same index write to the same
+* counter, and the last one of these has the highest sum. A scatter writes the
+* elements in order so that the last element wins.
+*
+* Conflict detection is used for 16-bit keys and for radix digits of more than
+* 10 bits if AVX512CD is enabled. It avoids the slow repeated increments of the
+* same counter when there are long runs of equal keys. For random keys, it has
+* about the same speed as counting in a single histogram. Define
+* VCL_HISTOGRAM_CONFLICT as 0 to disable it.
+*
+* radix_partition writes the keys through a small buffer for each digit, which is
+* flushed to the output with 64-byte vector stores. Without these buffers, the
+* scattered stores to 256 different output positions are limited by cache and
+* TLB misses.
+*
+* The vector functions scatter() in vectori512.h do not resolve conflicts between
+* equal indexes. Do not use them for counting.
+*
+* Example:
+* uint8_t pixels[n];
+* uint32_t counts[256];
+* histogram<256>(pixels, n, counts);
+* uint32_t keys[n], buffer[n];
+* radix_sort(keys, n, buffer);
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_HISTOGRAM_H
+#define VECTOR_HISTOGRAM_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include "vector_array.h"              // prefix_sum_exclusive
+#include "vector_bitops.h"             // popcount
+#include <stddef.h>                    // define size_t
+#include <string.h>                    // memcpy, memset
+#include <utility>                     // std::integer_sequence
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+// Use conflict detection for counting 16-bit keys and big radix digits
+#ifndef VCL_HISTOGRAM_CONFLICT
+#if INSTRSET >= 9 && defined (__AVX512CD__)
+#define VCL_HISTOGRAM_CONFLICT  1
+#else
+#define VCL_HISTOGRAM_CONFLICT  0
+#endif
+#endif
+
+
+/*****************************************************************************
+*
+*          Replicated sub-histograms
+*
+*****************************************************************************/
+
+// Number of histogram copies for counting keys with bins counters
+constexpr int histogram_copies(int bins) {
+    return bins <= 1024 ? 4 : 1;
+}
+
+// Add the copies of a histogram: bins[k] = sum of sub[c * stride + k]
+template <int Bins, int C>
+static inline void histogram_merge(uint32_t const * sub, size_t stride, uint32_t * bins) {
+    int k = 0;
+    for (; k + 8 <= Bins; k += 8) {
+        Vec8ui s = Vec8ui().load(sub + k);
+        for (int c = 1; c < C; c++) s += Vec8ui().load(sub + c * stride + k);
+        s.store(bins + k);
+    }
+    for (; k < Bins; k++) {
+        uint32_t s = 0;
+        for (int c = 0; c < C; c++) s += sub[c * stride + k];
+        bins[k] = s;
+    }
+}
+
+// Count key(i + c) in copy c for c = 0 .. C-1
+template <typename F, typename K, int ... J>
+static inline void histogram_count_block(F & count, K & key, size_t i, std::integer_sequence<int, J...>) {
+    (count(J, key(i + J)), ...);
+}
+
+// Count the keys key(i) for i = 0 .. n-1 that are less than Bins. Each counter array
+// has an extra element for the keys >= Bins, unless range <= Bins
+template <int Bins, uint32_t range, typename F>
+static inline void histogram_scalar(size_t n, F key, uint32_t * bins) {
+    constexpr int C = histogram_copies(Bins);
+    if constexpr (C == 1) {
+        memset(bins, 0, Bins * sizeof(uint32_t));
+        for (size_t i = 0; i < n; i++) {
+            uint32_t k = key(i);
+            if (range <= uint32_t(Bins) || k < uint32_t(Bins)) bins[k]++;
+        }
+    }
+    else {
+        constexpr size_t stride = (Bins + 1 + 15) & ~15;  // size of each copy, rounded up to 64 bytes
+        alignas(64) uint32_t sub[C * stride];
+        memset(sub, 0, sizeof(sub));
+        auto count = [&](int c, uint32_t k) {
+            if constexpr (range > uint32_t(Bins)) k = k < uint32_t(Bins) ? k : uint32_t(Bins);
+            sub[c * stride + k]++;
+        };
+        size_t i = 0;
+        for (; i + C <= n; i += C) {
+            histogram_count_block(count, key, i, std::make_integer_sequence<int, C>());
+        }
+        for (; i < n; i++) count(0, key(i));
+        histogram_merge<Bins, C>(sub, stride, bins);
+    }
+}
+
+/*****************************************************************************
+*
+*          Conflict detection
+*
+*****************************************************************************/
+
+#if VCL_HISTOGRAM_CONFLICT
+
+// Rank of each element among the preceding elements with the same index
+static inline Vec16ui histogram_rank(Vec16ui const index) {
+    return popcount(Vec16ui(_mm512_conflict_epi32(index)));
+}
+
+// Add 1 to counters[index] for each element of index where m is true
+static inline void histogram_conflict_add(uint32_t * counters, Vec16ui const index, __mmask16 const m) {
+    Vec16ui count = histogram_rank(index) + 1;
+    __m512i old = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), m, index, counters, 4);
+    _mm512_mask_i32scatter_epi32(counters, m, index, Vec16ui(old) + count, 4);
+}
+
+// Histogram of 16 keys at a time. load(i) gives keys i .. i+15 as 32-bit indexes
+template <int Bins, uint32_t range, typename F>
+static inline void histogram_conflict(size_t n, F load, uint32_t * bins) {
+    memset(bins, 0, Bins * sizeof(uint32_t));
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        Vec16ui index = load(i);
+        __mmask16 m = range <= uint32_t(Bins) ? __mmask16(0xFFFF) : __mmask16(index < uint32_t(Bins));
+        histogram_conflict_add(bins, index, m);
+    }
+    if (i < n) {                                 // last partial vector
+        Vec16ui index = load(i);
+        __mmask16 m = __mmask16(first_n_true<Vec16ui>(int(n - i)));
+        if (range > uint32_t(Bins)) m &= __mmask16(index < uint32_t(Bins));
+        histogram_conflict_add(bins, index, m);
+    }
+}
+
+#endif // VCL_HISTOGRAM_CONFLICT
+
+
+/*****************************************************************************
+*
+*          Histogram functions
+*
+*****************************************************************************/
+
+// Histogram of 8-bit keys. bins[k] = number of keys equal to k, for k < Bins.
+// Keys >= Bins are not counted. bins must have space for Bins elements
+template <int Bins = 256>
+static inline void histogram(uint8_t const * p, size_t n, uint32_t * bins) {
+    static_assert(Bins > 0 && Bins <= 256, "Bins must be 1 - 256");
+    histogram_scalar<Bins, 256>(n, [p](size_t i) {return uint32_t(p[i]);}, bins);
+}
+
+// Histogram of 16-bit keys. bins[k] = number of keys equal to k, for k < Bins.
+// Keys >= Bins are not counted. bins must have space for Bins elements
+template <int Bins = 65536>
+static inline void histogram(uint16_t const * p, size_t n, uint32_t * bins) {
+    static_assert(Bins > 0 && Bins <= 65536, "Bins must be 1 - 65536");
+#if VCL_HISTOGRAM_CONFLICT
+    if constexpr (histogram_copies(Bins) == 1) {
+        histogram_conflict<Bins, 65536>(n, [p, n](size_t i) {
+            Vec16us x(0);
+            if (i + 16 <= n) x.load(p + i);
+            else x.load_partial(int(n - i), p + i);
+            return extend(x);
+        }, bins);
+        return;
+    }
+#endif
+    histogram_scalar<Bins, 65536>(n, [p](size_t i) {return uint32_t(p[i]);}, bins);
+}
+
+// Histogram of the digits (p[i] >> shift) & (2^Bits - 1) of n 32-bit keys.
+// bins must have space for 2^Bits elements
+template <int Bits = 8>
+static inline void radix_histogram(uint32_t const * p, size_t n, int shift, uint32_t * bins) {
+    static_assert(Bits > 0 && Bits <= 16, "Bits must be 1 - 16");
+    constexpr int Bins = 1 << Bits;
+    constexpr uint32_t mask = Bins - 1;
+#if VCL_HISTOGRAM_CONFLICT
+    if constexpr (histogram_copies(Bins) == 1) {
+        histogram_conflict<Bins, Bins>(n, [p, n, shift](size_t i) {
+            Vec16ui x(0);
+            if (i + 16 <= n) x.load(p + i);
+            else x.load_partial(int(n - i), p + i);
+            return (x >> shift) & mask;
+        }, bins);
+        return;
+    }
+#endif
+    histogram_scalar<Bins, Bins>(n, [p, shift](size_t i) {return (p[i] >> shift) & mask;}, bins);
+}
+
+
+/*****************************************************************************
+*
+*          Radix sort
+*
+*****************************************************************************/
+
+// Store the keys in[0..n-1] to out in a stable order sorted by the digit
+// (in[i] >> shift) & (2^Bits - 1). offsets[d] is the output position of the first
+// key with digit d. It is advanced past the keys with digit d.
+// The keys of each digit are collected in a buffer of 64 bytes, which is written
+// with vector stores when it is full. Each cache line of out is then written at once,
+// which reduces the cache and TLB misses of the scattered stores
+template <int Bits>
+static inline void radix_scatter(uint32_t const * in, uint32_t * out, size_t n, int shift, uint32_t * offsets) {
+    constexpr int Bins = 1 << Bits;
+    constexpr uint32_t mask = Bins - 1;
+    if constexpr (Bins > 256) {                  // buffers would be too big
+        for (size_t i = 0; i < n; i++) {
+            uint32_t k = in[i];
+            out[offsets[(k >> shift) & mask]++] = k;
+        }
+    }
+    else {
+        alignas(64) uint32_t buffer[Bins][16];   // keys waiting to be written
+        uint32_t fill[Bins] = {0};               // number of keys in each buffer
+        for (size_t i = 0; i < n; i++) {
+            uint32_t k = in[i];
+            uint32_t d = (k >> shift) & mask;
+            uint32_t f = fill[d];
+            buffer[d][f] = k;
+            if (++f == 16) {                     // buffer full
+                Vec16ui().load_a(buffer[d]).store(out + offsets[d]);
+                offsets[d] += 16;
+                f = 0;
+            }
+            fill[d] = f;
+        }
+        for (int d = 0; d < Bins; d++) {         // write the remaining keys
+            if (fill[d]) {                       // out may be null if n = 0
+                memcpy(out + offsets[d], buffer[d], fill[d] * sizeof(uint32_t));
+                offsets[d] += fill[d];
+            }
+        }
+    }
+}
+
+// Stable partition of n 32-bit keys by the digit (in[i] >> shift) & (2^Bits - 1).
+// out must have space for n elements and must not overlap with in
+template <int Bits = 8>
+static inline void radix_partition(uint32_t const * in, uint32_t * out, size_t n, int shift) {
+    uint32_t offsets[1 << Bits];
+    radix_histogram<Bits>(in, n, shift, offsets);
+    prefix_sum_exclusive(offsets, offsets, 1 << Bits);
+    radix_scatter<Bits>(in, out, n, shift, offsets);
+}
+
+// Sort n 32-bit unsigned integers in ascending order with four passes of radix_partition.
+// buffer must have space for n elements. Passes where all keys have the same digit are
+// skipped. The result is in p
+static inline void radix_sort(uint32_t * p, size_t n, uint32_t * buffer) {
+    uint32_t * src = p, * dst = buffer;
+    uint32_t offsets[256];
+    for (int shift = 0; shift < 32; shift += 8) {
+        radix_histogram<8>(src, n, shift, offsets);
+        if (n > 0 && offsets[(src[0] >> shift) & 0xFF] == n) continue;  // all keys have the same digit
+        prefix_sum_exclusive(offsets, offsets, 256);
+        radix_scatter<8>(src, dst, n, shift, offsets);
+        uint32_t * t = src;  src = dst;  dst = t;
+    }
+    if (src != p) memcpy(p, src, n * sizeof(uint32_t));
+}
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_HISTOGRAM_H
@@ -0,0 +1,580 @@
+/****************************  vector_lookup.h   ******************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining the class template LookupTable for repeated table
+* lookup with vector indexes in tables that are too big for the lookup
+* functions lookup16, lookup32, etc.
+*
+* LookupTable<V, N> contains a table of N elements of the same type as the
+* elements of vector class V. The table is copied and prepared when the
+* object is constructed, so that the setup cost is shared by all lookups.
+* The method is chosen at compile time from the vector type, the table size,
+* and the instruction set:
+*
+* Method            Used when
+* lut_reg512        the table fits into four 512-bit registers (AVX512BW for
+*                   8- and 16-bit elements, AVX512F for 32- and 64-bit elements).
+*                   Uses vpermi2b/vpermt2b with AVX512VBMI, vpermt2w, vpermt2d, vpermt2q
+* lut_reg256        AVX2. The table of 32- or 64-bit elements fits into four 256-bit
+*                   registers. Uses vpermd
+* lut_pshufb        SSSE3. The table is up to 256 bytes in 16-byte pieces. Uses
+*                   one pshufb per piece (up to 4 pieces for 16-64 bit elements)
+* lut_gather        AVX2. Larger tables with elements of 16 bits or more. Uses
+*                   gather instructions
+* lut_scalar        None of the above. Reads the elements one by one
+* lut_split         The vector type is emulated with two half-size vectors
+*
+* Indexes out of range are treated in the same way as in the lookup<n> functions:
+* The index is taken modulo N if N is a power of 2. Otherwise it is limited to N-1.
+* The index is treated as unsigned. The index vector has the same type as V if V
+* is an integer vector. For floating point vectors, the index is a signed
+* integer vector with the same element size, e.g. Vec16i for Vec16f.
+*
+* Example:
+* int8_t dictionary[256] = {...};
+* LookupTable<Vec64c, 256> table(dictionary);   // prepare table
+* Vec64c codes, values;
+* values = table(codes);                        // look up 64 bytes at a time
+* table.lookup_array(out, codes_array, n);      // look up an array of n indexes
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_LOOKUP_H
+#define VECTOR_LOOKUP_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include <stddef.h>                    // define size_t
+#include <string.h>                    // memcpy
+#include <type_traits>                 // std::conditional
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+// Methods for LookupTable
+const int lut_scalar = 0;              // read one element at a time
+const int lut_split  = 1;              // emulated vector type. use half-size vectors
+const int lut_pshufb = 2;              // pshufb on 16-byte pieces of table
+const int lut_reg256 = 3;              // vpermd on 256-bit registers
+const int lut_reg512 = 4;              // permute instructions on 512-bit registers
+const int lut_gather = 5;              // gather instructions
+
+// Table size in bytes above which lookup_array issues prefetch instructions
+#ifndef VCL_LOOKUP_PREFETCH_SIZE
+#define VCL_LOOKUP_PREFETCH_SIZE  (1 << 18)
+#endif
+
+
+/*****************************************************************************
+*
+*          Helper functions for LookupTable
+*
+*****************************************************************************/
+
+// Choose method for LookupTable
+template <typename V, int N>
+constexpr int lookup_method() {
+    constexpr int esize = int(sizeof(typename vector_traits<V>::element_type)); // element size
+    constexpr int vsize = int(sizeof(V));        // vector size
+    constexpr int bytes = N * esize;             // table size
+    // check if the vector type is native or emulated
+    constexpr bool native = vsize <= 16 || (vsize == 32 && INSTRSET >= 8)
+        || (vsize == 64 && (INSTRSET >= 10 || (INSTRSET >= 9 && esize >= 4)));
+    if constexpr (!native) return lut_split;
+    if constexpr (MAX_VECTOR_SIZE >= 512 && bytes <= 256 && (INSTRSET >= 10 || (INSTRSET >= 9 && esize >= 4))) {
+        return lut_reg512;
+    }
+    if constexpr (INSTRSET >= 8 && esize >= 4 && bytes <= 128) return lut_reg256;
+    if constexpr (INSTRSET >= 4 && (bytes <= 64 || (esize == 1 && bytes <= 256))) return lut_pshufb;
+    if constexpr (INSTRSET >= 8 && esize >= 2) return lut_gather;
+    return lut_scalar;
+}
+
+// Limit unsigned index to 0 .. N-1 in the same way as the lookup<n> functions
+template <int N, typename VI>
+static inline VI lookup_limit_index(VI const index) {
+    typedef typename vector_traits<VI>::uint_vector VU;
+    typedef typename vector_traits<VU>::element_type TU;
+    if constexpr (uint64_t(N) > uint64_t(TU(-1))) {
+        return index;                            // all index values are valid
+    }
+    else if constexpr ((N & (N - 1)) == 0) {
+        return VU(index) & TU(N - 1);            // N is a power of 2, make index modulo N
+    }
+    else {
+        return min(VU(index), TU(N - 1));        // N is not a power of 2, limit to N-1
+    }
+}
+
+#if INSTRSET >= 9
+// Extend register to 512 bits. The upper bits are undefined
+static inline __m512i lookup_widen512(__m128i const x) {
+    return _mm512_castsi128_si512(x);
+}
+static inline __m512i lookup_widen512(__m256i const x) {
+    return _mm512_castsi256_si512(x);
+}
+static inline __m512i lookup_widen512(__m512i const x) {
+    return x;
+}
+#endif
+
+#if INSTRSET >= 8
+// Extend register to 256 bits. The upper bits are undefined
+static inline __m256i lookup_widen256(__m128i const x) {
+    return _mm256_castsi128_si256(x);
+}
+static inline __m256i lookup_widen256(__m256i const x) {
+    return x;
+}
+#endif
+
+
+/*****************************************************************************
+*
+*          class template LookupTable
+*
+*****************************************************************************/
+// LookupTable<V, N>: table of N elements of the same type as the elements of V.
+// The third template parameter is the method. It is chosen automatically
+
+template <typename V, int N, int method = lookup_method<V, N>()>
+class LookupTable;
+
+
+// Common base for all methods.
+// Contains a copy of the table padded with zeroes so that a vector can be read
+// from any element position, and a function for looking up arrays
+template <typename V, int N>
+class LookupTableBase {
+public:
+    typedef typename vector_traits<V>::element_type element_type;          // table element type
+    typedef typename vector_traits<V>::int_vector   int_index;                  // signed integer vector
+    typedef typename std::conditional<(V::elementtype() >= 15), int_index, V>::type index_type; // index vector type
+    typedef typename vector_traits<index_type>::element_type index_element; // type of one index
+    static_assert(N > 0, "LookupTable must have at least one element");
+protected:
+    static constexpr int padding = 64 / int(sizeof(element_type));     // extra elements at the end of data
+    alignas(64) element_type data[N + padding];                        // copy of table
+    // copy table into data
+    void copy_table(element_type const * table) {
+        memcpy(data, table, N * sizeof(element_type));
+        memset(data + N, 0, padding * sizeof(element_type));
+    }
+};
+
+
+// Method lut_scalar: read table elements one by one
+template <typename V, int N>
+class LookupTable<V, N, lut_scalar> : public LookupTableBase<V, N> {
+public:
+    typedef LookupTableBase<V, N> Base;
+    typedef typename Base::element_type element_type;
+    typedef typename Base::index_type index_type;
+    typedef typename Base::int_index int_index;
+    LookupTable(element_type const * table) {
+        Base::copy_table(table);
+    }
+    V lookup(index_type const index) const {
+        typedef typename vector_traits<int_index>::uint_vector VU;
+        typename vector_traits<VU>::element_type ii[V::size()];
+        element_type rr[V::size()];
+        VU(lookup_limit_index<N>(int_index(index))).store(ii);
+        for (int j = 0; j < V::size(); j++) rr[j] = Base::data[ii[j]];
+        return V().load(rr);
+    }
+    V operator () (index_type const index) const {
+        return lookup(index);
+    }
+    template <typename TO>
+    void lookup_array(TO * out, typename Base::index_element const * index, size_t n) const;
+};
+
+
+// Method lut_split: the vector type is emulated as two vectors of half size
+template <typename V, int N>
+class LookupTable<V, N, lut_split> {
+public:
+    typedef typename vector_traits<V>::element_type element_type;
+    typedef typename vector_traits<V>::int_vector int_index;
+    typedef typename std::conditional<(V::elementtype() >= 15), int_index, V>::type index_type;
+    typedef typename vector_traits<index_type>::element_type index_element;
+    typedef decltype(V().get_low()) Vhalf;       // half size vector type
+    LookupTable(element_type const * table) : half(table) {}
+    V lookup(index_type const index) const {
+        return V(half.lookup(index.get_low()), half.lookup(index.get_high()));
+    }
+    V operator () (index_type const index) const {
+        return lookup(index);
+    }
+    template <typename TO>
+    void lookup_array(TO * out, index_element const * index, size_t n) const;
+protected:
+    LookupTable<Vhalf, N> half;                  // table for half size vectors
+};
+
+
+// Method lut_pshufb: SSSE3 pshufb on 16-byte pieces of the table.
+// The index is converted to byte indexes. Each piece contributes the bytes
+// that have indexes within the piece. Bytes with other indexes are zeroed
+// by pshufb because the index is made negative by a saturating add.
+template <typename V, int N>
+class LookupTable<V, N, lut_pshufb> : public LookupTableBase<V, N> {
+public:
+    typedef LookupTableBase<V, N> Base;
+    typedef typename Base::element_type element_type;
+    typedef typename Base::index_type index_type;
+    typedef typename Base::int_index int_index;
+    static constexpr int esize = int(sizeof(element_type));
+    static constexpr int npieces = (N * esize + 15) / 16;  // number of 16-byte pieces
+#if MAX_VECTOR_SIZE >= 256
+    typedef typename std::conditional<(sizeof(V) == 32), Vec32c, Vec16c>::type Reg;
+#else
+    typedef Vec16c Reg;
+#endif
+    LookupTable(element_type const * table) {
+        Base::copy_table(table);
+        for (int k = 0; k < npieces; k++) {
+            __m128i piece = _mm_load_si128((__m128i const *)((int8_t const *)Base::data + 16 * k));
+#if INSTRSET >= 8
+            if constexpr (sizeof(V) == 32) {
+                pieces[k] = _mm256_broadcastsi128_si256(piece);  // same piece in both lanes
+            }
+            else
+#endif
+            {
+                pieces[k] = piece;
+            }
+        }
+    }
+    V lookup(index_type const index) const {
+        int_index ix = lookup_limit_index<N>(int_index(index));
+        // convert to byte indexes
+        int_index b;
+        if constexpr (esize == 1) b = ix;
+        else if constexpr (esize == 2) b = ix * int16_t(0x0202) + int16_t(0x0100);
+        else if constexpr (esize == 4) b = ix * int32_t(0x04040404) + int32_t(0x03020100);
+        else b = ix * int_index(int64_t(0x0808080808080808)) + int_index(int64_t(0x0706050403020100));
+#if INSTRSET >= 8
+        if constexpr (sizeof(V) == 32) {
+            __m256i bi = b;
+            __m256i r = _mm256_setzero_si256();
+            for (int k = 0; k < npieces; k++) {
+                __m256i s = _mm256_adds_epu8(bi, _mm256_set1_epi8(0x70));   // bit 7 set if not in this piece
+                r = _mm256_or_si256(r, _mm256_shuffle_epi8(pieces[k], s));
+                bi = _mm256_sub_epi8(bi, _mm256_set1_epi8(16));             // index relative to next piece
+            }
+            return from_int_vector<V>(int_index(r));
+        }
+        else
+#endif
+        {
+            __m128i bi = b;
+            __m128i r = _mm_setzero_si128();
+            for (int k = 0; k < npieces; k++) {
+                __m128i s = _mm_adds_epu8(bi, _mm_set1_epi8(0x70));         // bit 7 set if not in this piece
+                r = _mm_or_si128(r, _mm_shuffle_epi8(pieces[k], s));
+                bi = _mm_sub_epi8(bi, _mm_set1_epi8(16));                   // index relative to next piece
+            }
+            return from_int_vector<V>(int_index(r));
+        }
+    }
+    V operator () (index_type const index) const {
+        return lookup(index);
+    }
+    template <typename TO>
+    void lookup_array(TO * out, typename Base::index_element const * index, size_t n) const;
+protected:
+    Reg pieces[npieces];                         // table pieces
+};
+
+
+#if INSTRSET >= 8
+// Method lut_reg256: AVX2 vpermd on up to four 256-bit registers
+template <typename V, int N>
+class LookupTable<V, N, lut_reg256> : public LookupTableBase<V, N> {
+public:
+    typedef LookupTableBase<V, N> Base;
+    typedef typename Base::element_type element_type;
+    typedef typename Base::index_type index_type;
+    typedef typename Base::int_index int_index;
+    static constexpr int esize = int(sizeof(element_type));
+    static constexpr int nregs = (N * esize + 31) / 32;    // number of registers
+    LookupTable(element_type const * table) {
+        Base::copy_table(table);
+        for (int k = 0; k < nregs; k++) {
+            regs[k] = _mm256_load_si256((__m256i const *)((int8_t const *)Base::data + 32 * k));
+        }
+    }
+    V lookup(index_type const index) const {
+        __m256i ix = lookup_widen256(lookup_limit_index<N>(int_index(index)));
+        __m256i di;                                        // dword indexes
+        if constexpr (esize == 4) {
+            di = ix;
+        }
+        else {                                             // 64-bit elements. make dword index pairs 2*i, 2*i+1
+            di = _mm256_or_si256(_mm256_slli_epi64(ix, 1), _mm256_slli_epi64(ix, 33));
+            di = _mm256_add_epi64(di, _mm256_set1_epi64x(int64_t(0x100000000)));
+        }
+        __m256i r = _mm256_permutevar8x32_epi32(regs[0], di);
+        for (int k = 1; k < nregs; k++) {
+            __m256i rk = _mm256_permutevar8x32_epi32(regs[k], di);
+            r = _mm256_blendv_epi8(r, rk, _mm256_cmpgt_epi32(di, _mm256_set1_epi32(8 * k - 1)));
+        }
+        if constexpr (sizeof(V) == 16) {
+            return from_int_vector<V>(int_index(_mm256_castsi256_si128(r)));
+        }
+        else {
+            return from_int_vector<V>(int_index(r));
+        }
+    }
+    V operator () (index_type const index) const {
+        return lookup(index);
+    }
+    template <typename TO>
+    void lookup_array(TO * out, typename Base::index_element const * index, size_t n) const;
+protected:
+    __m256i regs[nregs];                         // table in registers
+};
+
+
+// Method lut_gather: AVX2 or AVX512 gather instructions
+template <typename V, int N>
+class LookupTable<V, N, lut_gather> : public LookupTableBase<V, N> {
+public:
+    typedef LookupTableBase<V, N> Base;
+    typedef typename Base::element_type element_type;
+    typedef typename Base::index_type index_type;
+    typedef typename Base::int_index int_index;
+    static constexpr int esize = int(sizeof(element_type));
+    static constexpr int vsize = int(sizeof(V));
+    static_assert(esize >= 2, "gather not possible for 8-bit elements");
+    LookupTable(element_type const * table) {
+        Base::copy_table(table);
+    }
+    V lookup(index_type const index) const {
+        int_index ix = lookup_limit_index<N>(int_index(index));
+        void const * t = Base::data;
+        if constexpr (esize == 2) {
+            // gather 32-bit elements and use the lower 16 bits of each. The table
+            // is padded so that it is safe to read two bytes beyond the end
+            if constexpr (vsize == 16) {
+                __m128i e = _mm_i32gather_epi32((int const *)t, _mm_and_si128(ix, _mm_set1_epi32(0xFFFF)), 2);
+                __m128i o = _mm_i32gather_epi32((int const *)t, _mm_srli_epi32(ix, 16), 2);
+                return from_int_vector<V>(int_index(_mm_blend_epi16(e, _mm_slli_epi32(o, 16), 0xAA)));
+            }
+            else if constexpr (vsize == 32) {
+                __m256i e = _mm256_i32gather_epi32((int const *)t, _mm256_and_si256(ix, _mm256_set1_epi32(0xFFFF)), 2);
+                __m256i o = _mm256_i32gather_epi32((int const *)t, _mm256_srli_epi32(ix, 16), 2);
+                return from_int_vector<V>(int_index(_mm256_blend_epi16(e, _mm256_slli_epi32(o, 16), 0xAA)));
+            }
+#if INSTRSET >= 10
+            else {
+                __m512i e = _mm512_i32gather_epi32(_mm512_and_si512(ix, _mm512_set1_epi32(0xFFFF)), t, 2);
+                __m512i o = _mm512_i32gather_epi32(_mm512_srli_epi32(ix, 16), t, 2);
+                return from_int_vector<V>(int_index(_mm512_mask_blend_epi16(0xAAAAAAAA, e, _mm512_slli_epi32(o, 16))));
+            }
+#endif
+        }
+        else if constexpr (esize == 4) {
+            if constexpr (vsize == 16) return from_int_vector<V>(int_index(_mm_i32gather_epi32((int const *)t, ix, 4)));
+            else if constexpr (vsize == 32) return from_int_vector<V>(int_index(_mm256_i32gather_epi32((int const *)t, ix, 4)));
+#if INSTRSET >= 9
+            else return from_int_vector<V>(int_index(_mm512_i32gather_epi32(ix, t, 4)));
+#endif
+        }
+        else {
+            if constexpr (vsize == 16) return from_int_vector<V>(int_index(_mm_i64gather_epi64((long long const *)t, ix, 8)));
+            else if constexpr (vsize == 32) return from_int_vector<V>(int_index(_mm256_i64gather_epi64((long long const *)t, ix, 8)));
+#if INSTRSET >= 9
+            else return from_int_vector<V>(int_index(_mm512_i64gather_epi64(ix, t, 8)));
+#endif
+        }
+    }
+    V operator () (index_type const index) const {
+        return lookup(index);
+    }
+    template <typename TO>
+    void lookup_array(TO * out, typename Base::index_element const * index, size_t n) const;
+};
+#endif  // INSTRSET >= 8
+
+
+#if MAX_VECTOR_SIZE >= 512 && INSTRSET >= 9
+// Method lut_reg512: permute instructions on up to four 512-bit registers.
+// Smaller vectors are extended to 512 bits
+template <typename V, int N>
+class LookupTable<V, N, lut_reg512> : public LookupTableBase<V, N> {
+public:
+    typedef LookupTableBase<V, N> Base;
+    typedef typename Base::element_type element_type;
+    typedef typename Base::index_type index_type;
+    typedef typename Base::int_index int_index;
+    static constexpr int esize = int(sizeof(element_type));
+    static constexpr int nregs = (N * esize + 63) / 64;    // number of registers
+    LookupTable(element_type const * table) {
+        Base::copy_table(table);
+        for (int k = 0; k < 4; k++) {
+            regs[k] = k < nregs ? _mm512_load_si512((int8_t const *)Base::data + 64 * k) : _mm512_setzero_si512();
+        }
+    }
+    V lookup(index_type const index) const {
+        __m512i ix = lookup_widen512(lookup_limit_index<N>(int_index(index)));
+        __m512i r;
+        if constexpr (esize == 1) {
+#if INSTRSET >= 10
+            if constexpr (nregs == 1) r = lookup64(Vec64c(ix), Vec64c(regs[0]));
+            else if constexpr (nregs == 2) r = lookup128(Vec64c(ix), Vec64c(regs[0]), Vec64c(regs[1]));
+            else r = lookup256(Vec64c(ix), Vec64c(regs[0]), Vec64c(regs[1]), Vec64c(regs[2]), Vec64c(regs[3]));
+#endif
+        }
+        else if constexpr (esize == 2) {
+#if INSTRSET >= 10
+            if constexpr (nregs == 1) r = lookup32(Vec32s(ix), Vec32s(regs[0]));
+            else if constexpr (nregs == 2) r = lookup64(Vec32s(ix), Vec32s(regs[0]), Vec32s(regs[1]));
+            else r = lookup128(Vec32s(ix), Vec32s(regs[0]), Vec32s(regs[1]), Vec32s(regs[2]), Vec32s(regs[3]));
+#endif
+        }
+        else if constexpr (esize == 4) {
+            if constexpr (nregs == 1) r = lookup16(Vec16i(ix), Vec16i(regs[0]));
+            else if constexpr (nregs == 2) r = lookup32(Vec16i(ix), Vec16i(regs[0]), Vec16i(regs[1]));
+            else r = lookup64(Vec16i(ix), Vec16i(regs[0]), Vec16i(regs[1]), Vec16i(regs[2]), Vec16i(regs[3]));
+        }
+        else {
+            if constexpr (nregs == 1) r = lookup8(Vec8q(ix), Vec8q(regs[0]));
+            else {
+                Vec8q d12 = _mm512_permutex2var_epi64(regs[0], ix, regs[1]);
+                if constexpr (nregs == 2) r = d12;
+                else {
+                    Vec8q d34 = _mm512_permutex2var_epi64(regs[2], ix, regs[3]);
+                    r = select((Vec8q(ix) >> 4) != 0, d34, d12);
+                }
+            }
+        }
+        if constexpr (sizeof(V) == 16) {
+            return from_int_vector<V>(int_index(_mm512_castsi512_si128(r)));
+        }
+        else if constexpr (sizeof(V) == 32) {
+            return from_int_vector<V>(int_index(_mm512_castsi512_si256(r)));
+        }
+        else {
+            return from_int_vector<V>(int_index(r));
+        }
+    }
+    V operator () (index_type const index) const {
+        return lookup(index);
+    }
+    template <typename TO>
+    void lookup_array(TO * out, typename Base::index_element const * index, size_t n) const;
+protected:
+    __m512i regs[4];                             // table in registers
+};
+#endif  // MAX_VECTOR_SIZE >= 512 && INSTRSET >= 9
+
+
+/*****************************************************************************
+*
+*          Array lookup
+*
+*****************************************************************************/
+// lookup_array: out[i] = table[index[i]] for i = 0 .. n-1.
+// Large tables with the gather method get prefetching of the table elements
+// for index vectors several blocks ahead.
+
+template <typename LUT, typename TI, typename TO>
+static inline void lookup_array_generic(LUT const & table, TO * out, TI const * index, size_t n) {
+    typedef typename LUT::index_type VI;
+    constexpr size_t S = VI::size();             // vector size
+    size_t i = 0;
+    for (; i + S <= n; i += S) {
+        table.lookup(VI().load(index + i)).store(out + i);
+    }
+    if (i < n) {                                 // last partial vector
+        VI x;
+        x.load_partial(int(n - i), index + i);
+        table.lookup(x).store_partial(int(n - i), out + i);
+    }
+}
+
+template <typename V, int N>
+template <typename TO>
+inline void LookupTable<V, N, lut_split>::lookup_array(TO * out, index_element const * index, size_t n) const {
+    lookup_array_generic(*this, out, index, n);
+}
+
+template <typename V, int N>
+template <typename TO>
+inline void LookupTable<V, N, lut_scalar>::lookup_array(TO * out, typename Base::index_element const * index, size_t n) const {
+    lookup_array_generic(*this, out, index, n);
+}
+
+template <typename V, int N>
+template <typename TO>
+inline void LookupTable<V, N, lut_pshufb>::lookup_array(TO * out, typename Base::index_element const * index, size_t n) const {
+    lookup_array_generic(*this, out, index, n);
+}
+
+#if INSTRSET >= 8
+template <typename V, int N>
+template <typename TO>
+inline void LookupTable<V, N, lut_reg256>::lookup_array(TO * out, typename Base::index_element const * index, size_t n) const {
+    lookup_array_generic(*this, out, index, n);
+}
+
+template <typename V, int N>
+template <typename TO>
+inline void LookupTable<V, N, lut_gather>::lookup_array(TO * out, typename Base::index_element const * index, size_t n) const {
+    constexpr size_t S = V::size();              // vector size
+    constexpr size_t D = 8;                      // prefetch distance, vectors
+    if constexpr (N * sizeof(element_type) >= VCL_LOOKUP_PREFETCH_SIZE) {
+        // big table. Prefetch the table elements needed for the index vector D blocks ahead
+        size_t i = 0;
+        for (; i + (D + 1) * S <= n; i += S) {
+            for (size_t j = 0; j < S; j++) {
+                typename Base::index_element ij = index[i + D * S + j];
+                size_t k = size_t(ij) < size_t(N) ? size_t(ij) : size_t(N - 1);
+                _mm_prefetch((char const *)(Base::data + k), _MM_HINT_T0);
+            }
+            lookup(index_type().load(index + i)).store(out + i);
+        }
+        lookup_array_generic(*this, out + i, index + i, n - i);
+    }
+    else {
+        lookup_array_generic(*this, out, index, n);
+    }
+}
+#endif
+
+#if MAX_VECTOR_SIZE >= 512 && INSTRSET >= 9
+template <typename V, int N>
+template <typename TO>
+inline void LookupTable<V, N, lut_reg512>::lookup_array(TO * out, typename Base::index_element const * index, size_t n) const {
+    lookup_array_generic(*this, out, index, n);
+}
+#endif
+
+
+// lookup(index, table): same as table.lookup(index)
+template <typename V, int N, int method>
+static inline V lookup(typename LookupTable<V, N, method>::index_type const index, LookupTable<V, N, method> const & table) {
+    return table.lookup(index);
+}
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_LOOKUP_H
@@ -0,0 +1,516 @@
+/****************************  vector_matrix.h   ******************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining small matrix kernels: transposition of square blocks held
+* in vector registers, multiplication of square matrices held in registers, and
+* matrix-vector and matrix-matrix multiplication of float and double matrices.
+* This header is optional. It is not included by vectorclass.h.
+*
+* Functions defined here. The rows of the matrix are in the array r of vectors:
+* transpose2x2(Vec2d r[2])
+* transpose4x4(Vec4f r[4]), transpose4x4(Vec4d r[4])
+* transpose8x8(Vec8f r[8]), transpose8x8(Vec8d r[8])
+* transpose16x16(Vec16f r[16])
+* transpose4x4 and transpose8x8 are also defined with the rows as separate
+* reference parameters, e.g. transpose8x8(r0, r1, r2, r3, r4, r5, r6, r7)
+*
+* matmul(a, b, c)         c = a * b for square matrices of V::size() x V::size()
+*                         elements. The rows are in the arrays a, b and c of vectors
+* matrix_transpose(m, n, a, lda, b, ldb)   b = transpose of m x n matrix a
+* gemv(m, n, a, lda, x, y)                 y = a * x for m x n matrix a
+* gemv_t(m, n, a, lda, x, y)               y = transpose(a) * x
+* gemm(m, n, k, a, lda, b, ldb, c, ldc)    c = a * b for m x k matrix a and
+*                                          k x n matrix b
+* gemm_kernel<V, MR, NV>(...)              register tile of gemm with MR rows
+*                                          and NV vectors of columns
+*
+* The matrices are stored in row-major order. lda, ldb, ldc are the distances
+* between the rows in number of elements. gemv, gemv_t and gemm add to the
+* existing contents of the output if the last parameter, accumulate, is true.
+* The vector class V is an optional template parameter. The default is the
+* biggest vector class that the instruction set supports.
+*
+* gemm computes one tile of the output at a time in registers, using mul_add.
+* The tile is 6 rows x 2 vectors (6x16 floats with AVX2) when there are 16 vector
+* registers, and 14 rows x 2 vectors (14x32 floats with AVX512) when there are 32
+* vector registers. This reaches close to the maximum throughput of the FMA units
+* when the matrices fit into the level 1 or level 2 cache. There is no packing
+* and no cache blocking, so a BLAS library is faster for big matrices.
+*
+* Example:
+* // multiply 4x4 matrices of floats
+* Vec4f a[4], b[4], c[4];
+* for (int i = 0; i < 4; i++) {a[i].load(pa + 4*i);  b[i].load(pb + 4*i);}
+* matmul(a, b, c);
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_MATRIX_H
+#define VECTOR_MATRIX_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include "vector_array.h"              // array_vector_select
+#include <utility>                     // std::integer_sequence
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*          Transpose square blocks
+*
+*****************************************************************************/
+
+// Transpose a 2n x 2n matrix where each row is a vector V of size 2n, using the
+// transpose f of the n x n sub-matrices in the halves of the vectors
+template <int n, typename V, typename F>
+static inline void transpose_by_halves(V r[], F f) {
+    typedef decltype(r[0].get_low()) H;
+    H a[n], b[n], c[n], d[n];
+    for (int i = 0; i < n; i++) {
+        a[i] = r[i].get_low();                   // upper left
+        b[i] = r[i].get_high();                  // upper right
+        c[i] = r[i + n].get_low();               // lower left
+        d[i] = r[i + n].get_high();              // lower right
+    }
+    f(a);  f(b);  f(c);  f(d);
+    for (int i = 0; i < n; i++) {
+        r[i] = V(a[i], c[i]);
+        r[i + n] = V(b[i], d[i]);
+    }
+}
+
+// Transpose 2x2 matrix of doubles
+static inline void transpose2x2(Vec2d r[2]) {
+    Vec2d t = _mm_unpacklo_pd(r[0], r[1]);
+    r[1] = _mm_unpackhi_pd(r[0], r[1]);
+    r[0] = t;
+}
+
+// Transpose 4x4 matrix of floats
+static inline void transpose4x4(Vec4f r[4]) {
+    __m128 t0 = _mm_unpacklo_ps(r[0], r[1]);     // 00 10 01 11
+    __m128 t1 = _mm_unpacklo_ps(r[2], r[3]);     // 20 30 21 31
+    __m128 t2 = _mm_unpackhi_ps(r[0], r[1]);     // 02 12 03 13
+    __m128 t3 = _mm_unpackhi_ps(r[2], r[3]);     // 22 32 23 33
+    r[0] = _mm_movelh_ps(t0, t1);                // 00 10 20 30
+    r[1] = _mm_movehl_ps(t1, t0);                // 01 11 21 31
+    r[2] = _mm_movelh_ps(t2, t3);                // 02 12 22 32
+    r[3] = _mm_movehl_ps(t3, t2);                // 03 13 23 33
+}
+
+#if MAX_VECTOR_SIZE >= 256
+// Transpose 4x4 matrix of doubles
+static inline void transpose4x4(Vec4d r[4]) {
+#if INSTRSET >= 7  // AVX
+    __m256d t0 = _mm256_unpacklo_pd(r[0], r[1]); // 00 10 | 02 12
+    __m256d t1 = _mm256_unpackhi_pd(r[0], r[1]); // 01 11 | 03 13
+    __m256d t2 = _mm256_unpacklo_pd(r[2], r[3]); // 20 30 | 22 32
+    __m256d t3 = _mm256_unpackhi_pd(r[2], r[3]); // 21 31 | 23 33
+    r[0] = _mm256_permute2f128_pd(t0, t2, 0x20);
+    r[1] = _mm256_permute2f128_pd(t1, t3, 0x20);
+    r[2] = _mm256_permute2f128_pd(t0, t2, 0x31);
+    r[3] = _mm256_permute2f128_pd(t1, t3, 0x31);
+#else
+    transpose_by_halves<2>(r, [](Vec2d * h) {transpose2x2(h);});
+#endif
+}
+
+// Transpose 8x8 matrix of floats
+static inline void transpose8x8(Vec8f r[8]) {
+#if INSTRSET >= 7  // AVX
+    __m256 t[8], s[8];
+    for (int i = 0; i < 4; i++) {
+        t[2*i]   = _mm256_unpacklo_ps(r[2*i], r[2*i+1]);   // rows 2i, 2i+1 of columns 0,1 | 4,5
+        t[2*i+1] = _mm256_unpackhi_ps(r[2*i], r[2*i+1]);   // rows 2i, 2i+1 of columns 2,3 | 6,7
+    }
+    for (int i = 0; i < 2; i++) {                // 4 rows of each column
+        s[4*i]   = _mm256_shuffle_ps(t[4*i],   t[4*i+2], 0x44);  // columns 0 | 4
+        s[4*i+1] = _mm256_shuffle_ps(t[4*i],   t[4*i+2], 0xEE);  // columns 1 | 5
+        s[4*i+2] = _mm256_shuffle_ps(t[4*i+1], t[4*i+3], 0x44);  // columns 2 | 6
+        s[4*i+3] = _mm256_shuffle_ps(t[4*i+1], t[4*i+3], 0xEE);  // columns 3 | 7
+    }
+    for (int i = 0; i < 4; i++) {
+        r[i]     = _mm256_permute2f128_ps(s[i], s[i+4], 0x20);
+        r[i+4]   = _mm256_permute2f128_ps(s[i], s[i+4], 0x31);
+    }
+#else
+    transpose_by_halves<4>(r, [](Vec4f * h) {transpose4x4(h);});
+#endif
+}
+#endif // MAX_VECTOR_SIZE >= 256
+
+#if MAX_VECTOR_SIZE >= 512
+// Transpose 8x8 matrix of doubles
+static inline void transpose8x8(Vec8d r[8]) {
+#if INSTRSET >= 9  // AVX512F
+    __m512d t[8], u[4], v[4];
+    for (int i = 0; i < 4; i++) {
+        t[2*i]   = _mm512_unpacklo_pd(r[2*i], r[2*i+1]);   // rows 2i, 2i+1 of columns 0 | 2 | 4 | 6
+        t[2*i+1] = _mm512_unpackhi_pd(r[2*i], r[2*i+1]);   // rows 2i, 2i+1 of columns 1 | 3 | 5 | 7
+    }
+    u[0] = _mm512_shuffle_f64x2(t[0], t[2], 0x88);  // rows 0-3 of columns 0 | 4
+    u[1] = _mm512_shuffle_f64x2(t[1], t[3], 0x88);  // columns 1 | 5
+    u[2] = _mm512_shuffle_f64x2(t[0], t[2], 0xDD);  // columns 2 | 6
+    u[3] = _mm512_shuffle_f64x2(t[1], t[3], 0xDD);  // columns 3 | 7
+    v[0] = _mm512_shuffle_f64x2(t[4], t[6], 0x88);  // rows 4-7
+    v[1] = _mm512_shuffle_f64x2(t[5], t[7], 0x88);
+    v[2] = _mm512_shuffle_f64x2(t[4], t[6], 0xDD);
+    v[3] = _mm512_shuffle_f64x2(t[5], t[7], 0xDD);
+    for (int i = 0; i < 4; i++) {
+        r[i]     = _mm512_shuffle_f64x2(u[i], v[i], 0x88);
+        r[i+4]   = _mm512_shuffle_f64x2(u[i], v[i], 0xDD);
+    }
+#else
+    transpose_by_halves<4>(r, [](Vec4d * h) {transpose4x4(h);});
+#endif
+}
+
+// Transpose 16x16 matrix of floats
+static inline void transpose16x16(Vec16f r[16]) {
+#if INSTRSET >= 9  // AVX512F
+    __m512 t[16], s[16], u[8], v[8];
+    for (int i = 0; i < 8; i++) {
+        t[2*i]   = _mm512_unpacklo_ps(r[2*i], r[2*i+1]);   // rows 2i, 2i+1 of columns 0,1 | 4,5 | 8,9 | 12,13
+        t[2*i+1] = _mm512_unpackhi_ps(r[2*i], r[2*i+1]);   // rows 2i, 2i+1 of columns 2,3 | 6,7 | 10,11 | 14,15
+    }
+    for (int i = 0; i < 4; i++) {                // 4 rows of each column
+        s[4*i]   = _mm512_shuffle_ps(t[4*i],   t[4*i+2], 0x44);  // columns 0 | 4 | 8 | 12
+        s[4*i+1] = _mm512_shuffle_ps(t[4*i],   t[4*i+2], 0xEE);  // columns 1 | 5 | 9 | 13
+        s[4*i+2] = _mm512_shuffle_ps(t[4*i+1], t[4*i+3], 0x44);  // columns 2 | 6 | 10 | 14
+        s[4*i+3] = _mm512_shuffle_ps(t[4*i+1], t[4*i+3], 0xEE);  // columns 3 | 7 | 11 | 15
+    }
+    for (int j = 0; j < 4; j++) {
+        u[j]     = _mm512_shuffle_f32x4(s[j],     s[j+4],  0x88);  // rows 0-7 of columns j | j+8
+        u[j+4]   = _mm512_shuffle_f32x4(s[j],     s[j+4],  0xDD);  // rows 0-7 of columns j+4 | j+12
+        v[j]     = _mm512_shuffle_f32x4(s[j+8],   s[j+12], 0x88);  // rows 8-15
+        v[j+4]   = _mm512_shuffle_f32x4(s[j+8],   s[j+12], 0xDD);
+    }
+    for (int j = 0; j < 4; j++) {
+        r[j]     = _mm512_shuffle_f32x4(u[j],   v[j],   0x88);
+        r[j+8]   = _mm512_shuffle_f32x4(u[j],   v[j],   0xDD);
+        r[j+4]   = _mm512_shuffle_f32x4(u[j+4], v[j+4], 0x88);
+        r[j+12]  = _mm512_shuffle_f32x4(u[j+4], v[j+4], 0xDD);
+    }
+#else
+    transpose_by_halves<8>(r, [](Vec8f * h) {transpose8x8(h);});
+#endif
+}
+#endif // MAX_VECTOR_SIZE >= 512
+
+// Versions with the rows as separate parameters
+static inline void transpose4x4(Vec4f & r0, Vec4f & r1, Vec4f & r2, Vec4f & r3) {
+    Vec4f r[4] = {r0, r1, r2, r3};
+    transpose4x4(r);
+    r0 = r[0];  r1 = r[1];  r2 = r[2];  r3 = r[3];
+}
+
+#if MAX_VECTOR_SIZE >= 256
+static inline void transpose4x4(Vec4d & r0, Vec4d & r1, Vec4d & r2, Vec4d & r3) {
+    Vec4d r[4] = {r0, r1, r2, r3};
+    transpose4x4(r);
+    r0 = r[0];  r1 = r[1];  r2 = r[2];  r3 = r[3];
+}
+
+static inline void transpose8x8(Vec8f & r0, Vec8f & r1, Vec8f & r2, Vec8f & r3,
+    Vec8f & r4, Vec8f & r5, Vec8f & r6, Vec8f & r7) {
+    Vec8f r[8] = {r0, r1, r2, r3, r4, r5, r6, r7};
+    transpose8x8(r);
+    r0 = r[0];  r1 = r[1];  r2 = r[2];  r3 = r[3];
+    r4 = r[4];  r5 = r[5];  r6 = r[6];  r7 = r[7];
+}
+#endif
+
+#if MAX_VECTOR_SIZE >= 512
+static inline void transpose8x8(Vec8d & r0, Vec8d & r1, Vec8d & r2, Vec8d & r3,
+    Vec8d & r4, Vec8d & r5, Vec8d & r6, Vec8d & r7) {
+    Vec8d r[8] = {r0, r1, r2, r3, r4, r5, r6, r7};
+    transpose8x8(r);
+    r0 = r[0];  r1 = r[1];  r2 = r[2];  r3 = r[3];
+    r4 = r[4];  r5 = r[5];  r6 = r[6];  r7 = r[7];
+}
+#endif
+
+// Transpose a square block of V::size() rows, calling the function for the size of V
+template <typename V>
+static inline void transpose_block(V r[]) {
+    constexpr int N = V::size();
+    if constexpr (N == 2) transpose2x2(r);
+    else if constexpr (N == 4) transpose4x4(r);
+    else if constexpr (N == 8) transpose8x8(r);
+    else transpose16x16(r);
+}
+
+
+/*****************************************************************************
+*
+*          Multiply square matrices in registers
+*
+*****************************************************************************/
+
+// Broadcast element k of a to all elements
+template <int k, typename V, int ... J>
+static inline V matrix_broadcast(V const a, std::integer_sequence<int, J...>) {
+    return permute_n<(J * 0 + k)...>(a);
+}
+
+// Row i of a * b = sum over k of a[i][k] * b[k]
+template <typename V, int ... K>
+static inline V matmul_row(V const a, V const b[], std::integer_sequence<int, K...> s) {
+    V c(0);
+    ((c = mul_add(matrix_broadcast<K>(a, s), b[K], c)), ...);
+    return c;
+}
+
+// c = a * b for square matrices with V::size() rows. Each row is a vector.
+// c must not be the same array as a or b
+template <typename V>
+static inline void matmul(V const a[], V const b[], V c[]) {
+    for (int i = 0; i < V::size(); i++) {
+        c[i] = matmul_row(a[i], b, std::make_integer_sequence<int, V::size()>());
+    }
+}
+
+
+/*****************************************************************************
+*
+*          Transpose matrix in memory
+*
+*****************************************************************************/
+
+// b = transpose of the m x n matrix a. b has n rows of m elements.
+// The matrix is divided into square blocks of V::size() x V::size() elements,
+// which are transposed in registers. The remaining rows and columns are done
+// one element at a time
+template <typename V = void, typename T>
+static inline void matrix_transpose(int m, int n, T const * a, int lda, T * b, int ldb) {
+    typedef array_vector_select<V, T> VV;
+    constexpr int N = VV::size();
+    int i = 0, j = 0;
+    for (i = 0; i + N <= m; i += N) {
+        for (j = 0; j + N <= n; j += N) {
+            VV r[N];
+            for (int k = 0; k < N; k++) r[k].load(a + (size_t)(i + k) * lda + j);
+            transpose_block(r);
+            for (int k = 0; k < N; k++) r[k].store(b + (size_t)(j + k) * ldb + i);
+        }
+    }
+    // remaining columns of a in the rows done above
+    for (int ii = 0; ii < i; ii++) {
+        for (int jj = j; jj < n; jj++) b[(size_t)jj * ldb + ii] = a[(size_t)ii * lda + jj];
+    }
+    // remaining rows of a
+    for (int ii = i; ii < m; ii++) {
+        for (int jj = 0; jj < n; jj++) b[(size_t)jj * ldb + ii] = a[(size_t)ii * lda + jj];
+    }
+}
+
+
+/*****************************************************************************
+*
+*          Matrix-vector multiplication
+*
+*****************************************************************************/
+
+// Dot products of R consecutive rows of a with x
+template <typename V, int R, typename T, int ... I>
+static inline void gemv_rows(int n, T const * a, int lda, T const * x, T * y, bool accumulate, std::integer_sequence<int, I...>) {
+    constexpr int N = V::size();
+    V acc[R];
+    ((acc[I] = V(0)), ...);
+    int j = 0;
+    for (; j + N <= n; j += N) {
+        V xv = V().load(x + j);
+        ((acc[I] = mul_add(V().load(a + (size_t)I * lda + j), xv, acc[I])), ...);
+    }
+    if (j < n) {                                 // last partial vector, padded with zeros
+        V xv = V().load_partial(n - j, x + j);
+        ((acc[I] = mul_add(V().load_partial(n - j, a + (size_t)I * lda + j), xv, acc[I])), ...);
+    }
+    ((y[I] = horizontal_add(acc[I]) + (accumulate ? y[I] : T(0))), ...);
+}
+
+// y = a * x for the m x n matrix a. x has n elements and y has m elements.
+// Four rows are done at a time so that each vector of x is loaded only once
+template <typename V = void, typename T>
+static inline void gemv(int m, int n, T const * a, int lda, T const * x, T * y, bool accumulate = false) {
+    typedef array_vector_select<V, T> VV;
+    int i = 0;
+    for (; i + 4 <= m; i += 4) {
+        gemv_rows<VV, 4>(n, a + (size_t)i * lda, lda, x, y + i, accumulate, std::make_integer_sequence<int, 4>());
+    }
+    for (; i < m; i++) {
+        gemv_rows<VV, 1>(n, a + (size_t)i * lda, lda, x, y + i, accumulate, std::make_integer_sequence<int, 1>());
+    }
+}
+
+// y[0 .. U*N-1] = sum over rows i of x[i] * a[i][0 .. U*N-1] for U vectors of N columns.
+// The last vector has only nlast elements if partial is true
+template <typename V, bool partial, typename T, int ... J>
+static inline void gemv_t_columns(int m, T const * a, int lda, T const * x, T * y, int nlast, bool accumulate, std::integer_sequence<int, J...>) {
+    constexpr int N = V::size();
+    constexpr int U = sizeof...(J);
+    V acc[U];
+    if (accumulate) {
+        ((acc[J] = (partial && J == U - 1) ? V().load_partial(nlast, y + J * N) : V().load(y + J * N)), ...);
+    }
+    else {
+        ((acc[J] = V(0)), ...);
+    }
+    for (int i = 0; i < m; i++) {
+        V xv(x[i]);
+        T const * p = a + (size_t)i * lda;
+        ((acc[J] = mul_add((partial && J == U - 1) ? V().load_partial(nlast, p + J * N) : V().load(p + J * N), xv, acc[J])), ...);
+    }
+    (((partial && J == U - 1) ? acc[J].store_partial(nlast, y + J * N) : acc[J].store(y + J * N)), ...);
+}
+
+// y = transpose(a) * x for the m x n matrix a. x has m elements and y has n elements.
+// Four vectors of y are accumulated at a time
+template <typename V = void, typename T>
+static inline void gemv_t(int m, int n, T const * a, int lda, T const * x, T * y, bool accumulate = false) {
+    typedef array_vector_select<V, T> VV;
+    constexpr int N = VV::size();
+    int j = 0;
+    for (; j + 4 * N <= n; j += 4 * N) {
+        gemv_t_columns<VV, false>(m, a + j, lda, x, y + j, N, accumulate, std::make_integer_sequence<int, 4>());
+    }
+    for (; j + N <= n; j += N) {
+        gemv_t_columns<VV, false>(m, a + j, lda, x, y + j, N, accumulate, std::make_integer_sequence<int, 1>());
+    }
+    if (j < n) {
+        gemv_t_columns<VV, true>(m, a + j, lda, x, y + j, n - j, accumulate, std::make_integer_sequence<int, 1>());
+    }
+}
+
+
+/*****************************************************************************
+*
+*          Matrix-matrix multiplication
+*
+*****************************************************************************/
+
+// Number of rows in the register tile of gemm. The tile has MR x 2 vectors of
+// accumulators, plus 2 vectors of b and one broadcast of a
+constexpr int gemm_rows = INSTRSET >= 9 ? 14 : 6;  // 32 or 16 vector registers
+
+// Load NV vectors from p. The last vector has only nlast elements if partial is true
+template <typename V, bool partial, typename T, int ... J>
+static inline void gemm_load(V v[], T const * p, int nlast, std::integer_sequence<int, J...>) {
+    constexpr int NV = sizeof...(J);
+    ((v[J] = (partial && J == NV - 1) ? V().load_partial(nlast, p + J * V::size()) : V().load(p + J * V::size())), ...);
+}
+
+// Store NV vectors to p. The last vector has only nlast elements if partial is true
+template <typename V, bool partial, typename T, int ... J>
+static inline void gemm_store(V const v[], T * p, int nlast, std::integer_sequence<int, J...>) {
+    constexpr int NV = sizeof...(J);
+    (((partial && J == NV - 1) ? v[J].store_partial(nlast, p + J * V::size()) : v[J].store(p + J * V::size())), ...);
+}
+
+// Load the accumulators for MR rows of c
+template <typename V, int NV, bool partial, typename T, int ... I>
+static inline void gemm_load_rows(V acc[][NV], T const * c, int ldc, int nlast, std::integer_sequence<int, I...>) {
+    (gemm_load<V, partial>(acc[I], c + (size_t)I * ldc, nlast, std::make_integer_sequence<int, NV>()), ...);
+}
+
+// Store the accumulators for MR rows of c
+template <typename V, int NV, bool partial, typename T, int ... I>
+static inline void gemm_store_rows(V const acc[][NV], T * c, int ldc, int nlast, std::integer_sequence<int, I...>) {
+    (gemm_store<V, partial>(acc[I], c + (size_t)I * ldc, nlast, std::make_integer_sequence<int, NV>()), ...);
+}
+
+// acc[j] += a * b[j] for one row of the tile
+template <typename V, typename T, int ... J>
+static inline void gemm_update_row(V acc[], V const b[], T a, std::integer_sequence<int, J...>) {
+    V av(a);                                     // broadcast
+    ((acc[J] = mul_add(av, b[J], acc[J])), ...);
+}
+
+// acc[i][j] += a[i] * b[j] for one element a[i] of each of the MR rows
+template <typename V, int NV, typename T, int ... I>
+static inline void gemm_update(V acc[][NV], V const b[], T const * a, int lda, std::integer_sequence<int, I...>) {
+    (gemm_update_row(acc[I], b, a[(size_t)I * lda], std::make_integer_sequence<int, NV>()), ...);
+}
+
+// Register tile of gemm: c[0 .. MR-1][0 .. NV*N-1] = a[0 .. MR-1][0 .. k-1] * b[0 .. k-1][0 .. NV*N-1]
+// where N = V::size(). The last vector of each row has only nlast elements if partial is true.
+// The accumulators are 2 * MR vectors, which must fit into the vector registers
+template <typename V, int MR, int NV, bool partial = false, typename T>
+static inline void gemm_kernel(int k, T const * a, int lda, T const * b, int ldb, T * c, int ldc, int nlast, bool accumulate) {
+    V acc[MR][NV];
+    if (accumulate) {
+        gemm_load_rows<V, NV, partial>(acc, c, ldc, nlast, std::make_integer_sequence<int, MR>());
+    }
+    else {
+        for (int i = 0; i < MR; i++) {
+            for (int j = 0; j < NV; j++) acc[i][j] = V(0);
+        }
+    }
+    for (int p = 0; p < k; p++) {
+        V bv[NV];
+        gemm_load<V, partial>(bv, b + (size_t)p * ldb, nlast, std::make_integer_sequence<int, NV>());
+        gemm_update<V, NV>(acc, bv, a + p, lda, std::make_integer_sequence<int, MR>());
+    }
+    gemm_store_rows<V, NV, partial>(acc, c, ldc, nlast, std::make_integer_sequence<int, MR>());
+}
+
+// gemm_kernel for mr <= MR rows
+template <typename V, int MR, int NV, bool partial, typename T>
+static inline void gemm_kernel_rows(int mr, int k, T const * a, int lda, T const * b, int ldb, T * c, int ldc, int nlast, bool accumulate) {
+    if constexpr (MR > 1) {
+        if (mr < MR) {
+            gemm_kernel_rows<V, MR - 1, NV, partial>(mr, k, a, lda, b, ldb, c, ldc, nlast, accumulate);
+            return;
+        }
+    }
+    gemm_kernel<V, MR, NV, partial>(k, a, lda, b, ldb, c, ldc, nlast, accumulate);
+}
+
+// gemm for all rows of a column block of NV vectors
+template <typename V, int NV, bool partial, typename T>
+static inline void gemm_columns(int m, int k, T const * a, int lda, T const * b, int ldb, T * c, int ldc, int nlast, bool accumulate) {
+    constexpr int MR = gemm_rows;
+    for (int i = 0; i < m; i += MR) {
+        gemm_kernel_rows<V, MR, NV, partial>(m - i < MR ? m - i : MR, k, a + (size_t)i * lda, lda, b, ldb, c + (size_t)i * ldc, ldc, nlast, accumulate);
+    }
+}
+
+// c = a * b for the m x k matrix a and the k x n matrix b. c is m x n.
+// c must not overlap a or b
+template <typename V = void, typename T>
+static inline void gemm(int m, int n, int k, T const * a, int lda, T const * b, int ldb, T * c, int ldc, bool accumulate = false) {
+    typedef array_vector_select<V, T> VV;
+    constexpr int N = VV::size();
+    int j = 0;
+    for (; j + 2 * N <= n; j += 2 * N) {         // column blocks of 2 vectors
+        gemm_columns<VV, 2, false>(m, k, a, lda, b + j, ldb, c + j, ldc, N, accumulate);
+    }
+    for (; j + N <= n; j += N) {                 // one vector
+        gemm_columns<VV, 1, false>(m, k, a, lda, b + j, ldb, c + j, ldc, N, accumulate);
+    }
+    if (j < n) {                                 // last partial vector
+        gemm_columns<VV, 1, true>(m, k, a, lda, b + j, ldb, c + j, ldc, n - j, accumulate);
+    }
+}
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_MATRIX_H
@@ -0,0 +1,424 @@
+/****************************  vector_memory.h   ******************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining aligned memory allocation for arrays that are processed
+* with vector instructions.
+* This header is optional. It is not included by vectorclass.h.
+*
+* Classes and functions defined here:
+* AlignedAllocator<T, Align>   Allocator for standard containers. The memory is
+*                              aligned by Align bytes, default MAX_VECTOR_SIZE/8
+* AlignedVector<T, Align>      Dynamic array with aligned data. The capacity is
+*                              a multiple of the vector size, and the elements
+*                              after the end are zero
+* AlignedArena                 Fast allocation of aligned scratch buffers that
+*                              are released all together
+* AlignedArenaScope            Releases the buffers allocated from an arena in
+*                              the scope of this object when it goes out of scope
+* scratch_arena()              An AlignedArena for each thread
+* aligned_allocate(bytes, align), aligned_deallocate(p, align)
+*                              Allocate and free aligned memory
+*
+* A vector load or store that crosses a cache line boundary takes more time than
+* an aligned one. The array functions in vector_array.h therefore do the first few
+* elements separately for an array that is not aligned by the vector size.
+* Arrays allocated with the classes in this header need no such head.
+*
+* The size of an AlignedVector is padded up to a whole number of vectors. The
+* padding elements are zero, so that the last vector can be read with a full load.
+* padded_size() gives the number of elements rounded up to a multiple of the
+* vector size. The array functions in vector_array.h can use padded_size() as the
+* number of elements, so that no partial vector is needed at the end. A function
+* that scans or reduces the array must then give the correct result for the
+* zero padding. A transform writes into the padding, and clear_padding() sets
+* it to zero again.
+*
+* AlignedArena allocates buffers consecutively from big blocks of memory. The
+* buffers are released all together with reset(), or back to a mark. This is much
+* faster than allocating each temporary buffer of a function with new or malloc.
+* The buffers are not initialized. An arena may be used by one thread only.
+* scratch_arena() gives a separate arena for each thread, so that a function
+* called in a thread pool can get scratch memory without locking. A function
+* that uses scratch_arena() should contain an AlignedArenaScope object, so that
+* the memory is released when the function returns, and nested function calls
+* do not release each other's buffers.
+*
+* Example:
+* // y = exp(x), without partial vectors
+* AlignedVector<float> x(1000), y(1000);
+* transform_vec<Vec16f>(y.data(), x.padded_size(), [](Vec16f a) {return exp(a);}, x.data());
+*
+* // temporary buffer
+* AlignedArenaScope scope(scratch_arena());
+* float * temp = scratch_arena().allocate<float>(n);
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_MEMORY_H
+#define VECTOR_MEMORY_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include <stddef.h>                    // define size_t
+#include <string.h>                    // memcpy
+#include <new>                         // std::align_val_t, std::bad_array_new_length
+#include <initializer_list>            // std::initializer_list
+#include <type_traits>                 // std::is_trivially_copyable
+#include <utility>                     // std::swap
+#include <vector>                      // std::vector
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*          Aligned allocation
+*
+*****************************************************************************/
+
+// Round n up to a multiple of a. a must be a power of 2
+static inline constexpr size_t aligned_size(size_t n, size_t a) {
+    return (n + a - 1) & ~(a - 1);
+}
+
+// Allocate memory aligned by align bytes. align must be a power of 2.
+// Throws std::bad_alloc if out of memory
+static inline void * aligned_allocate(size_t bytes, size_t align) {
+    return ::operator new(bytes, std::align_val_t(align));
+}
+
+// Free memory allocated with aligned_allocate. align must be the same
+static inline void aligned_deallocate(void * p, size_t align) noexcept {
+    ::operator delete(p, std::align_val_t(align));
+}
+
+
+/*****************************************************************************
+*
+*          class template AlignedAllocator
+*
+*****************************************************************************/
+// Allocator for standard containers, e.g. std::vector<float, AlignedAllocator<float>>.
+// The memory is aligned by Align bytes, and the size is rounded up to a multiple of
+// Align bytes. A full vector can therefore be read at the end of the allocated memory,
+// but the standard containers do not initialize the elements after size()
+
+template <typename T, size_t Align = MAX_VECTOR_SIZE / 8>
+class AlignedAllocator {
+    static_assert((Align & (Align - 1)) == 0 && Align >= alignof(T), "Align must be a power of 2 and at least the alignment of T");
+public:
+    typedef T value_type;
+    template <typename U> struct rebind {
+        typedef AlignedAllocator<U, Align> other;
+    };
+    AlignedAllocator() noexcept = default;
+    template <typename U>
+    AlignedAllocator(AlignedAllocator<U, Align> const &) noexcept {}
+    // Allocate memory for n elements
+    T * allocate(size_t n) {
+        if (n > (size_t(-1) - Align) / sizeof(T)) throw std::bad_array_new_length();
+        return static_cast<T*>(aligned_allocate(aligned_size(n * sizeof(T), Align), Align));
+    }
+    // Free memory allocated with allocate
+    void deallocate(T * p, size_t) noexcept {
+        aligned_deallocate(p, Align);
+    }
+};
+
+// All instances of AlignedAllocator with the same alignment are equal
+template <typename T, typename U, size_t Align>
+static inline bool operator == (AlignedAllocator<T, Align> const &, AlignedAllocator<U, Align> const &) {
+    return true;
+}
+
+template <typename T, typename U, size_t Align>
+static inline bool operator != (AlignedAllocator<T, Align> const &, AlignedAllocator<U, Align> const &) {
+    return false;
+}
+
+
+/*****************************************************************************
+*
+*          class template AlignedVector
+*
+*****************************************************************************/
+// Dynamic array of elements of type T. The data are aligned by Align bytes, and the
+// capacity is a multiple of padding = Align / sizeof(T) elements. All elements from
+// size() to capacity() are zero, unless they have been written through data() or a
+// pointer to an element. T must be trivially copyable, e.g. an arithmetic type
+
+template <typename T, size_t Align = MAX_VECTOR_SIZE / 8>
+class AlignedVector {
+    static_assert(std::is_trivially_copyable<T>::value, "AlignedVector needs a trivially copyable element type");
+    static_assert(Align % sizeof(T) == 0, "Align must be a multiple of the element size");
+public:
+    typedef T value_type;
+    typedef T * iterator;
+    typedef T const * const_iterator;
+    static constexpr size_t padding = Align / sizeof(T);  // capacity is a multiple of this
+protected:
+    T * p;                                       // data
+    size_t n;                                    // number of elements
+    size_t cap;                                  // number of allocated elements
+    // Move the elements to new memory with room for at least m >= n elements. The rest is zero
+    void reallocate(size_t m) {
+        m = aligned_size(m, padding);
+        T * q = AlignedAllocator<T, Align>().allocate(m);
+        if (n > 0) memcpy(q, p, n * sizeof(T));
+        fill(q + n, q + m, T());
+        if (p) AlignedAllocator<T, Align>().deallocate(p, cap);
+        p = q;  cap = m;
+    }
+    static void fill(T * b, T * e, T const x) {
+        for (; b < e; b++) *b = x;
+    }
+public:
+    // Empty array
+    AlignedVector() : p(nullptr), n(0), cap(0) {}
+    // Array of m elements equal to x
+    explicit AlignedVector(size_t m, T const x = T()) : AlignedVector() {
+        resize(m, x);
+    }
+    // Array of m elements copied from q
+    AlignedVector(T const * q, size_t m) : AlignedVector() {
+        reserve(m);
+        if (m > 0) memcpy(p, q, m * sizeof(T));
+        n = m;
+    }
+    AlignedVector(std::initializer_list<T> list) : AlignedVector(list.begin(), list.size()) {}
+    AlignedVector(AlignedVector const & a) : AlignedVector(a.p, a.n) {}
+    AlignedVector(AlignedVector && a) noexcept : p(a.p), n(a.n), cap(a.cap) {
+        a.p = nullptr;  a.n = a.cap = 0;
+    }
+    AlignedVector & operator = (AlignedVector a) noexcept {
+        swap(a);
+        return *this;
+    }
+    ~AlignedVector() {
+        if (p) AlignedAllocator<T, Align>().deallocate(p, cap);
+    }
+    void swap(AlignedVector & a) noexcept {
+        std::swap(p, a.p);  std::swap(n, a.n);  std::swap(cap, a.cap);
+    }
+    // Number of elements
+    size_t size() const {
+        return n;
+    }
+    // Number of elements rounded up to a multiple of padding
+    size_t padded_size() const {
+        return aligned_size(n, padding);
+    }
+    // Number of allocated elements
+    size_t capacity() const {
+        return cap;
+    }
+    bool empty() const {
+        return n == 0;
+    }
+    T * data() {
+        return p;
+    }
+    T const * data() const {
+        return p;
+    }
+    T & operator [] (size_t i) {
+        return p[i];
+    }
+    T const & operator [] (size_t i) const {
+        return p[i];
+    }
+    T * begin() {
+        return p;
+    }
+    T * end() {
+        return p + n;
+    }
+    T const * begin() const {
+        return p;
+    }
+    T const * end() const {
+        return p + n;
+    }
+    T & front() {
+        return p[0];
+    }
+    T & back() {
+        return p[n - 1];
+    }
+    // Make room for m elements
+    void reserve(size_t m) {
+        if (m > cap) reallocate(m);
+    }
+    // Change the number of elements to m. New elements are set to x
+    void resize(size_t m, T const x = T()) {
+        reserve(m);
+        fill(p + n, p + m, x);                   // new elements, if m > n
+        fill(p + m, p + n, T());                 // removed elements become padding, if m < n
+        n = m;
+    }
+    // Add one element at the end
+    void push_back(T const x) {                  // x is a copy, so that it may be an element of this array
+        if (n == cap) reallocate(cap > 0 ? 2 * cap : padding);
+        p[n++] = x;
+    }
+    // Remove the last element
+    void pop_back() {
+        p[--n] = T();
+    }
+    // Remove all elements. The memory is kept
+    void clear() {
+        fill(p, p + n, T());
+        n = 0;
+    }
+    // Set the elements from size() to capacity() to zero
+    void clear_padding() {
+        fill(p + n, p + cap, T());
+    }
+};
+
+
+/*****************************************************************************
+*
+*          class AlignedArena
+*
+*****************************************************************************/
+// Allocates aligned buffers consecutively from blocks of memory. The buffers are released
+// all together with reset() or release(mark). The size of each buffer is rounded up to a
+// multiple of the alignment, so that a full vector can be read at the end of a buffer.
+// A new block is allocated when the current block is full. reset() replaces multiple
+// blocks by a single block of the same total size, so that the arena does not need new
+// blocks when it is used again in the same way
+
+class AlignedArena {
+public:
+    static constexpr size_t alignment = MAX_VECTOR_SIZE / 8 > 64 ? MAX_VECTOR_SIZE / 8 : 64; // alignment of buffers
+    static constexpr size_t min_block = 0x10000; // minimum size of new blocks
+    // Position in the arena, returned by mark()
+    struct Mark {
+        size_t block;                            // index of the current block
+        size_t pos;                              // bytes used in the current block
+    };
+protected:
+    struct Block {
+        char * p;                                // memory
+        size_t size;                             // bytes
+    };
+    std::vector<Block> blocks;                   // allocated blocks
+    size_t current;                              // index of the block being used
+    size_t pos;                                  // bytes used in the current block
+    void add_block(size_t bytes) {
+        Block b = {static_cast<char*>(aligned_allocate(bytes, alignment)), bytes};
+        blocks.push_back(b);
+    }
+    void free_blocks() {
+        for (Block const & b : blocks) aligned_deallocate(b.p, alignment);
+        blocks.clear();
+    }
+public:
+    // Constructor. bytes is the size of the first block. It is allocated at the first
+    // allocation if bytes is 0
+    explicit AlignedArena(size_t bytes = 0) : current(0), pos(0) {
+        if (bytes > 0) add_block(aligned_size(bytes, alignment));
+    }
+    AlignedArena(AlignedArena const &) = delete;
+    AlignedArena & operator = (AlignedArena const &) = delete;
+    ~AlignedArena() {
+        free_blocks();
+    }
+    // Allocate a buffer of the given number of bytes, aligned by alignment
+    void * allocate_bytes(size_t bytes) {
+        if (bytes > size_t(-1) / 2 - alignment) throw std::bad_array_new_length();
+        bytes = bytes > 0 ? aligned_size(bytes, alignment) : alignment;
+        for (; current < blocks.size(); current++, pos = 0) {
+            if (pos + bytes <= blocks[current].size) {   // buffer fits in this block
+                void * r = blocks[current].p + pos;
+                pos += bytes;
+                return r;
+            }
+        }
+        size_t size = blocks.empty() ? 0 : 2 * blocks.back().size;  // blocks grow exponentially
+        if (size < min_block) size = min_block;
+        if (size < bytes) size = bytes;
+        add_block(size);
+        current = blocks.size() - 1;  pos = bytes;
+        return blocks[current].p;
+    }
+    // Allocate an uninitialized buffer of n elements of type T
+    template <typename T>
+    T * allocate(size_t n) {
+        static_assert(alignof(T) <= alignment, "alignment too small for this type");
+        if (n > size_t(-1) / 2 / sizeof(T)) throw std::bad_array_new_length();
+        return static_cast<T*>(allocate_bytes(n * sizeof(T)));
+    }
+    // The current position. The buffers allocated after this point are released by release(mark)
+    Mark mark() const {
+        return Mark{current, pos};
+    }
+    // Release all buffers allocated after m was obtained with mark(). The memory is kept
+    void release(Mark m) {
+        current = m.block;  pos = m.pos;
+    }
+    // Release all buffers and combine the blocks into one
+    void reset() {
+        if (blocks.size() > 1) {
+            size_t total = capacity();
+            free_blocks();
+            add_block(total);
+        }
+        current = 0;  pos = 0;
+    }
+    // Total size of the allocated blocks, in bytes
+    size_t capacity() const {
+        size_t total = 0;
+        for (Block const & b : blocks) total += b.size;
+        return total;
+    }
+    // Number of bytes in use, including the unused ends of filled blocks
+    size_t used() const {
+        size_t total = pos;
+        for (size_t i = 0; i < current && i < blocks.size(); i++) total += blocks[i].size;
+        return total;
+    }
+};
+
+// Marks the position of an arena when it is created, and releases the buffers allocated
+// after this point when it goes out of scope
+class AlignedArenaScope {
+protected:
+    AlignedArena & arena;
+    AlignedArena::Mark m;
+public:
+    explicit AlignedArenaScope(AlignedArena & a) : arena(a), m(a.mark()) {}
+    AlignedArenaScope(AlignedArenaScope const &) = delete;
+    AlignedArenaScope & operator = (AlignedArenaScope const &) = delete;
+    ~AlignedArenaScope() {
+        arena.release(m);
+    }
+};
+
+// An arena for scratch buffers for each thread. It is created at the first call in each thread.
+// The function is inline, not static, so that all translation units share the same arena
+inline AlignedArena & scratch_arena() {
+    static thread_local AlignedArena arena;
+    return arena;
+}
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_MEMORY_H
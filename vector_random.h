@@ -0,0 +1,427 @@
+/****************************  vector_random.h   ******************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining random number generators that produce whole vectors of
+* random numbers. Each vector element comes from its own random number stream.
+* This header is optional. It is not included by vectorclass.h.
+*
+* Classes defined here:
+* Ranvec_xoshiro<V>   xoshiro256** generator. V = Vec2uq, Vec4uq or Vec8uq.
+*                     Each 64-bit element has its own 256-bit state.
+* Ranvec_philox<V>    Philox4x32-10 counter-based generator. V = Vec4ui, Vec8ui
+*                     or Vec16ui. The output depends only on the seed, the stream
+*                     number and the position in the stream, so it is possible to
+*                     jump to any position. Ranvec_xoshiro is faster.
+*
+* Member functions of both classes, where N is the size of V in bits:
+* random_uint32()   Random bits as N/32 unsigned 32-bit integers
+* random_uint64()   Random bits as N/64 unsigned 64-bit integers
+* random_float()    N/32 floats with uniform distribution in the interval [0,1)
+* random_double()   N/64 doubles with uniform distribution in the interval [0,1)
+* normal_float()    N/32 floats with standard normal distribution
+* normal_double()   N/64 doubles with standard normal distribution
+*
+* The uniform floats have a resolution of 2^-23 and the uniform doubles 2^-52.
+* The normal distribution is made with the Box-Muller transform, using log and
+* sincospi from vectormath_exp.h and vectormath_trig.h. Each call to the
+* Box-Muller transform gives two vectors. The second vector is saved for the
+* next call.
+*
+* Multithreading:
+* Give each thread a different stream number, using the same seed. The streams
+* do not overlap, and the results are the same regardless of how the threads are
+* scheduled. A Philox stream can be started at any position with seek(n).
+* The xoshiro streams are separated by jumps of 2^192 steps. The constructor
+* calculates stream number s by s jumps, so the time increases with s.
+*
+* Example:
+* // Monte Carlo estimate of E[max(Z, 0)] for standard normal Z, in each thread t
+* Ranvec_philox<Vec16ui> gen(seed, t);
+* Vec16f sum = 0;
+* for (int i = 0; i < n; i += 16) sum += max(gen.normal_float(), 0.f);
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_RANDOM_H
+#define VECTOR_RANDOM_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include "vectormath_exp.h"            // log
+#include "vectormath_trig.h"           // sincospi
+
+#include <stdint.h>                    // uint64_t
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*          Conversion of random bits to floating point distributions
+*
+*****************************************************************************/
+
+// Vector types with a total size of N bits
+template <int N> struct Ranvec_vectors;
+
+template <> struct Ranvec_vectors<128> {
+    typedef Vec4ui VUI; typedef Vec2uq VUQ; typedef Vec4f VF; typedef Vec2d VD;
+};
+#if MAX_VECTOR_SIZE >= 256
+template <> struct Ranvec_vectors<256> {
+    typedef Vec8ui VUI; typedef Vec4uq VUQ; typedef Vec8f VF; typedef Vec4d VD;
+};
+#endif
+#if MAX_VECTOR_SIZE >= 512
+template <> struct Ranvec_vectors<512> {
+    typedef Vec16ui VUI; typedef Vec8uq VUQ; typedef Vec16f VF; typedef Vec8d VD;
+};
+#endif
+
+// Uniform distribution in the interval [1,2) made from random bits.
+// The upper bits are put into the mantissa of a number with exponent 0
+template <typename VF, typename VUI>
+static inline VF ranvec_uniform_float(VUI const bits) {
+    return reinterpret_f((bits >> 9) | 0x3F800000u);
+}
+
+template <typename VD, typename VUQ>
+static inline VD ranvec_uniform_double(VUQ const bits) {
+    return reinterpret_d((bits >> 12) | 0x3FF0000000000000u);
+}
+
+// Box-Muller transform. u1 and u2 are independent uniform in [1,2).
+// Returns one vector of standard normal numbers and saves another in *second
+template <typename V>
+static inline V ranvec_box_muller(V const u1, V const u2, V * second) {
+    V r = sqrt(V(-2.) * log(V(2.) - u1));        // 2 - u1 is in (0,1], avoiding log(0)
+    V c;
+    V s = sincospi(&c, (u2 - V(1.)) * V(2.));    // angle 2*pi*(u2-1) in [0, 2*pi)
+    *second = r * s;
+    return r * c;
+}
+
+
+/*****************************************************************************
+*
+*          class Ranvec_xoshiro
+*
+*****************************************************************************/
+// xoshiro256** generator by D. Blackman and S. Vigna, 2018. Each element of the
+// vector V has a separate state. The state of element i is the state of element 0
+// advanced by i*2^128 steps, so the element streams do not overlap.
+
+template <typename V>
+class Ranvec_xoshiro {
+public:
+    typedef typename Ranvec_vectors<sizeof(V) * 8>::VUI VUI;
+    typedef typename Ranvec_vectors<sizeof(V) * 8>::VUQ VUQ;
+    typedef typename Ranvec_vectors<sizeof(V) * 8>::VF  VF;
+    typedef typename Ranvec_vectors<sizeof(V) * 8>::VD  VD;
+    // Constructor. seed = any number, stream = stream number for multithreading
+    explicit Ranvec_xoshiro(uint64_t seed = 0, uint64_t stream = 0) {
+        init(seed, stream);
+    }
+    // Re-initialize
+    void init(uint64_t seed, uint64_t stream = 0) {
+        // make the first 256-bit state from seed with the splitmix64 generator
+        uint64_t s[4];
+        for (int j = 0; j < 4; j++) {
+            seed += 0x9E3779B97F4A7C15u;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+            s[j] = z ^ (z >> 31);
+        }
+        if ((s[0] | s[1] | s[2] | s[3]) == 0) s[0] = 1; // state must not be all zero
+        // state of element i is made by i jumps of 2^128 steps
+        uint64_t t[4][V::size()];
+        for (int i = 0; i < V::size(); i++) {
+            for (int j = 0; j < 4; j++) t[j][i] = s[j];
+            jump_scalar(s, jump128);
+        }
+        s0.load(t[0]);  s1.load(t[1]);  s2.load(t[2]);  s3.load(t[3]);
+        for (uint64_t k = 0; k < stream; k++) long_jump();
+        have_normal_f = have_normal_d = false;
+    }
+    // Advance all elements by 2^192 steps. Used for making non-overlapping streams
+    void long_jump() {
+        V t0(0), t1(0), t2(0), t3(0);
+        for (int j = 0; j < 4; j++) {
+            for (int b = 0; b < 64; b++) {
+                if (jump192[j] >> b & 1) {
+                    t0 ^= s0;  t1 ^= s1;  t2 ^= s2;  t3 ^= s3;
+                }
+                next();
+            }
+        }
+        s0 = t0;  s1 = t1;  s2 = t2;  s3 = t3;
+    }
+    // Random bits
+    VUQ random_uint64() {
+        return VUQ(next());
+    }
+    VUI random_uint32() {
+        return VUI(next());
+    }
+    // Uniform distribution in [0,1)
+    VF random_float() {
+        return ranvec_uniform_float<VF>(random_uint32()) - 1.f;
+    }
+    VD random_double() {
+        return ranvec_uniform_double<VD>(random_uint64()) - 1.;
+    }
+    // Standard normal distribution
+    VF normal_float() {
+        if (have_normal_f) {
+            have_normal_f = false;
+            return normal_f;
+        }
+        have_normal_f = true;
+        VF u1 = ranvec_uniform_float<VF>(random_uint32());
+        VF u2 = ranvec_uniform_float<VF>(random_uint32());
+        return ranvec_box_muller(u1, u2, &normal_f);
+    }
+    VD normal_double() {
+        if (have_normal_d) {
+            have_normal_d = false;
+            return normal_d;
+        }
+        have_normal_d = true;
+        VD u1 = ranvec_uniform_double<VD>(random_uint64());
+        VD u2 = ranvec_uniform_double<VD>(random_uint64());
+        return ranvec_box_muller(u1, u2, &normal_d);
+    }
+protected:
+    V s0, s1, s2, s3;                            // state
+    VF normal_f;                                 // saved normal numbers
+    VD normal_d;
+    bool have_normal_f, have_normal_d;           // normal_f and normal_d are valid
+    // jump polynomials for 2^128 and 2^192 steps
+    static constexpr uint64_t jump128[4] = {
+        0x180EC6D33CFD0ABAu, 0xD5A61266F0C9392Cu, 0xA9582618E03FC9AAu, 0x39ABDC4529B1661Cu};
+    static constexpr uint64_t jump192[4] = {
+        0x76E15D3EFEFDCBBFu, 0xC5004E441C522FB3u, 0x77710069854EE241u, 0x39109BB02ACBE635u};
+    // rotate left. Multiplications by 5 and 9 are done with shifts
+    static V rotl(V const x, int b) {
+        return (x << b) | (x >> (64 - b));
+    }
+    // Generate one vector of random bits and advance the state
+    V next() {
+        V x = s1 + (s1 << 2);                    // s1 * 5
+        x = rotl(x, 7);
+        V result = x + (x << 3);                 // * 9
+        V t = s1 << 17;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = rotl(s3, 45);
+        return result;
+    }
+    // Apply a jump polynomial to a single state
+    static void jump_scalar(uint64_t s[4], uint64_t const poly[4]) {
+        uint64_t t[4] = {0, 0, 0, 0};
+        for (int j = 0; j < 4; j++) {
+            for (int b = 0; b < 64; b++) {
+                if (poly[j] >> b & 1) {
+                    for (int k = 0; k < 4; k++) t[k] ^= s[k];
+                }
+                uint64_t u = s[1] << 17;
+                s[2] ^= s[0];
+                s[3] ^= s[1];
+                s[1] ^= s[2];
+                s[0] ^= s[3];
+                s[2] ^= u;
+                s[3] = (s[3] << 45) | (s[3] >> 19);
+            }
+        }
+        for (int k = 0; k < 4; k++) s[k] = t[k];
+    }
+};
+
+
+/*****************************************************************************
+*
+*          class Ranvec_philox
+*
+*****************************************************************************/
+// Philox4x32-10 generator by J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw,
+// 2011. Each element i of the vector V calculates the Philox function of the
+// 128-bit counter (block * V::size() + i, stream) with the 64-bit key seed.
+// This gives four random 32-bit words, which are returned in four vectors.
+// Element i of output vector n comes from block n/4, word n%4.
+
+// 32x32 -> 64 bit unsigned multiplication of each element of a by m.
+// Returns the low 32 bits and the high 32 bits in *hi
+static inline Vec4ui philox_mulhilo(Vec4ui const a, uint32_t m, Vec4ui * hi) {
+    __m128i mm = _mm_set1_epi32(int(m));
+    __m128i p02 = _mm_mul_epu32(a, mm);                    // products of a[0] and a[2]
+    __m128i p13 = _mm_mul_epu32(_mm_srli_epi64(a, 32), mm); // products of a[1] and a[3]
+#if INSTRSET >= 5   // SSE4.1 supported
+    *hi = _mm_blend_epi16(_mm_srli_epi64(p02, 32), p13, 0xCC);
+    return _mm_blend_epi16(p02, _mm_slli_epi64(p13, 32), 0xCC);
+#else
+    __m128i mask = _mm_set_epi32(-1, 0, -1, 0);           // mask of dword 1 and 3
+    *hi = _mm_or_si128(_mm_srli_epi64(p02, 32), _mm_and_si128(p13, mask));
+    return _mm_or_si128(_mm_andnot_si128(mask, p02), _mm_slli_epi64(p13, 32));
+#endif
+}
+
+#if MAX_VECTOR_SIZE >= 256
+static inline Vec8ui philox_mulhilo(Vec8ui const a, uint32_t m, Vec8ui * hi) {
+#if INSTRSET >= 8   // AVX2
+    __m256i mm = _mm256_set1_epi32(int(m));
+    __m256i p02 = _mm256_mul_epu32(a, mm);
+    __m256i p13 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), mm);
+    *hi = _mm256_blend_epi32(_mm256_srli_epi64(p02, 32), p13, 0xAA);
+    return _mm256_blend_epi32(p02, _mm256_slli_epi64(p13, 32), 0xAA);
+#else
+    Vec4ui hi_low, hi_high;
+    Vec4ui lo_low  = philox_mulhilo(a.get_low(),  m, &hi_low);
+    Vec4ui lo_high = philox_mulhilo(a.get_high(), m, &hi_high);
+    *hi = Vec8ui(hi_low, hi_high);
+    return Vec8ui(lo_low, lo_high);
+#endif
+}
+#endif // MAX_VECTOR_SIZE >= 256
+
+#if MAX_VECTOR_SIZE >= 512
+static inline Vec16ui philox_mulhilo(Vec16ui const a, uint32_t m, Vec16ui * hi) {
+#if INSTRSET >= 9   // AVX512F
+    __m512i mm = _mm512_set1_epi32(int(m));
+    __m512i p02 = _mm512_mul_epu32(a, mm);
+    __m512i p13 = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), mm);
+    *hi = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(p02, 32), p13);
+    return _mm512_mask_blend_epi32(0xAAAA, p02, _mm512_slli_epi64(p13, 32));
+#else
+    Vec8ui hi_low, hi_high;
+    Vec8ui lo_low  = philox_mulhilo(a.get_low(),  m, &hi_low);
+    Vec8ui lo_high = philox_mulhilo(a.get_high(), m, &hi_high);
+    *hi = Vec16ui(hi_low, hi_high);
+    return Vec16ui(lo_low, lo_high);
+#endif
+}
+#endif // MAX_VECTOR_SIZE >= 512
+
+template <typename V>
+class Ranvec_philox {
+public:
+    typedef typename Ranvec_vectors<sizeof(V) * 8>::VUI VUI;
+    typedef typename Ranvec_vectors<sizeof(V) * 8>::VUQ VUQ;
+    typedef typename Ranvec_vectors<sizeof(V) * 8>::VF  VF;
+    typedef typename Ranvec_vectors<sizeof(V) * 8>::VD  VD;
+    // Constructor. seed = any number, stream = stream number for multithreading
+    explicit Ranvec_philox(uint64_t seed = 0, uint64_t stream = 0) {
+        init(seed, stream);
+    }
+    // Re-initialize
+    void init(uint64_t seed, uint64_t stream = 0) {
+        key = seed;
+        stream_number = stream;
+        seek(0);
+    }
+    // Go to position n in the stream. The next call to random_uint32 gives
+    // output vector number n. random_uint64, random_float and random_double use
+    // one output vector each. normal_float and normal_double use two output
+    // vectors for every second call.
+    void seek(uint64_t n) {
+        block = n / 4;
+        generate();
+        index = int(n % 4);
+        have_normal_f = have_normal_d = false;
+    }
+    // Random bits
+    VUI random_uint32() {
+        if (index == 4) {
+            block++;
+            generate();
+            index = 0;
+        }
+        return r[index++];
+    }
+    VUQ random_uint64() {
+        return VUQ(random_uint32());
+    }
+    // Uniform distribution in [0,1)
+    VF random_float() {
+        return ranvec_uniform_float<VF>(random_uint32()) - 1.f;
+    }
+    VD random_double() {
+        return ranvec_uniform_double<VD>(random_uint64()) - 1.;
+    }
+    // Standard normal distribution
+    VF normal_float() {
+        if (have_normal_f) {
+            have_normal_f = false;
+            return normal_f;
+        }
+        have_normal_f = true;
+        VF u1 = ranvec_uniform_float<VF>(random_uint32());
+        VF u2 = ranvec_uniform_float<VF>(random_uint32());
+        return ranvec_box_muller(u1, u2, &normal_f);
+    }
+    VD normal_double() {
+        if (have_normal_d) {
+            have_normal_d = false;
+            return normal_d;
+        }
+        have_normal_d = true;
+        VD u1 = ranvec_uniform_double<VD>(random_uint64());
+        VD u2 = ranvec_uniform_double<VD>(random_uint64());
+        return ranvec_box_muller(u1, u2, &normal_d);
+    }
+protected:
+    V r[4];                                      // output of current block
+    int index;                                   // next vector in r
+    uint64_t key;                                // seed
+    uint64_t stream_number;                      // high 64 bits of counter
+    uint64_t block;                              // block number
+    VF normal_f;                                 // saved normal numbers
+    VD normal_d;
+    bool have_normal_f, have_normal_d;           // normal_f and normal_d are valid
+    // Calculate the four output vectors of the current block
+    void generate() {
+        static const uint32_t lanes[16] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15};
+        V lane = V().load(lanes);
+        uint64_t base = block * V::size();       // counter of element 0
+        V c0 = V(uint32_t(base)) + lane;
+        V c1 = if_add(c0 < lane, V(uint32_t(base >> 32)), 1u); // carry
+        V c2 = V(uint32_t(stream_number));
+        V c3 = V(uint32_t(stream_number >> 32));
+        uint32_t k0 = uint32_t(key), k1 = uint32_t(key >> 32);
+        for (int i = 0; i < 10; i++) {           // 10 rounds
+            V hi0, hi1;
+            V lo0 = philox_mulhilo(c0, 0xD2511F53u, &hi0);
+            V lo1 = philox_mulhilo(c2, 0xCD9E8D57u, &hi1);
+            c0 = hi1 ^ c1 ^ k0;
+            c1 = lo1;
+            c2 = hi0 ^ c3 ^ k1;
+            c3 = lo0;
+            k0 += 0x9E3779B9u;                   // Weyl sequence for key
+            k1 += 0xBB67AE85u;
+        }
+        r[0] = c0;  r[1] = c1;  r[2] = c2;  r[3] = c3;
+    }
+};
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_RANDOM_H
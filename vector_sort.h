@@ -0,0 +1,330 @@
+/****************************  vector_sort.h   ********************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining functions for sorting the elements of vectors and arrays.
+*
+* Functions defined here:
+* sort(a)                     Sort the elements of vector a in ascending order
+* sort_pairs(keys, values)    Sort the elements of vector keys in ascending order and
+*                             apply the same permutation to the elements of vector values
+* vsort(p, n)                 Sort array p of n elements in ascending order
+* vsort<V>(p, n)              Same, using vector class V
+*
+* sort and sort_pairs use a bitonic sorting network made of permute, min, max,
+* and blend operations. They work for any vector class with 2, 4, 8, 16, 32, or
+* 64 elements.
+*
+* vsort is a quicksort where the partitioning of the array is vectorized with
+* compress_store, and arrays of up to two vectors are sorted with the sorting
+* network. vsort is not stable. The array must not contain NAN.
+*
+* Example:
+* Vec8f a(5, 3, 8, 1, 2, 7, 4, 6);
+* a = sort(a);                           // a = (1, 2, 3, 4, 5, 6, 7, 8)
+* float data[1000];
+* vsort(data, 1000);                     // sort array
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_SORT_H
+#define VECTOR_SORT_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#include <stddef.h>                    // define size_t
+#include <string.h>                    // memcpy
+#include <utility>                     // std::integer_sequence
+#include <algorithm>                   // std::sort
+#include <limits>                      // std::numeric_limits
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*          Sorting network
+*
+*****************************************************************************/
+
+// One step of a bitonic sorting network: compare element i with element i^j.
+// Element i gets the smaller value if bit j and bit k of i are equal
+template <int k, int j, typename V, int ... I>
+static inline V sort_step(V const a, std::integer_sequence<int, I...>) {
+    constexpr int n = sizeof...(I);
+    V b = permute_n<(I ^ j)...>(a);              // partner elements
+    return blend_n<((((I & j) == 0) == ((I & k) == 0)) ? I : I + n)...>(min(a, b), max(a, b));
+}
+
+// Same, with values following the keys
+template <int k, int j, typename VK, typename VV, int ... I>
+static inline void sort_step_pairs(VK & keys, VV & values, std::integer_sequence<int, I...>) {
+    constexpr int n = sizeof...(I);
+    VK kb = permute_n<(I ^ j)...>(keys);         // partner keys
+    VV vb = permute_n<(I ^ j)...>(values);       // partner values
+    VK kn = blend_n<((((I & j) == 0) == ((I & k) == 0)) ? I : I + n)...>(min(keys, kb), max(keys, kb));
+    // take the partner value where the key has changed
+    values = select(typename vector_traits<VV>::boolean_vector(kn != keys), vb, values);
+    keys = kn;
+}
+
+// Bitonic sorting network from stage k, step j
+template <int k, int j, typename V>
+static inline V sort_network(V const a) {
+    V b = sort_step<k, j>(a, std::make_integer_sequence<int, V::size()>());
+    if constexpr (j > 1) return sort_network<k, j / 2>(b);
+    else if constexpr (k < V::size()) return sort_network<k * 2, k>(b);
+    else return b;
+}
+
+// Same, with values following the keys
+template <int k, int j, typename VK, typename VV>
+static inline void sort_network_pairs(VK & keys, VV & values) {
+    sort_step_pairs<k, j>(keys, values, std::make_integer_sequence<int, VK::size()>());
+    if constexpr (j > 1) sort_network_pairs<k, j / 2>(keys, values);
+    else if constexpr (k < VK::size()) sort_network_pairs<k * 2, k>(keys, values);
+}
+
+// Reverse the order of the elements of a
+template <typename V, int ... I>
+static inline V sort_reverse(V const a, std::integer_sequence<int, I...>) {
+    return permute_n<(int(sizeof...(I)) - 1 - I)...>(a);
+}
+
+// Sort the elements of vector a in ascending order
+template <typename V>
+static inline V sort(V const a) {
+    static_assert(V::elementtype() >= 4, "sort requires an integer or floating point vector");
+    return sort_network<2, 1>(a);
+}
+
+// Sort the elements of keys in ascending order, and permute values in the same way.
+// keys and values must have the same number and size of elements
+template <typename VK, typename VV>
+static inline void sort_pairs(VK & keys, VV & values) {
+    static_assert(VK::size() == VV::size() && sizeof(VK) == sizeof(VV), "keys and values must have the same number and size of elements");
+    sort_network_pairs<2, 1>(keys, values);
+}
+
+// Sort the 2*n elements of a and b in ascending order. a gets the lower half
+template <typename V>
+static inline void sort_two(V & a, V & b) {
+    constexpr int n = V::size();
+    V x = sort(a);
+    V y = sort_reverse(sort(b), std::make_integer_sequence<int, n>());
+    // x followed by y is now a bitonic sequence. Every element of min(x, y) is
+    // less than or equal to every element of max(x, y), and both are bitonic
+    a = sort_network<n, n / 2>(min(x, y));
+    b = sort_network<n, n / 2>(max(x, y));
+}
+
+
+/*****************************************************************************
+*
+*          Array sort
+*
+*****************************************************************************/
+
+// Sort array of up to 2*V::size() elements
+template <typename V, typename T>
+static inline void vsort_small(T * p, size_t n) {
+    constexpr size_t N = V::size();
+    if (n < 2) return;
+    T buf[2 * N];                                // copy of p padded with the maximum value
+    const T pad = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+    for (size_t i = n; i < 2 * N; i++) buf[i] = pad;
+    memcpy(buf, p, n * sizeof(T));
+    V a = V().load(buf);
+    if (n <= N) {
+        sort(a).store(buf);
+    }
+    else {
+        V b = V().load(buf + N);
+        sort_two(a, b);
+        a.store(buf);
+        b.store(buf + N);
+    }
+    memcpy(p, buf, n * sizeof(T));
+}
+
+// Check if vsort_partition_vector is supported for vector class V. This is used
+// when compress_store cannot use the masked store instructions of AVX512
+template <typename V>
+constexpr bool vsort_permute_partition() {
+    constexpr int esize = int(sizeof(V)) / V::size();  // element size
+    return INSTRSET < 10 && ((sizeof(V) == 16 && INSTRSET >= 4 && esize >= 2)
+        || (sizeof(V) == 32 && INSTRSET >= 8 && esize >= 4));
+}
+
+// Permute x so that the elements where m is true come first, in the original order,
+// followed by the other elements
+template <typename V>
+static inline V vsort_partition_vector(V const x, uint32_t const m) {
+    constexpr int n = V::size();
+    uint32_t c = vml_popcnt(m);                 // number of true elements
+    uint32_t t = compress_index_table.c[m];     // indexes of true elements
+    if (c < 8) {                                 // append indexes of false elements
+        t = (t & ((1u << 4 * c) - 1)) | compress_index_table.c[~m & ((1u << n) - 1)] << 4 * c;
+    }
+#if INSTRSET >= 8
+    if constexpr (sizeof(V) == 32) {
+        return from_int_vector<V>(typename vector_traits<V>::int_vector(
+            compress_permute_permd<int(sizeof(V)) / n>(to_int_vector(x), t)));
+    }
+    else
+#endif
+    {
+#if INSTRSET >= 4
+        return from_int_vector<V>(typename vector_traits<V>::int_vector(
+            compress_permute_pshufb<int(sizeof(V)) / n>(to_int_vector(x), t)));
+#else
+        return x;
+#endif
+    }
+}
+
+// Partition array p of n > 2*V::size() elements in place. The elements less than pivot,
+// or less than or equal to pivot if le is true, are placed first. Returns their number
+template <bool le, typename V, typename T>
+static inline size_t vsort_partition(T * p, size_t n, T const pivot) {
+    constexpr size_t N = V::size();
+    // The first and last vector are kept in registers so that there is always
+    // space for writing one vector on either side before reading the next one
+    V first = V().load(p);
+    V last = V().load(p + n - N);
+    size_t rl = N, rr = n - N;                   // next positions to read from left and right
+    size_t wl = 0, wr = n;                       // next positions to write to left and right
+    auto part = [&](V const x) {                 // write x to both sides
+        auto m = le ? x <= pivot : x < pivot;
+        if constexpr (vsort_permute_partition<V>()) {
+            // write the whole vector to both sides. This is faster than storing only
+            // the selected elements without AVX512. The superfluous elements are
+            // written to free space that will be overwritten later
+            uint32_t bits = uint32_t(compress_mask_bits(m));
+            int c = vml_popcnt(bits);
+            V y = vsort_partition_vector(x, bits);
+            y.store(p + wl);
+            y.store(p + wr - N);
+            wl += c;
+            wr -= N - c;
+        }
+        else {
+            int c = compress_store(p + wl, x, m);
+            wl += c;
+            wr -= N - c;
+            compress_store(p + wr, x, !m);
+        }
+    };
+    while (rr - rl >= N) {
+        V x;
+        if (rl - wl <= wr - rr) {                // read from the side with the least space
+            x.load(p + rl);
+            rl += N;
+        }
+        else {
+            rr -= N;
+            x.load(p + rr);
+        }
+        part(x);
+    }
+    // remaining elements that do not fill a vector
+    size_t r = rr - rl;                          // number of remaining elements
+    T rest[N];
+    memcpy(rest, p + rl, r * sizeof(T));
+    for (size_t i = 0; i < r; i++) {
+        if (le ? rest[i] <= pivot : rest[i] < pivot) p[wl++] = rest[i];
+        else p[--wr] = rest[i];
+    }
+    part(first);
+    part(last);
+    return wl;
+}
+
+// Median of three
+template <typename T>
+static inline T vsort_median(T const a, T const b, T const c) {
+    return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+// Quicksort with vectorized partitioning
+template <typename V, typename T>
+static void vsort_quick(T * p, size_t n, int depth) {
+    constexpr size_t N = V::size();
+    while (n > 2 * N) {
+        if (--depth < 0) {                       // too many bad pivots. Avoid quadratic time
+            std::sort(p, p + n);
+            return;
+        }
+        T pivot = vsort_median(p[0], p[n / 2], p[n - 1]);
+        size_t k = vsort_partition<false, V>(p, n, pivot);
+        if (k == 0) {
+            // pivot is the smallest element. Separate the elements equal to pivot, which are sorted
+            k = vsort_partition<true, V>(p, n, pivot);
+            if (k == 0) return;                  // pivot is not ordered. array contains NAN
+            p += k;  n -= k;
+            continue;
+        }
+        // recursion on the smaller part, loop on the bigger part
+        if (k < n - k) {
+            vsort_quick<V>(p, k, depth);
+            p += k;  n -= k;
+        }
+        else {
+            vsort_quick<V>(p + k, n - k, depth);
+            n = k;
+        }
+    }
+    vsort_small<V>(p, n);
+}
+
+// Sort array p of n elements in ascending order, using vector class V.
+// The element type of V must match p
+template <typename V>
+static inline void vsort(typename vector_traits<V>::element_type * p, size_t n) {
+    int depth = 0;                               // limit for recursion depth = 2*log2(n)
+    for (size_t m = n; m > 1; m >>= 1) depth += 2;
+    vsort_quick<V>(p, n, depth);
+}
+
+// Sort arrays with the biggest vector size supported by the instruction set
+#if MAX_VECTOR_SIZE >= 512 && INSTRSET >= 9
+static inline void vsort(float * p, size_t n)    { vsort<Vec16f>(p, n); }
+static inline void vsort(double * p, size_t n)   { vsort<Vec8d>(p, n); }
+static inline void vsort(int32_t * p, size_t n)  { vsort<Vec16i>(p, n); }
+static inline void vsort(uint32_t * p, size_t n) { vsort<Vec16ui>(p, n); }
+static inline void vsort(int64_t * p, size_t n)  { vsort<Vec8q>(p, n); }
+static inline void vsort(uint64_t * p, size_t n) { vsort<Vec8uq>(p, n); }
+#elif MAX_VECTOR_SIZE >= 256 && INSTRSET >= 8
+static inline void vsort(float * p, size_t n)    { vsort<Vec8f>(p, n); }
+static inline void vsort(double * p, size_t n)   { vsort<Vec4d>(p, n); }
+static inline void vsort(int32_t * p, size_t n)  { vsort<Vec8i>(p, n); }
+static inline void vsort(uint32_t * p, size_t n) { vsort<Vec8ui>(p, n); }
+static inline void vsort(int64_t * p, size_t n)  { vsort<Vec4q>(p, n); }
+static inline void vsort(uint64_t * p, size_t n) { vsort<Vec4uq>(p, n); }
+#else
+static inline void vsort(float * p, size_t n)    { vsort<Vec4f>(p, n); }
+static inline void vsort(double * p, size_t n)   { vsort<Vec2d>(p, n); }
+static inline void vsort(int32_t * p, size_t n)  { vsort<Vec4i>(p, n); }
+static inline void vsort(uint32_t * p, size_t n) { vsort<Vec4ui>(p, n); }
+static inline void vsort(int64_t * p, size_t n)  { vsort<Vec2q>(p, n); }
+static inline void vsort(uint64_t * p, size_t n) { vsort<Vec2uq>(p, n); }
+#endif
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_SORT_H
@@ -0,0 +1,423 @@
+/****************************  vector_string.h   ******************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining functions for scanning strings and byte arrays:
+*
+* find_byte(s, n, c)           index of the first byte c in s[0..n-1], or -1
+* find_any_of<c...>(s, n)      index of the first byte in s[0..n-1] that is one
+*                              of the characters c..., or -1
+* count_byte(s, n, c)          number of bytes c in s[0..n-1]
+* string_length(s)             length of zero-terminated string, same as strlen
+* utf8_validate(s, n)          true if s[0..n-1] is valid UTF-8
+* structural_index<q, c...>(s, n, index)
+*                              write the positions of the characters c... that
+*                              are not inside a string quoted by q, and the
+*                              positions of the quote characters q, to index.
+*                              Returns the number of positions
+* byte_set_match<c...>(x)      boolean vector of the bytes in the Vec64uc x that
+*                              are one of the characters c...
+*
+* The functions process blocks of 64 bytes as Vec64uc vectors, which are emulated
+* with smaller vectors when AVX512BW is not available. The matches in each block
+* are converted to a 64-bit mask with to_bits.
+*
+* The first and the last block are read with aligned loads, also where these
+* blocks extend below the beginning or beyond the end of the array. The bytes
+* outside the array are masked off. An aligned 64-byte block never crosses a
+* memory page boundary, so these reads cannot cause an access violation, and
+* string_length can read a string of unknown length. Memory checkers such as
+* Valgrind and AddressSanitizer may report these reads as errors.
+*
+* byte_set_match compares with each character when there are up to 3 characters.
+* Bigger sets are classified with two lookups in 16-entry tables, one for the low
+* and one for the high nibble of each byte. This works for sets with no more than
+* 8 different high nibbles. Other sets use the comparison with each character.
+*
+* utf8_validate uses the lookup algorithm of Keiser and Lemire, 2021: "Validating
+* UTF-8 In Less Than One Instruction Per Byte". Blocks of pure ASCII are skipped
+* quickly. Surrogates, overlong encodings and code points above 0x10FFFF are
+* rejected.
+*
+* structural_index marks the quoted parts of the string by prefix XOR of the
+* positions of quote characters. This handles doubled quotes ("") as in CSV files,
+* but not quotes escaped with backslash. The positions are uint32_t so n must be
+* less than 2^32. The index array must have space for n elements.
+*
+* Example:
+* // find the field separators and line ends in a CSV file
+* uint32_t * index = new uint32_t[n];
+* size_t count = structural_index<'"', ',', '\n'>(text, n, index);
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTOR_STRING_H
+#define VECTOR_STRING_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#if MAX_VECTOR_SIZE < 512
+#error vector_string.h requires MAX_VECTOR_SIZE >= 512
+#endif
+
+#include <stddef.h>                    // define size_t, ptrdiff_t
+#include <string.h>                    // memcpy
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*          Byte classification
+*
+*****************************************************************************/
+
+// Table lookup in each 128-bit lane. index must be 0 - 15. The 16 bytes of table
+// are used in all lanes. This is pshufb with the same table in each lane
+static inline Vec16uc lookup16_lanes(Vec16uc const index, Vec16uc const table) {
+    return Vec16uc(lookup16(Vec16c(index), Vec16c(table)));
+}
+
+static inline Vec32uc lookup16_lanes(Vec32uc const index, Vec16uc const table) {
+#if INSTRSET >= 8  // AVX2
+    return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(table), index);
+#else
+    return Vec32uc(lookup16_lanes(index.get_low(), table), lookup16_lanes(index.get_high(), table));
+#endif
+}
+
+static inline Vec64uc lookup16_lanes(Vec64uc const index, Vec16uc const table) {
+#if INSTRSET >= 10  // AVX512BW
+    return _mm512_shuffle_epi8(_mm512_broadcast_i32x4(table), index);
+#else
+    return Vec64uc(lookup16_lanes(index.get_low(), table), lookup16_lanes(index.get_high(), table));
+#endif
+}
+
+// Tables for classifying bytes by their low and high nibble. Each different high
+// nibble in the set gets one bit. lo[l] has this bit if the byte with high
+// nibble h and low nibble l is in the set. (lo[x & 15] & hi[x >> 4]) != 0
+// for the bytes x in the set. The tables are valid only if bits <= 8
+template <char ... chars>
+struct Byte_set_tables {
+    uint8_t lo[16];
+    uint8_t hi[16];
+    int bits;                                    // number of different high nibbles
+    constexpr Byte_set_tables() : lo(), hi(), bits(0) {
+        constexpr char c[] = {chars...};
+        uint32_t seen = 0;                       // one bit for each high nibble found
+        for (unsigned int i = 0; i < sizeof(c); i++) {
+            uint8_t h = uint8_t(c[i]) >> 4;
+            if ((seen >> h & 1) == 0) {
+                seen |= 1u << h;
+                if (bits < 8) hi[h] = uint8_t(1 << bits);
+                bits++;
+            }
+            lo[uint8_t(c[i]) & 15] |= hi[h];
+        }
+    }
+};
+
+// Make a Vec16uc from a constant table
+static inline Vec16uc vector_from_table(uint8_t const table[16]) {
+    return Vec16uc().load(table);
+}
+
+// Boolean vector of the bytes in x that are one of the characters chars...
+template <char ... chars>
+static inline Vec64cb byte_set_match(Vec64uc const x) {
+    static_assert(sizeof...(chars) > 0, "empty set");
+    if constexpr (sizeof...(chars) <= 3 || Byte_set_tables<chars...>().bits > 8) {
+        // few characters or too many different high nibbles for the lookup tables
+        return ((x == uint8_t(chars)) | ...);
+    }
+    else {
+        static constexpr Byte_set_tables<chars...> t;
+        Vec64uc lo = lookup16_lanes(x & uint8_t(0x0F), vector_from_table(t.lo));
+        Vec64uc hi = lookup16_lanes(x >> 4, vector_from_table(t.hi));
+        return (lo & hi) != uint8_t(0);
+    }
+}
+
+
+/*****************************************************************************
+*
+*          Block iteration
+*
+*****************************************************************************/
+
+// Aligned 64-byte block containing p
+static inline uint8_t const * string_block(void const * p) {
+    return (uint8_t const *)((size_t)p & ~size_t(63));
+}
+
+// Mask of the bytes in the block b that are not below p
+static inline uint64_t string_mask_begin(uint8_t const * b, void const * p) {
+    return ~uint64_t(0) << ((uint8_t const *)p - b);
+}
+
+// Mask of the bytes in the block b that are below end
+static inline uint64_t string_mask_end(uint8_t const * b, void const * end) {
+    ptrdiff_t valid = (uint8_t const *)end - b;
+    return valid >= 64 ? ~uint64_t(0) : (uint64_t(1) << valid) - 1;
+}
+
+// Find the first byte in s[0..n-1] for which match(x) is true, where x is a Vec64uc
+// block. Returns the index or -1 if not found
+template <typename F>
+static inline ptrdiff_t string_find(void const * s, size_t n, F match) {
+    if (n == 0) return -1;
+    uint8_t const * p = (uint8_t const *)s;
+    uint8_t const * end = p + n;
+    uint8_t const * b = string_block(p);
+    uint64_t m = to_bits(match(Vec64uc().load_a(b))) & string_mask_begin(b, p);
+    while (b + 64 < end) {
+        if (m) return b - p + bit_scan_forward(m);
+        b += 64;
+        m = to_bits(match(Vec64uc().load_a(b)));
+    }
+    m &= string_mask_end(b, end);
+    if (m) return b - p + bit_scan_forward(m);
+    return -1;
+}
+
+
+/*****************************************************************************
+*
+*          Searching and counting
+*
+*****************************************************************************/
+
+// Index of the first byte c in s[0..n-1], or -1 if not found
+static inline ptrdiff_t find_byte(void const * s, size_t n, uint8_t c) {
+    Vec64uc cc(c);
+    return string_find(s, n, [cc](Vec64uc const x) {return x == cc;});
+}
+
+// Index of the first byte in s[0..n-1] that is one of chars..., or -1 if not found
+template <char ... chars>
+static inline ptrdiff_t find_any_of(void const * s, size_t n) {
+    return string_find(s, n, [](Vec64uc const x) {return byte_set_match<chars...>(x);});
+}
+
+// Length of a zero-terminated string. Same as strlen
+static inline size_t string_length(char const * s) {
+    uint8_t const * b = string_block(s);
+    uint64_t m = to_bits(Vec64uc().load_a(b) == uint8_t(0)) & string_mask_begin(b, s);
+    while (m == 0) {
+        b += 64;
+        m = to_bits(Vec64uc().load_a(b) == uint8_t(0));
+    }
+    return size_t(b - (uint8_t const *)s + bit_scan_forward(m));
+}
+
+// Number of bytes c in s[0..n-1]
+static inline size_t count_byte(void const * s, size_t n, uint8_t c) {
+    if (n == 0) return 0;
+    uint8_t const * p = (uint8_t const *)s;
+    uint8_t const * end = p + n;
+    uint8_t const * b = string_block(p);
+    Vec64uc cc(c);
+    uint64_t m = to_bits(Vec64uc().load_a(b) == cc) & string_mask_begin(b, p);
+    if (b + 64 >= end) {                         // only one block
+        return (size_t)vml_popcnt(m & string_mask_end(b, end));
+    }
+    size_t count = (size_t)vml_popcnt(m);
+    b += 64;
+    // Count the blocks before the last block in 8-bit accumulators. These are
+    // added up before they can overflow
+    size_t blocks = size_t(end - 1 - b) / 64;
+    while (blocks > 0) {
+        size_t k = blocks < 255 ? blocks : 255;
+        blocks -= k;
+        Vec64uc acc(0);
+        for (; k > 0; k--, b += 64) {
+            acc = if_add(Vec64uc().load_a(b) == cc, acc, uint8_t(1));
+        }
+        count += horizontal_add_x(acc.get_low()) + horizontal_add_x(acc.get_high());
+    }
+    m = to_bits(Vec64uc().load_a(b) == cc) & string_mask_end(b, end);
+    return count + (size_t)vml_popcnt(m);
+}
+
+
+/*****************************************************************************
+*
+*          UTF-8 validation
+*
+*****************************************************************************/
+
+// Error bits in the lookup tables of Keiser and Lemire
+const uint8_t utf8_too_short    = 1 << 0;        // lead byte followed by lead byte or ASCII
+const uint8_t utf8_too_long     = 1 << 1;        // ASCII followed by continuation byte
+const uint8_t utf8_overlong_3   = 1 << 2;        // overlong 3-byte encoding
+const uint8_t utf8_too_large    = 1 << 3;        // code point above 0x10FFFF
+const uint8_t utf8_surrogate    = 1 << 4;        // code point 0xD800 - 0xDFFF
+const uint8_t utf8_overlong_2   = 1 << 5;        // overlong 2-byte encoding
+const uint8_t utf8_too_large_1000 = 1 << 6;      // code point above 0x10FFFF, 4-byte lead 0xF4
+const uint8_t utf8_overlong_4   = 1 << 6;        // overlong 4-byte encoding
+const uint8_t utf8_two_conts    = 1 << 7;        // two continuation bytes
+const uint8_t utf8_carry = utf8_too_short | utf8_too_long | utf8_two_conts;
+
+// Classify errors in each byte x with the previous byte prev1. prev2 and prev3
+// are the bytes 2 and 3 positions before. Returns nonzero where there is an error
+static inline Vec64uc utf8_errors(Vec64uc const x, Vec64uc const prev1, Vec64uc const prev2, Vec64uc const prev3) {
+    alignas(16) static const uint8_t byte_1_high[16] = {
+        // 0_______ ASCII
+        utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long,
+        utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long,
+        // 10______ continuation
+        utf8_two_conts, utf8_two_conts, utf8_two_conts, utf8_two_conts,
+        // 1100____ two byte lead
+        utf8_too_short | utf8_overlong_2,
+        // 1101____ two byte lead
+        utf8_too_short,
+        // 1110____ three byte lead
+        utf8_too_short | utf8_overlong_3 | utf8_surrogate,
+        // 1111____ four byte lead
+        utf8_too_short | utf8_too_large | utf8_too_large_1000 | utf8_overlong_4 };
+    alignas(16) static const uint8_t byte_1_low[16] = {
+        // ____0000
+        utf8_carry | utf8_overlong_3 | utf8_overlong_2 | utf8_overlong_4,
+        // ____0001
+        utf8_carry | utf8_overlong_2,
+        // ____001_
+        utf8_carry, utf8_carry,
+        // ____0100
+        utf8_carry | utf8_too_large,
+        // ____0101 - ____1100
+        utf8_carry | utf8_too_large | utf8_too_large_1000,
+        utf8_carry | utf8_too_large | utf8_too_large_1000,
+        utf8_carry | utf8_too_large | utf8_too_large_1000,
+        utf8_carry | utf8_too_large | utf8_too_large_1000,
+        utf8_carry | utf8_too_large | utf8_too_large_1000,
+        utf8_carry | utf8_too_large | utf8_too_large_1000,
+        utf8_carry | utf8_too_large | utf8_too_large_1000,
+        utf8_carry | utf8_too_large | utf8_too_large_1000,
+        // ____1101
+        utf8_carry | utf8_too_large | utf8_too_large_1000 | utf8_surrogate,
+        // ____111_
+        utf8_carry | utf8_too_large | utf8_too_large_1000,
+        utf8_carry | utf8_too_large | utf8_too_large_1000 };
+    alignas(16) static const uint8_t byte_2_high[16] = {
+        // 0_______ ASCII
+        utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short,
+        utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short,
+        // 1000____
+        utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large_1000 | utf8_overlong_4,
+        // 1001____
+        utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large,
+        // 101_____
+        utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large,
+        utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large,
+        // 11______ lead
+        utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short };
+
+    Vec64uc special = lookup16_lanes(prev1 >> 4, vector_from_table(byte_1_high))
+        & lookup16_lanes(prev1 & uint8_t(0x0F), vector_from_table(byte_1_low))
+        & lookup16_lanes(x >> 4, vector_from_table(byte_2_high));
+    // a third byte after a lead byte 111_____ or a fourth byte after 1111____
+    // must be a continuation byte. special has bit 7 for two continuation bytes
+    Vec64uc must23 = sub_saturated(prev2, Vec64uc(0xE0 - 0x80)) | sub_saturated(prev3, Vec64uc(0xF0 - 0x80));
+    return (must23 & uint8_t(0x80)) ^ special;
+}
+
+// True if s[0..n-1] is valid UTF-8
+static inline bool utf8_validate(void const * s, size_t n) {
+    uint8_t const * p = (uint8_t const *)s;
+    Vec64uc err(0);
+    uint8_t buf[3 + 64];
+    size_t i = 0;
+    // first block, with zero bytes before the beginning
+    memset(buf, 0, sizeof(buf));
+    memcpy(buf + 3, p, n < 64 ? n : 64);
+    err = utf8_errors(Vec64uc().load(buf + 3), Vec64uc().load(buf + 2), Vec64uc().load(buf + 1), Vec64uc().load(buf));
+    // The previous bytes are read with unaligned loads from the array
+    for (i = 64; i + 64 <= n; i += 64) {
+        Vec64uc x = Vec64uc().load(p + i);
+        Vec64uc prev3 = Vec64uc().load(p + i - 3);
+        if (!horizontal_or((x | prev3) > uint8_t(0x7F))) continue;   // all ASCII
+        err |= utf8_errors(x, Vec64uc().load(p + i - 1), Vec64uc().load(p + i - 2), prev3);
+    }
+    if (i < n) {                                 // last partial block, padded with zeros
+        memset(buf, 0, sizeof(buf));
+        memcpy(buf, p + i - 3, n - i + 3);
+        err |= utf8_errors(Vec64uc().load(buf + 3), Vec64uc().load(buf + 2), Vec64uc().load(buf + 1), Vec64uc().load(buf));
+    }
+    if (horizontal_or(err != uint8_t(0))) return false;
+    // check for an incomplete sequence in the last 3 bytes
+    if (n >= 1 && p[n-1] >= 0xC0) return false;
+    if (n >= 2 && p[n-2] >= 0xE0) return false;
+    if (n >= 3 && p[n-3] >= 0xF0) return false;
+    return true;
+}
+
+
+/*****************************************************************************
+*
+*          Structural index
+*
+*****************************************************************************/
+
+// Prefix XOR of the bits of x. Bit i of the result is the XOR of bits 0 - i of x
+static inline uint64_t prefix_xor(uint64_t x) {
+#if defined(__PCLMUL__) && defined(__x86_64__)
+    // carry-less multiplication by all ones
+    return (uint64_t)_mm_cvtsi128_si64(_mm_clmulepi64_si128(_mm_set_epi64x(0, (int64_t)x), _mm_set1_epi8(-1), 0));
+#else
+    x ^= x << 1;  x ^= x << 2;  x ^= x << 4;
+    x ^= x << 8;  x ^= x << 16; x ^= x << 32;
+    return x;
+#endif
+}
+
+// Write the positions of the characters chars... that are not inside a string
+// quoted by quote, and the positions of the quote characters, to index.
+// Returns the number of positions written. n must be less than 2^32
+template <char quote, char ... chars>
+static inline size_t structural_index(void const * s, size_t n, uint32_t * index) {
+    if (n == 0) return 0;
+    uint8_t const * p = (uint8_t const *)s;
+    uint8_t const * end = p + n;
+    uint8_t const * b = string_block(p);
+    uint64_t mask = string_mask_begin(b, p);
+    uint64_t inside = 0;                         // all ones if the previous block ended inside quotes
+    size_t count = 0;
+    while (true) {
+        if (b + 64 >= end) mask &= string_mask_end(b, end);
+        Vec64uc x = Vec64uc().load_a(b);
+        uint64_t q = to_bits(x == uint8_t(quote)) & mask;
+        uint64_t c = to_bits(byte_set_match<chars...>(x)) & mask;
+        uint64_t quoted = prefix_xor(q) ^ inside;
+        inside = uint64_t(int64_t(quoted) >> 63);
+        uint64_t m = (c & ~quoted) | q;
+        uint32_t base = uint32_t(b - p);         // wraps around for the first block
+        while (m) {
+            index[count++] = base + bit_scan_forward(m);
+            m &= m - 1;                          // remove lowest bit
+        }
+        b += 64;
+        if (b >= end) break;
+        mask = ~uint64_t(0);
+    }
+    return count;
+}
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTOR_STRING_H
@@ -0,0 +1,543 @@
+/****************************  vectorbf16.h   *******************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file defining vector classes of bfloat16 numbers.
+* The bfloat16 format has the same exponent range as single precision float,
+* but only 8 bits of mantissa, including the implicit bit.
+*
+* The following vector classes are defined here:
+* Vec8bf    Vector of  8 bfloat16 numbers in 128 bit vector
+* Vec16bf   Vector of 16 bfloat16 numbers in 256 bit vector
+* Vec32bf   Vector of 32 bfloat16 numbers in 512 bit vector
+*
+* These vectors are intended for storage only. No arithmetic operators are
+* defined. Calculations are done by converting to float vectors:
+* to_float(Vec8bf)             convert to Vec8f
+* to_float(Vec16bf)            convert to Vec16f
+* to_bfloat16(Vec8f)           convert to Vec8bf, round to nearest or even
+* to_bfloat16(Vec16f)          convert to Vec16bf
+* to_bfloat16(Vec4f, Vec4f)    convert two vectors to Vec8bf
+* to_bfloat16(Vec8f, Vec8f)    convert two vectors to Vec16bf
+* to_bfloat16(Vec16f, Vec16f)  convert two vectors to Vec32bf
+* dot2_bf16(acc, a, b)         acc[i] + a[2i]*b[2i] + a[2i+1]*b[2i+1]
+*
+* The conversions and dot products use the AVX512_BF16 instructions if the code
+* is compiled for AVX512_BF16 (-mavx512bf16), otherwise they are emulated with
+* integer instructions. Denormal numbers are flushed to zero by the AVX512_BF16
+* instructions, but not by the emulation. Use hasAVX512BF16() for detecting
+* the instruction set at runtime.
+*
+* For detailed instructions see vcl_manual.pdf
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+*****************************************************************************/
+
+#ifndef VECTORBF16_H
+#define VECTORBF16_H  20300
+
+#ifndef VECTORCLASS_H
+#include "vectorclass.h"
+#endif
+
+#if VECTORCLASS_H < 20200
+#error Incompatible versions of vector class library mixed
+#endif
+
+#if MAX_VECTOR_SIZE < 256
+#error bfloat16 vectors not supported for MAX_VECTOR_SIZE < 256
+#endif
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+
+/*****************************************************************************
+*
+*        Bfloat16: Scalar bfloat16 number
+*
+*****************************************************************************/
+
+class Bfloat16 {
+protected:
+    uint16_t x;
+public:
+    // Default constructor:
+    Bfloat16() = default;
+    // Constructor to convert float to bfloat16. Round to nearest or even
+    Bfloat16(float f) {
+        union {
+            float f;
+            uint32_t i;
+        } u;
+        u.f = f;
+        if ((u.i & 0x7FFFFFFF) > 0x7F800000) {   // NAN. Make sure it stays NAN
+            x = uint16_t((u.i >> 16) | 0x40);
+        }
+        else {                                   // round to nearest or even. Overflow gives infinity
+            x = uint16_t((u.i + 0x7FFF + ((u.i >> 16) & 1)) >> 16);
+        }
+    }
+    // Type cast operator to convert bfloat16 to float
+    operator float() const {
+        union {
+            uint32_t i;
+            float f;
+        } u;
+        u.i = uint32_t(x) << 16;
+        return u.f;
+    }
+    void setBits(uint16_t a) {
+        x = a;
+    }
+    uint16_t getBits() const {
+        return x;
+    }
+};
+
+static inline int16_t castbf162s(Bfloat16 a) {
+    return int16_t(a.getBits());
+}
+
+static inline Bfloat16 casts2bf16(int16_t a) {
+    Bfloat16 f;
+    f.setBits(uint16_t(a));
+    return f;
+}
+
+
+/*****************************************************************************
+*
+*          Vec8bf: Vector of 8 bfloat16 numbers
+*
+*****************************************************************************/
+
+class Vec8bf {
+protected:
+    __m128i xmm; // bfloat16 vector
+public:
+    // Default constructor:
+    Vec8bf() = default;
+    // Constructor to broadcast the same value into all elements:
+    Vec8bf(Bfloat16 f) {
+        xmm = _mm_set1_epi16 (castbf162s(f));
+    }
+    // Constructor to build from all elements:
+    Vec8bf(Bfloat16 f0, Bfloat16 f1, Bfloat16 f2, Bfloat16 f3, Bfloat16 f4, Bfloat16 f5, Bfloat16 f6, Bfloat16 f7) {
+        xmm = _mm_setr_epi16 (castbf162s(f0), castbf162s(f1), castbf162s(f2), castbf162s(f3), castbf162s(f4), castbf162s(f5), castbf162s(f6), castbf162s(f7));
+    }
+    // Constructor to convert from type __m128i used in intrinsics:
+    Vec8bf(__m128i const x) {
+        xmm = x;
+    }
+    // Assignment operator to convert from type __m128i used in intrinsics:
+    Vec8bf & operator = (__m128i const x) {
+        xmm = x;
+        return *this;
+    }
+    // Type cast operator to convert to __m128i used in intrinsics
+    operator __m128i() const {
+        return xmm;
+    }
+    // Member function to load from array (unaligned)
+    Vec8bf & load(void const * p) {
+        xmm = _mm_loadu_si128 ((const __m128i *)p);
+        return *this;
+    }
+    // Member function to load from array, aligned by 16
+    Vec8bf & load_a(void const * p) {
+        xmm = _mm_load_si128 ((const __m128i *)p);
+        return *this;
+    }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec8bf & load_nt(void const * p) {
+        xmm = load_nt_128(p);
+        return *this;
+    }
+    // Member function to store into array (unaligned)
+    void store(void * p) const {
+        _mm_storeu_si128 ((__m128i *)p, xmm);
+    }
+    // Member function storing into array, aligned by 16
+    void store_a(void * p) const {
+        _mm_store_si128 ((__m128i *)p, xmm);
+    }
+    // Member function storing to aligned uncached memory (non-temporal store).
+    // Note: Will generate runtime error if p is not aligned by 16
+    void store_nt(void * p) const {
+        _mm_stream_si128((__m128i*)p, xmm);
+    }
+    // Partial load. Load n elements and set the rest to 0
+    Vec8bf & load_partial(int n, void const * p) {
+        xmm = Vec8s().load_partial(n, p);
+        return *this;
+    }
+    // Partial store. Store n elements
+    void store_partial(int n, void * p) const {
+        Vec8s(xmm).store_partial(n, p);
+    }
+    // cut off vector to n elements. The last 8-n elements are set to zero
+    Vec8bf & cutoff(int n) {
+        xmm = Vec8s(xmm).cutoff(n);
+        return *this;
+    }
+    // Member function to change a single element in vector
+    Vec8bf const insert(int index, Bfloat16 a) {
+        xmm = Vec8s(xmm).insert(index, castbf162s(a));
+        return *this;
+    }
+    // Member function extract a single element from vector
+    Bfloat16 extract(int index) const {
+        return casts2bf16(Vec8s(xmm).extract(index));
+    }
+    // Extract a single element. Use store function if extracting more than one element.
+    // Operator [] can only read an element, not write.
+    Bfloat16 operator [] (int index) const {
+        return extract(index);
+    }
+    static constexpr int size() {
+        return 8;
+    }
+    static constexpr int elementtype() {
+        return 14;
+    }
+    typedef __m128i registertype;
+};
+
+
+/*****************************************************************************
+*
+*          Vec16bf: Vector of 16 bfloat16 numbers
+*
+*****************************************************************************/
+
+class Vec16bf : public Vec16s {
+public:
+    // Default constructor:
+    Vec16bf() = default;
+    // Constructor to broadcast the same value into all elements:
+    Vec16bf(Bfloat16 f) : Vec16s(castbf162s(f)) {}
+    // Constructor to build from two Vec8bf:
+    Vec16bf(Vec8bf const a0, Vec8bf const a1) : Vec16s(Vec8s(a0), Vec8s(a1)) {}
+#if INSTRSET >= 8
+    // Constructor to convert from type __m256i used in intrinsics:
+    Vec16bf(__m256i const x) {
+        ymm = x;
+    }
+    // Assignment operator to convert from type __m256i used in intrinsics:
+    Vec16bf & operator = (__m256i const x) {
+        ymm = x;
+        return *this;
+    }
+    // Type cast operator to convert to __m256i used in intrinsics
+    operator __m256i() const {
+        return ymm;
+    }
+#else
+    // Constructor to convert from the emulated type Vec16s
+    Vec16bf(Vec16s const x) : Vec16s(x) {}
+#endif
+    // Member function to load from array (unaligned)
+    Vec16bf & load(void const * p) {
+        Vec16s::load(p);
+        return *this;
+    }
+    // Member function to load from array, aligned by 32
+    Vec16bf & load_a(void const * p) {
+        Vec16s::load_a(p);
+        return *this;
+    }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec16bf & load_nt(void const * p) {
+        Vec16s::load_nt(p);
+        return *this;
+    }
+    // Member functions store, store_a, store_nt, store_partial are inherited from Vec16s
+
+    // Partial load. Load n elements and set the rest to 0
+    Vec16bf & load_partial(int n, void const * p) {
+        Vec16s::load_partial(n, p);
+        return *this;
+    }
+    // cut off vector to n elements. The last 16-n elements are set to zero
+    Vec16bf & cutoff(int n) {
+        Vec16s::cutoff(n);
+        return *this;
+    }
+    // Member function to change a single element in vector
+    Vec16bf const insert(int index, Bfloat16 a) {
+        Vec16s::insert(index, castbf162s(a));
+        return *this;
+    }
+    // Member function extract a single element from vector
+    Bfloat16 extract(int index) const {
+        return casts2bf16(Vec16s::extract(index));
+    }
+    // Extract a single element. Use store function if extracting more than one element.
+    // Operator [] can only read an element, not write.
+    Bfloat16 operator [] (int index) const {
+        return extract(index);
+    }
+    Vec8bf get_low() const {
+        return __m128i(Vec16s::get_low());
+    }
+    Vec8bf get_high() const {
+        return __m128i(Vec16s::get_high());
+    }
+    static constexpr int size() {
+        return 16;
+    }
+    static constexpr int elementtype() {
+        return 14;
+    }
+};
+
+
+#if MAX_VECTOR_SIZE >= 512
+
+/*****************************************************************************
+*
+*          Vec32bf: Vector of 32 bfloat16 numbers
+*
+*****************************************************************************/
+
+class Vec32bf : public Vec32s {
+public:
+    // Default constructor:
+    Vec32bf() = default;
+    // Constructor to broadcast the same value into all elements:
+    Vec32bf(Bfloat16 f) : Vec32s(castbf162s(f)) {}
+    // Constructor to build from two Vec16bf:
+    Vec32bf(Vec16bf const a0, Vec16bf const a1) : Vec32s(Vec16s(a0), Vec16s(a1)) {}
+#if INSTRSET >= 10
+    // Constructor to convert from type __m512i used in intrinsics:
+    Vec32bf(__m512i const x) {
+        zmm = x;
+    }
+    // Assignment operator to convert from type __m512i used in intrinsics:
+    Vec32bf & operator = (__m512i const x) {
+        zmm = x;
+        return *this;
+    }
+    // Type cast operator to convert to __m512i used in intrinsics
+    operator __m512i() const {
+        return zmm;
+    }
+#else
+    // Constructor to convert from the emulated type Vec32s
+    Vec32bf(Vec32s const x) : Vec32s(x) {}
+#endif
+    // Member function to load from array (unaligned)
+    Vec32bf & load(void const * p) {
+        Vec32s::load(p);
+        return *this;
+    }
+    // Member function to load from array, aligned by 64
+    Vec32bf & load_a(void const * p) {
+        Vec32s::load_a(p);
+        return *this;
+    }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec32bf & load_nt(void const * p) {
+        Vec32s::load_nt(p);
+        return *this;
+    }
+    // Member functions store, store_a, store_nt, store_partial are inherited from Vec32s
+
+    // Partial load. Load n elements and set the rest to 0
+    Vec32bf & load_partial(int n, void const * p) {
+        Vec32s::load_partial(n, p);
+        return *this;
+    }
+    // cut off vector to n elements. The last 32-n elements are set to zero
+    Vec32bf & cutoff(int n) {
+        Vec32s::cutoff(n);
+        return *this;
+    }
+    // Member function to change a single element in vector
+    Vec32bf const insert(int index, Bfloat16 a) {
+        Vec32s::insert(index, castbf162s(a));
+        return *this;
+    }
+    // Member function extract a single element from vector
+    Bfloat16 extract(int index) const {
+        return casts2bf16(Vec32s::extract(index));
+    }
+    // Extract a single element. Use store function if extracting more than one element.
+    // Operator [] can only read an element, not write.
+    Bfloat16 operator [] (int index) const {
+        return extract(index);
+    }
+    Vec16bf get_low() const {
+        return Vec16bf(Vec32s::get_low());
+    }
+    Vec16bf get_high() const {
+        return Vec16bf(Vec32s::get_high());
+    }
+    static constexpr int size() {
+        return 32;
+    }
+    static constexpr int elementtype() {
+        return 14;
+    }
+};
+
+#endif // MAX_VECTOR_SIZE >= 512
+
+
+/*****************************************************************************
+*
+*          Conversions between bfloat16 and float
+*
+*****************************************************************************/
+
+// Round float to bfloat16, emulated. Returns the bfloat16 bits in the low half
+// of each 32-bit element. The high half is garbage.
+// Rounding is to nearest or even. NAN is kept as NAN
+// VI: signed integer vector type with the same size as VF
+template <typename VI, typename VF>
+static inline VI bf16_round_bits(VF const x) {
+    VI a = VI(reinterpret_i(x));                           // bit-cast to integer
+    VI r = a + ((a >> 16) & 1) + 0x7FFF;                   // round to nearest or even
+    r = select(decltype(a > a)(is_nan(x)), a | 0x400000, r); // make NAN quiet so that it does not become INF
+    return r >> 16;
+}
+
+// extend precision: Vec8bf -> Vec8f
+static inline Vec8f to_float(Vec8bf const a) {
+#if INSTRSET >= 8  // AVX2
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(a), 16));
+#else
+    __m128i lo = _mm_unpacklo_epi16(_mm_setzero_si128(), a);  // put each element in the high half of 32 bits
+    __m128i hi = _mm_unpackhi_epi16(_mm_setzero_si128(), a);
+    return Vec8f(_mm_castsi128_ps(lo), _mm_castsi128_ps(hi));
+#endif
+}
+
+// reduce precision: Vec8f -> Vec8bf
+static inline Vec8bf to_bfloat16(Vec8f const a) {
+#if defined(__AVX512BF16__) && INSTRSET >= 10
+    return (__m128i)_mm256_cvtneps_pbh(a);
+#else
+    return __m128i(compress(bf16_round_bits<Vec8i>(a)));
+#endif
+}
+
+// reduce precision: two Vec4f -> Vec8bf. a gives the low half, b the high half
+static inline Vec8bf to_bfloat16(Vec4f const a, Vec4f const b) {
+#if defined(__AVX512BF16__) && INSTRSET >= 10
+    return (__m128i)_mm_cvtne2ps_pbh(b, a);
+#else
+    return __m128i(compress(bf16_round_bits<Vec4i>(a), bf16_round_bits<Vec4i>(b)));
+#endif
+}
+
+// reduce precision: two Vec8f -> Vec16bf. a gives the low half, b the high half
+static inline Vec16bf to_bfloat16(Vec8f const a, Vec8f const b) {
+#if defined(__AVX512BF16__) && INSTRSET >= 10
+    return (__m256i)_mm256_cvtne2ps_pbh(b, a);
+#else
+    return Vec16bf(to_bfloat16(a), to_bfloat16(b));
+#endif
+}
+
+#if MAX_VECTOR_SIZE >= 512
+
+// extend precision: Vec16bf -> Vec16f
+static inline Vec16f to_float(Vec16bf const a) {
+#if INSTRSET >= 9  // AVX512F
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(a), 16));
+#else
+    return Vec16f(to_float(a.get_low()), to_float(a.get_high()));
+#endif
+}
+
+// reduce precision: Vec16f -> Vec16bf
+static inline Vec16bf to_bfloat16(Vec16f const a) {
+#if defined(__AVX512BF16__) && INSTRSET >= 10
+    return (__m256i)_mm512_cvtneps_pbh(a);
+#elif INSTRSET >= 9
+    return __m256i(compress(bf16_round_bits<Vec16i>(a)));
+#else
+    return Vec16bf(to_bfloat16(a.get_low()), to_bfloat16(a.get_high()));
+#endif
+}
+
+// reduce precision: two Vec16f -> Vec32bf. a gives the low half, b the high half
+static inline Vec32bf to_bfloat16(Vec16f const a, Vec16f const b) {
+#if defined(__AVX512BF16__) && INSTRSET >= 10
+    return (__m512i)_mm512_cvtne2ps_pbh(b, a);
+#else
+    return Vec32bf(to_bfloat16(a), to_bfloat16(b));
+#endif
+}
+
+#endif // MAX_VECTOR_SIZE >= 512
+
+
+/*****************************************************************************
+*
+*          Dot products of pairs
+*
+*****************************************************************************/
+// dot2_bf16(acc, a, b) = acc[i] + a[2i+1]*b[2i+1] + a[2i]*b[2i]
+// The products are exact in single precision. The odd products are added first,
+// as in the AVX512_BF16 instruction vdpbf16ps
+
+static inline Vec4f dot2_bf16(Vec4f const acc, Vec8bf const a, Vec8bf const b) {
+#if defined(__AVX512BF16__) && INSTRSET >= 10
+    return _mm_dpbf16_ps(acc, (__m128bh)__m128i(a), (__m128bh)__m128i(b));
+#else
+    __m128i const mask = _mm_set1_epi32(int32_t(0xFFFF0000));
+    Vec4f ae = _mm_castsi128_ps(_mm_slli_epi32(a, 16));    // even elements
+    Vec4f be = _mm_castsi128_ps(_mm_slli_epi32(b, 16));
+    Vec4f ao = _mm_castsi128_ps(_mm_and_si128(a, mask));   // odd elements
+    Vec4f bo = _mm_castsi128_ps(_mm_and_si128(b, mask));
+    return mul_add(ae, be, mul_add(ao, bo, acc));
+#endif
+}
+
+static inline Vec8f dot2_bf16(Vec8f const acc, Vec16bf const a, Vec16bf const b) {
+#if defined(__AVX512BF16__) && INSTRSET >= 10
+    return _mm256_dpbf16_ps(acc, (__m256bh)__m256i(a), (__m256bh)__m256i(b));
+#elif INSTRSET >= 8  // AVX2
+    __m256i const mask = _mm256_set1_epi32(int32_t(0xFFFF0000));
+    Vec8f ae = _mm256_castsi256_ps(_mm256_slli_epi32(a, 16));  // even elements
+    Vec8f be = _mm256_castsi256_ps(_mm256_slli_epi32(b, 16));
+    Vec8f ao = _mm256_castsi256_ps(_mm256_and_si256(a, mask)); // odd elements
+    Vec8f bo = _mm256_castsi256_ps(_mm256_and_si256(b, mask));
+    return mul_add(ae, be, mul_add(ao, bo, acc));
+#else
+    return Vec8f(dot2_bf16(acc.get_low(), a.get_low(), b.get_low()), dot2_bf16(acc.get_high(), a.get_high(), b.get_high()));
+#endif
+}
+
+#if MAX_VECTOR_SIZE >= 512
+
+static inline Vec16f dot2_bf16(Vec16f const acc, Vec32bf const a, Vec32bf const b) {
+#if defined(__AVX512BF16__) && INSTRSET >= 10
+    return _mm512_dpbf16_ps(acc, (__m512bh)__m512i(a), (__m512bh)__m512i(b));
+#elif INSTRSET >= 10  // AVX512BW
+    __m512i const mask = _mm512_set1_epi32(int32_t(0xFFFF0000));
+    Vec16f ae = _mm512_castsi512_ps(_mm512_slli_epi32(a, 16));  // even elements
+    Vec16f be = _mm512_castsi512_ps(_mm512_slli_epi32(b, 16));
+    Vec16f ao = _mm512_castsi512_ps(_mm512_and_si512(a, mask)); // odd elements
+    Vec16f bo = _mm512_castsi512_ps(_mm512_and_si512(b, mask));
+    return mul_add(ae, be, mul_add(ao, bo, acc));
+#else
+    return Vec16f(dot2_bf16(acc.get_low(), a.get_low(), b.get_low()), dot2_bf16(acc.get_high(), a.get_high(), b.get_high()));
+#endif
+}
+
+#endif // MAX_VECTOR_SIZE >= 512
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif // VECTORBF16_H
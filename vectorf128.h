@@ -520,6 +520,11 @@ public:
         xmm = _mm_load_ps(p);
         return *this;
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec4f & load_nt(float const * p) {
+        xmm = _mm_castsi128_ps(load_nt_128(p));
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(float * p) const {
         _mm_storeu_ps(p, xmm);
@@ -911,6 +916,42 @@ static inline Vec4f if_div(Vec4fb const f, Vec4f const a, Vec4f const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec4f maskz_add(Vec4fb const f, Vec4f const a, Vec4f const b) {
+#if INSTRSET >= 10
+    return _mm_maskz_add_ps(f, a, b);
+#else
+    return Vec4f(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec4f maskz_sub(Vec4fb const f, Vec4f const a, Vec4f const b) {
+#if INSTRSET >= 10
+    return _mm_maskz_sub_ps(f, a, b);
+#else
+    return Vec4f(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec4f maskz_mul(Vec4fb const f, Vec4f const a, Vec4f const b) {
+#if INSTRSET >= 10
+    return _mm_maskz_mul_ps(f, a, b);
+#else
+    return Vec4f(f) & (a * b);
+#endif
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec4f maskz_div(Vec4fb const f, Vec4f const a, Vec4f const b) {
+#if INSTRSET >= 10
+    return _mm_maskz_div_ps(f, a, b);
+#else
+    return Vec4f(f) & (a / select(f, b, 1.f));
+#endif
+}
+
 // Sign functions
 
 // Function sign_bit: gives true for elements that have the sign bit set
@@ -1122,15 +1163,91 @@ inline Vec4f pow<uint32_t>(Vec4f const x0, uint32_t const n) {
 
 // Raise floating point numbers to integer power n, where n is a compile-time constant
 
+// Addition chain for calculating x^n with a minimum number of multiplications.
+// Element 0 of the chain is x. Element i+1 is element i multiplied by element b[i]
+struct Pow_chain {
+    int len;                                     // number of multiplications
+    int b[12];                                   // index of second factor in each step
+};
+
+// Depth-first search for a star chain for n with no more than maxlen multiplications.
+// e[0..k] are the exponents found so far. Star chains are optimal for n < 12509
+constexpr bool pow_chain_search(int e[], Pow_chain & c, int k, int maxlen, int n) {
+    if (e[k] == n) {
+        c.len = k;
+        return true;
+    }
+    if (k == maxlen) return false;
+    for (int j = k; j >= 0; j--) {               // try the biggest steps first
+        if (e[k] + e[j] > n) continue;
+        e[k+1] = e[k] + e[j];
+        // give up if doubling in each remaining step cannot reach n. Smaller steps are no better
+        if ((e[k+1] << (maxlen - k - 1)) < n) break;
+        c.b[k] = j;
+        if (pow_chain_search(e, c, k + 1, maxlen, n)) return true;
+    }
+    return false;
+}
+
+// Number of multiplications used by the binary method in pow_n
+constexpr int pow_binary_length(int n) {
+    int len = 0;
+    for (int m = n; m > 1; m >>= 1) len += 1 + (m & 1);
+    return len;
+}
+
+// Find the shortest addition chain for 0 < n < 256 by iterative deepening.
+// Returns a chain length of pow_binary_length(n) if no shorter chain exists
+constexpr Pow_chain pow_chain_make(int n) {
+    Pow_chain c = {};
+    int e[13] = {1};
+    int log2n = 0, bits = 0;
+    for (int m = n; m > 1; m >>= 1) log2n++;
+    for (int m = n; m != 0; m >>= 1) bits += m & 1;
+    // The binary method is optimal for n with no more than 3 bits set.
+    // Otherwise, the chain needs at least log2n + 2 multiplications (Knuth)
+    c.len = pow_binary_length(n);
+    if (bits <= 3) return c;
+    for (int maxlen = log2n + 2; maxlen < pow_binary_length(n); maxlen++) {
+        if (pow_chain_search(e, c, 0, maxlen, n)) break;
+    }
+    return c;
+}
+
+// Shortest addition chain for n, calculated only once for each n
+template <int n>
+struct Pow_chain_n {
+    static constexpr Pow_chain chain = pow_chain_make(n);
+};
+
+// Calculate step i and all following steps of the addition chain for x^n in e[]
+template <typename V, int n, int i>
+static inline void pow_chain_step(V e[]) {
+    if constexpr (i < Pow_chain_n<n>::chain.len) {
+        e[i+1] = e[i] * e[Pow_chain_n<n>::chain.b[i]];
+        pow_chain_step<V, n, i + 1>(e);
+    }
+}
+
 // gcc can optimize pow_template_i to generate the same as the code below. MS and Clang can not.
 // Therefore, this code is kept
 // to do: test on Intel compiler
 template <typename V, int n>
 static inline V pow_n(V const a) {
-    if (n == 0x80000000) return nan_vec<V>();    // integer overflow
+    if (uint32_t(n) == 0x80000000u) return nan_vec<V>();  // integer overflow
     if (n < 0)    return V(1.0f) / pow_n<V, -n>(a);
     if (n == 0)   return V(1.0f);
     if (n >= 256) return pow(a, n);
+    if constexpr (n > 0 && n < 256) {
+        // Use the shortest addition chain if it needs fewer multiplications than the binary
+        // method below. The binary method has a shorter dependency chain when they are equal
+        if constexpr (Pow_chain_n<n>::chain.len < pow_binary_length(n)) {
+            V e[Pow_chain_n<n>::chain.len + 1];
+            e[0] = a;
+            pow_chain_step<V, n, 0>(e);
+            return e[Pow_chain_n<n>::chain.len];
+        }
+    }
     V x = a;                                     // a^(2^i)
     V y;                                         // accumulator
     const int lowest = n - (n & (n - 1));        // lowest set bit in n
@@ -1339,6 +1456,25 @@ static inline Vec4f nmul_add(Vec4f const a, Vec4f const b, Vec4f const c) {
 #endif
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec4f if_fma(Vec4fb const f, Vec4f const a, Vec4f const b, Vec4f const c) {
+#if INSTRSET >= 10
+    return _mm_mask3_fmadd_ps(a, b, c, f);
+#else
+    return select(f, mul_add(a, b, c), c);
+#endif
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec4f maskz_fma(Vec4fb const f, Vec4f const a, Vec4f const b, Vec4f const c) {
+#if INSTRSET >= 10
+    return _mm_maskz_fmadd_ps(f, a, b, c);
+#else
+    return Vec4f(f) & mul_add(a, b, c);
+#endif
+}
+
 // Multiply and subtract with extra precision on the intermediate calculations,
 // even if FMA instructions not supported, using Veltkamp-Dekker split.
 // This is used in mathematical functions. Do not use it in general code
@@ -1514,6 +1650,11 @@ public:
         xmm = _mm_load_pd(p);
         return *this;
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec2d & load_nt(double const * p) {
+        xmm = _mm_castsi128_pd(load_nt_128(p));
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(double * p) const {
         _mm_storeu_pd(p, xmm);
@@ -1889,6 +2030,42 @@ static inline Vec2d if_div(Vec2db const f, Vec2d const a, Vec2d const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec2d maskz_add(Vec2db const f, Vec2d const a, Vec2d const b) {
+#if INSTRSET >= 10
+    return _mm_maskz_add_pd(f, a, b);
+#else
+    return Vec2d(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec2d maskz_sub(Vec2db const f, Vec2d const a, Vec2d const b) {
+#if INSTRSET >= 10
+    return _mm_maskz_sub_pd(f, a, b);
+#else
+    return Vec2d(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec2d maskz_mul(Vec2db const f, Vec2d const a, Vec2d const b) {
+#if INSTRSET >= 10
+    return _mm_maskz_mul_pd(f, a, b);
+#else
+    return Vec2d(f) & (a * b);
+#endif
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec2d maskz_div(Vec2db const f, Vec2d const a, Vec2d const b) {
+#if INSTRSET >= 10
+    return _mm_maskz_div_pd(f, a, b);
+#else
+    return Vec2d(f) & (a / select(f, b, 1.0));
+#endif
+}
+
 // Sign functions
 
 // change signs on vectors Vec2d
@@ -2309,6 +2486,25 @@ static inline Vec2d nmul_add(Vec2d const a, Vec2d const b, Vec2d const c) {
 #endif
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec2d if_fma(Vec2db const f, Vec2d const a, Vec2d const b, Vec2d const c) {
+#if INSTRSET >= 10
+    return _mm_mask3_fmadd_pd(a, b, c, f);
+#else
+    return select(f, mul_add(a, b, c), c);
+#endif
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec2d maskz_fma(Vec2db const f, Vec2d const a, Vec2d const b, Vec2d const c) {
+#if INSTRSET >= 10
+    return _mm_maskz_fmadd_pd(f, a, b, c);
+#else
+    return Vec2d(f) & mul_add(a, b, c);
+#endif
+}
+
 
 // Multiply and subtract with extra precision on the intermediate calculations,
 // even if FMA instructions not supported, using Veltkamp-Dekker split.
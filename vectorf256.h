@@ -613,6 +613,11 @@ public:
         ymm = _mm256_load_ps(p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec8f & load_nt(float const * p) {
+        ymm = _mm256_castsi256_ps(load_nt_256(p));
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(float * p) const {
         _mm256_storeu_ps(p, ymm);
@@ -1007,6 +1012,42 @@ static inline Vec8f if_div (Vec8fb const f, Vec8f const a, Vec8f const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec8f maskz_add (Vec8fb const f, Vec8f const a, Vec8f const b) {
+#if INSTRSET >= 10
+    return _mm256_maskz_add_ps (f, a, b);
+#else
+    return Vec8f(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec8f maskz_sub (Vec8fb const f, Vec8f const a, Vec8f const b) {
+#if INSTRSET >= 10
+    return _mm256_maskz_sub_ps (f, a, b);
+#else
+    return Vec8f(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec8f maskz_mul (Vec8fb const f, Vec8f const a, Vec8f const b) {
+#if INSTRSET >= 10
+    return _mm256_maskz_mul_ps (f, a, b);
+#else
+    return Vec8f(f) & (a * b);
+#endif
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec8f maskz_div (Vec8fb const f, Vec8f const a, Vec8f const b) {
+#if INSTRSET >= 10
+    return _mm256_maskz_div_ps (f, a, b);
+#else
+    return Vec8f(f) & (a / select(f, b, 1.f));
+#endif
+}
+
 // Sign functions
 
 // Function sign_bit: gives true for elements that have the sign bit set
@@ -1314,6 +1355,25 @@ static inline Vec8f nmul_add(Vec8f const a, Vec8f const b, Vec8f const c) {
 #endif
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec8f if_fma(Vec8fb const f, Vec8f const a, Vec8f const b, Vec8f const c) {
+#if INSTRSET >= 10
+    return _mm256_mask3_fmadd_ps(a, b, c, f);
+#else
+    return select(f, mul_add(a, b, c), c);
+#endif
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec8f maskz_fma(Vec8fb const f, Vec8f const a, Vec8f const b, Vec8f const c) {
+#if INSTRSET >= 10
+    return _mm256_maskz_fmadd_ps(f, a, b, c);
+#else
+    return Vec8f(f) & mul_add(a, b, c);
+#endif
+}
+
 
 // Multiply and subtract with extra precision on the intermediate calculations,
 // even if FMA instructions not supported, using Veltkamp-Dekker split
@@ -1474,6 +1534,11 @@ public:
         ymm = _mm256_load_pd(p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec4d & load_nt(double const * p) {
+        ymm = _mm256_castsi256_pd(load_nt_256(p));
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(double * p) const {
         _mm256_storeu_pd(p, ymm);
@@ -1857,6 +1922,42 @@ static inline Vec4d if_div (Vec4db const f, Vec4d const a, Vec4d const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec4d maskz_add (Vec4db const f, Vec4d const a, Vec4d const b) {
+#if INSTRSET >= 10
+    return _mm256_maskz_add_pd (f, a, b);
+#else
+    return Vec4d(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec4d maskz_sub (Vec4db const f, Vec4d const a, Vec4d const b) {
+#if INSTRSET >= 10
+    return _mm256_maskz_sub_pd (f, a, b);
+#else
+    return Vec4d(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec4d maskz_mul (Vec4db const f, Vec4d const a, Vec4d const b) {
+#if INSTRSET >= 10
+    return _mm256_maskz_mul_pd (f, a, b);
+#else
+    return Vec4d(f) & (a * b);
+#endif
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec4d maskz_div (Vec4db const f, Vec4d const a, Vec4d const b) {
+#if INSTRSET >= 10
+    return _mm256_maskz_div_pd (f, a, b);
+#else
+    return Vec4d(f) & (a / select(f, b, 1.0));
+#endif
+}
+
 // sign functions
 
 // Function sign_combine: changes the sign of a when b has the sign bit set
@@ -2179,6 +2280,25 @@ static inline Vec4d nmul_add(Vec4d const a, Vec4d const b, Vec4d const c) {
 #endif
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec4d if_fma(Vec4db const f, Vec4d const a, Vec4d const b, Vec4d const c) {
+#if INSTRSET >= 10
+    return _mm256_mask3_fmadd_pd(a, b, c, f);
+#else
+    return select(f, mul_add(a, b, c), c);
+#endif
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec4d maskz_fma(Vec4db const f, Vec4d const a, Vec4d const b, Vec4d const c) {
+#if INSTRSET >= 10
+    return _mm256_maskz_fmadd_pd(f, a, b, c);
+#else
+    return Vec4d(f) & mul_add(a, b, c);
+#endif
+}
+
 // Multiply and subtract with extra precision on the intermediate calculations,
 // even if FMA instructions not supported, using Veltkamp-Dekker split.
 // This is used in mathematical functions. Do not use it in general code
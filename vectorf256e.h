@@ -528,6 +528,12 @@ public:
         y1 = _mm_load_ps(p+4);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec8f & load_nt(float const * p) {
+        y0 = _mm_castsi128_ps(load_nt_128(p));
+        y1 = _mm_castsi128_ps(load_nt_128(p+4));
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(float * p) const {
         _mm_storeu_ps(p,   y0);
@@ -846,6 +852,26 @@ static inline Vec8f if_div (Vec8fb const f, Vec8f const a, Vec8f const b) {
     return a / select(f, b, 1.f);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec8f maskz_add (Vec8fb const f, Vec8f const a, Vec8f const b) {
+    return Vec8f(f) & (a + b);
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec8f maskz_sub (Vec8fb const f, Vec8f const a, Vec8f const b) {
+    return Vec8f(f) & (a - b);
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec8f maskz_mul (Vec8fb const f, Vec8f const a, Vec8f const b) {
+    return Vec8f(f) & (a * b);
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec8f maskz_div (Vec8fb const f, Vec8f const a, Vec8f const b) {
+    return Vec8f(f) & (a / select(f, b, 1.f));
+}
+
 // General arithmetic functions, etc.
 
 // Horizontal add: Calculates the sum of all vector elements.
@@ -973,6 +999,17 @@ static inline Vec8f nmul_add(Vec8f const a, Vec8f const b, Vec8f const c) {
     return Vec8f(nmul_add(a.get_low(),b.get_low(),c.get_low()), nmul_add(a.get_high(),b.get_high(),c.get_high()));
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec8f if_fma(Vec8fb const f, Vec8f const a, Vec8f const b, Vec8f const c) {
+    return select(f, mul_add(a, b, c), c);
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec8f maskz_fma(Vec8fb const f, Vec8f const a, Vec8f const b, Vec8f const c) {
+    return Vec8f(f) & mul_add(a, b, c);
+}
+
 
 // Multiply and subtract with extra precision on the intermediate calculations, used internally
 static inline Vec8f mul_sub_x(Vec8f const a, Vec8f const b, Vec8f const c) {
@@ -1124,6 +1161,12 @@ public:
         y1 = _mm_load_pd(p+2);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec4d & load_nt(double const * p) {
+        y0 = _mm_castsi128_pd(load_nt_128(p));
+        y1 = _mm_castsi128_pd(load_nt_128(p+2));
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(double * p) const {
         _mm_storeu_pd(p,   y0);
@@ -1443,6 +1486,26 @@ static inline Vec4d if_div (Vec4db const f, Vec4d const a, Vec4d const b) {
     return a / select(f, b, 1.);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec4d maskz_add (Vec4db const f, Vec4d const a, Vec4d const b) {
+    return Vec4d(f) & (a + b);
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec4d maskz_sub (Vec4db const f, Vec4d const a, Vec4d const b) {
+    return Vec4d(f) & (a - b);
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec4d maskz_mul (Vec4db const f, Vec4d const a, Vec4d const b) {
+    return Vec4d(f) & (a * b);
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec4d maskz_div (Vec4db const f, Vec4d const a, Vec4d const b) {
+    return Vec4d(f) & (a / select(f, b, 1.0));
+}
+
 
 // General arithmetic functions, etc.
 
@@ -1596,6 +1659,17 @@ static inline Vec4d nmul_add(Vec4d const a, Vec4d const b, Vec4d const c) {
     return Vec4d(nmul_add(a.get_low(),b.get_low(),c.get_low()), nmul_add(a.get_high(),b.get_high(),c.get_high()));
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec4d if_fma(Vec4db const f, Vec4d const a, Vec4d const b, Vec4d const c) {
+    return select(f, mul_add(a, b, c), c);
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec4d maskz_fma(Vec4db const f, Vec4d const a, Vec4d const b, Vec4d const c) {
+    return Vec4d(f) & mul_add(a, b, c);
+}
+
 // Multiply and subtract with extra precision on the intermediate calculations,
 // even if FMA instructions not supported, using Veltkamp-Dekker split
 static inline Vec4d mul_sub_x(Vec4d const a, Vec4d const b, Vec4d const c) {
@@ -133,6 +133,11 @@ public:
         zmm = _mm512_load_ps(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec16f & load_nt(float const * p) {
+        zmm = _mm512_castsi512_ps(load_nt_512(p));
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(float * p) const {
         _mm512_storeu_ps(p, zmm);
@@ -424,6 +429,26 @@ static inline Vec16f if_div (Vec16fb const f, Vec16f const a, Vec16f const b) {
     return _mm512_mask_div_ps(a, f, a, b);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec16f maskz_add (Vec16fb const f, Vec16f const a, Vec16f const b) {
+    return _mm512_maskz_add_ps (f, a, b);
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec16f maskz_sub (Vec16fb const f, Vec16f const a, Vec16f const b) {
+    return _mm512_maskz_sub_ps (f, a, b);
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec16f maskz_mul (Vec16fb const f, Vec16f const a, Vec16f const b) {
+    return _mm512_maskz_mul_ps (f, a, b);
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec16f maskz_div (Vec16fb const f, Vec16f const a, Vec16f const b) {
+    return _mm512_maskz_div_ps (f, a, b);
+}
+
 
 // sign functions
 
@@ -683,6 +708,17 @@ static inline Vec16f nmul_add(Vec16f const a, Vec16f const b, Vec16f const c) {
     return _mm512_fnmadd_ps(a, b, c);
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec16f if_fma(Vec16fb const f, Vec16f const a, Vec16f const b, Vec16f const c) {
+    return _mm512_mask3_fmadd_ps(a, b, c, f);
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec16f maskz_fma(Vec16fb const f, Vec16f const a, Vec16f const b, Vec16f const c) {
+    return _mm512_maskz_fmadd_ps(f, a, b, c);
+}
+
 // Multiply and subtract with extra precision on the intermediate calculations,
 // Do not use mul_sub_x in general code because it is inaccurate in certain cases when FMA is not supported
 static inline Vec16f mul_sub_x(Vec16f const a, Vec16f const b, Vec16f const c) {
@@ -775,6 +811,11 @@ public:
         zmm = _mm512_load_pd(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec8d & load_nt(double const * p) {
+        zmm = _mm512_castsi512_pd(load_nt_512(p));
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(double * p) const {
         _mm512_storeu_pd(p, zmm);
@@ -1070,6 +1111,26 @@ static inline Vec8d if_div (Vec8db const f, Vec8d const a, Vec8d const b) {
     return _mm512_mask_div_pd(a, (uint8_t)f, a, b);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec8d maskz_add (Vec8db const f, Vec8d const a, Vec8d const b) {
+    return _mm512_maskz_add_pd ((uint8_t)f, a, b);
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec8d maskz_sub (Vec8db const f, Vec8d const a, Vec8d const b) {
+    return _mm512_maskz_sub_pd ((uint8_t)f, a, b);
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec8d maskz_mul (Vec8db const f, Vec8d const a, Vec8d const b) {
+    return _mm512_maskz_mul_pd ((uint8_t)f, a, b);
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec8d maskz_div (Vec8db const f, Vec8d const a, Vec8d const b) {
+    return _mm512_maskz_div_pd ((uint8_t)f, a, b);
+}
+
 // Sign functions
 
 // Function sign_bit: gives true for elements that have the sign bit set
@@ -1370,6 +1431,17 @@ static inline Vec8d nmul_add(Vec8d const a, Vec8d const b, Vec8d const c) {
     return _mm512_fnmadd_pd(a, b, c);
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec8d if_fma(Vec8db const f, Vec8d const a, Vec8d const b, Vec8d const c) {
+    return _mm512_mask3_fmadd_pd(a, b, c, (uint8_t)f);
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec8d maskz_fma(Vec8db const f, Vec8d const a, Vec8d const b, Vec8d const c) {
+    return _mm512_maskz_fmadd_pd((uint8_t)f, a, b, c);
+}
+
 // Multiply and subtract with extra precision on the intermediate calculations. used internally in math functions
 static inline Vec8d mul_sub_x(Vec8d const a, Vec8d const b, Vec8d const c) {
     return _mm512_fmsub_pd(a, b, c);
@@ -1522,7 +1594,7 @@ static inline Vec8d permute8(Vec8d const a) {
 
         if constexpr ((flags & perm_largeblock) != 0) {    // use larger permutation
             constexpr EList<int, 4> L = largeblock_perm<8>(indexs); // permutation pattern
-            constexpr uint8_t  ppat = (L.a[0] & 3) | (L.a[1]<<2 & 0xC) | (L.a[2]<<4 & 0x30) | (L.a[3]<<6 & 0xC0);
+            constexpr uint8_t  ppat = (L.a[0] & 3) | (L.a[1] & 3) << 2 | (L.a[2] & 3) << 4 | (L.a[3] & 3) << 6;
             y = _mm512_shuffle_f64x2(a, a, ppat);
         }
         else if constexpr ((flags & perm_same_pattern) != 0) {  // same pattern in all lanes
@@ -357,6 +357,12 @@ public:
         z1 = Vec8f().load_a(p+8);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec16f & load_nt(float const * p) {
+        z0 = Vec8f().load_nt(p);
+        z1 = Vec8f().load_nt(p+8);
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(float * p) const {
         Vec8f(z0).store(p);
@@ -665,6 +671,26 @@ static inline Vec16f if_div (Vec16fb const f, Vec16f const a, Vec16f const b) {
     return Vec16f(if_div(f.get_low(), a.get_low(), b.get_low()), if_div(f.get_high(), a.get_high(), b.get_high()));
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec16f maskz_add (Vec16fb const f, Vec16f const a, Vec16f const b) {
+    return Vec16f(maskz_add(f.get_low(), a.get_low(), b.get_low()), maskz_add(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec16f maskz_sub (Vec16fb const f, Vec16f const a, Vec16f const b) {
+    return Vec16f(maskz_sub(f.get_low(), a.get_low(), b.get_low()), maskz_sub(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec16f maskz_mul (Vec16fb const f, Vec16f const a, Vec16f const b) {
+    return Vec16f(maskz_mul(f.get_low(), a.get_low(), b.get_low()), maskz_mul(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec16f maskz_div (Vec16fb const f, Vec16f const a, Vec16f const b) {
+    return Vec16f(maskz_div(f.get_low(), a.get_low(), b.get_low()), maskz_div(f.get_high(), a.get_high(), b.get_high()));
+}
+
 // Horizontal add: Calculates the sum of all vector elements.
 static inline float horizontal_add (Vec16f const a) {
     return horizontal_add(a.get_low() + a.get_high());
@@ -712,57 +738,12 @@ inline Vec16f pow<uint32_t>(Vec16f const x0, uint32_t const n) {
     return pow_template_i<Vec16f>(x0, (int)n);
 }
 
-// Raise floating point numbers to integer power n, where n is a compile-time constant
-template <int n>
-static inline Vec16f pow_n(Vec16f const a) {
-    if (n < 0)    return Vec16f(1.0f) / pow_n<-n>(a);
-    if (n == 0)   return Vec16f(1.0f);
-    if (n >= 256) return pow(a, n);
-    Vec16f x = a;                      // a^(2^i)
-    Vec16f y;                          // accumulator
-    const int lowest = n - (n & (n-1));// lowest set bit in n
-    if (n & 1) y = x;
-    if (n < 2) return y;
-    x = x*x;                           // x^2
-    if (n & 2) {
-        if (lowest == 2) y = x; else y *= x;
-    }
-    if (n < 4) return y;
-    x = x*x;                           // x^4
-    if (n & 4) {
-        if (lowest == 4) y = x; else y *= x;
-    }
-    if (n < 8) return y;
-    x = x*x;                           // x^8
-    if (n & 8) {
-        if (lowest == 8) y = x; else y *= x;
-    }
-    if (n < 16) return y;
-    x = x*x;                           // x^16
-    if (n & 16) {
-        if (lowest == 16) y = x; else y *= x;
-    }
-    if (n < 32) return y;
-    x = x*x;                           // x^32
-    if (n & 32) {
-        if (lowest == 32) y = x; else y *= x;
-    }
-    if (n < 64) return y;
-    x = x*x;                           // x^64
-    if (n & 64) {
-        if (lowest == 64) y = x; else y *= x;
-    }
-    if (n < 128) return y;
-    x = x*x;                           // x^128
-    if (n & 128) {
-        if (lowest == 128) y = x; else y *= x;
-    }
-    return y;
-}
-
+// Raise floating point numbers to integer power n, where n is a compile-time constant.
+// Uses the generic pow_n in vectorf128.h with the shortest addition chain
+// implement as function pow(vector, const_int)
 template <int n>
 static inline Vec16f pow(Vec16f const a, Const_int_t<n>) {
-    return pow_n<n>(a);
+    return pow_n<Vec16f, n>(a);
 }
 
 
@@ -840,6 +821,17 @@ static inline Vec16f nmul_add(Vec16f const a, Vec16f const b, Vec16f const c) {
     return Vec16f(nmul_add(a.get_low(), b.get_low(), c.get_low()), nmul_add(a.get_high(), b.get_high(), c.get_high()));
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec16f if_fma(Vec16fb const f, Vec16f const a, Vec16f const b, Vec16f const c) {
+    return Vec16f(if_fma(f.get_low(), a.get_low(), b.get_low(), c.get_low()), if_fma(f.get_high(), a.get_high(), b.get_high(), c.get_high()));
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec16f maskz_fma(Vec16fb const f, Vec16f const a, Vec16f const b, Vec16f const c) {
+    return Vec16f(maskz_fma(f.get_low(), a.get_low(), b.get_low(), c.get_low()), maskz_fma(f.get_high(), a.get_high(), b.get_high(), c.get_high()));
+}
+
 // Multiply and subtract with extra precision on the intermediate calculations,
 // even if FMA instructions not supported, using Veltkamp-Dekker split
 static inline Vec16f mul_sub_x(Vec16f const a, Vec16f const b, Vec16f const c) {
@@ -985,6 +977,12 @@ public:
         z1.load_a(p+4);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec8d & load_nt(double const * p) {
+        z0.load_nt(p);
+        z1.load_nt(p+4);
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(double * p) const {
         z0.store(p);
@@ -1300,6 +1298,26 @@ static inline Vec8d if_div (Vec8db const f, Vec8d const a, Vec8d const b) {
     return Vec8d(if_div(f.get_low(), a.get_low(), b.get_low()), if_div(f.get_high(), a.get_high(), b.get_high()));
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec8d maskz_add (Vec8db const f, Vec8d const a, Vec8d const b) {
+    return Vec8d(maskz_add(f.get_low(), a.get_low(), b.get_low()), maskz_add(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec8d maskz_sub (Vec8db const f, Vec8d const a, Vec8d const b) {
+    return Vec8d(maskz_sub(f.get_low(), a.get_low(), b.get_low()), maskz_sub(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec8d maskz_mul (Vec8db const f, Vec8d const a, Vec8d const b) {
+    return Vec8d(maskz_mul(f.get_low(), a.get_low(), b.get_low()), maskz_mul(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec8d maskz_div (Vec8db const f, Vec8d const a, Vec8d const b) {
+    return Vec8d(maskz_div(f.get_low(), a.get_low(), b.get_low()), maskz_div(f.get_high(), a.get_high(), b.get_high()));
+}
+
 // General arithmetic functions, etc.
 
 // Horizontal add: Calculates the sum of all vector elements.
@@ -1350,57 +1368,12 @@ inline Vec8d pow<uint32_t>(Vec8d const x0, uint32_t const n) {
 }
 
 
-// Raise floating point numbers to integer power n, where n is a compile-time constant
-template <int n>
-static inline Vec8d pow_n(Vec8d const a) {
-    if (n < 0)    return Vec8d(1.0) / pow_n<-n>(a);
-    if (n == 0)   return Vec8d(1.0);
-    if (n >= 256) return pow(a, n);
-    Vec8d x = a;                       // a^(2^i)
-    Vec8d y;                           // accumulator
-    const int lowest = n - (n & (n-1));// lowest set bit in n
-    if (n & 1) y = x;
-    if (n < 2) return y;
-    x = x*x;                           // x^2
-    if (n & 2) {
-        if (lowest == 2) y = x; else y *= x;
-    }
-    if (n < 4) return y;
-    x = x*x;                           // x^4
-    if (n & 4) {
-        if (lowest == 4) y = x; else y *= x;
-    }
-    if (n < 8) return y;
-    x = x*x;                           // x^8
-    if (n & 8) {
-        if (lowest == 8) y = x; else y *= x;
-    }
-    if (n < 16) return y;
-    x = x*x;                           // x^16
-    if (n & 16) {
-        if (lowest == 16) y = x; else y *= x;
-    }
-    if (n < 32) return y;
-    x = x*x;                           // x^32
-    if (n & 32) {
-        if (lowest == 32) y = x; else y *= x;
-    }
-    if (n < 64) return y;
-    x = x*x;                           // x^64
-    if (n & 64) {
-        if (lowest == 64) y = x; else y *= x;
-    }
-    if (n < 128) return y;
-    x = x*x;                           // x^128
-    if (n & 128) {
-        if (lowest == 128) y = x; else y *= x;
-    }
-    return y;
-}
-
+// Raise floating point numbers to integer power n, where n is a compile-time constant.
+// Uses the generic pow_n in vectorf128.h with the shortest addition chain
+// implement as function pow(vector, const_int)
 template <int n>
 static inline Vec8d pow(Vec8d const a, Const_int_t<n>) {
-    return pow_n<n>(a);
+    return pow_n<Vec8d, n>(a);
 }
 
 
@@ -1496,6 +1469,17 @@ static inline Vec8d nmul_add(Vec8d const a, Vec8d const b, Vec8d const c) {
     return Vec8d(nmul_add(a.get_low(), b.get_low(), c.get_low()), nmul_add(a.get_high(), b.get_high(), c.get_high()));
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec8d if_fma(Vec8db const f, Vec8d const a, Vec8d const b, Vec8d const c) {
+    return Vec8d(if_fma(f.get_low(), a.get_low(), b.get_low(), c.get_low()), if_fma(f.get_high(), a.get_high(), b.get_high(), c.get_high()));
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec8d maskz_fma(Vec8db const f, Vec8d const a, Vec8d const b, Vec8d const c) {
+    return Vec8d(maskz_fma(f.get_low(), a.get_low(), b.get_low(), c.get_low()), maskz_fma(f.get_high(), a.get_high(), b.get_high(), c.get_high()));
+}
+
 // Multiply and subtract with extra precision on the intermediate calculations,
 // even if FMA instructions not supported, using Veltkamp-Dekker split
 static inline Vec8d mul_sub_x(Vec8d const a, Vec8d const b, Vec8d const c) {
@@ -109,6 +109,11 @@ public:
         xmm = _mm_load_ph (p);
         return *this;
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec8h & load_nt(void const * p) {
+        xmm = _mm_castsi128_ph(load_nt_128(p));
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(void * p) const {
         _mm_storeu_ph (p, xmm);
@@ -404,6 +409,26 @@ static inline Vec8h if_div(Vec8hb const f, Vec8h const a, Vec8h const b) {
     return _mm_mask_div_ph (a, f, a, b);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec8h maskz_add(Vec8hb const f, Vec8h const a, Vec8h const b) {
+    return _mm_maskz_add_ph (f, a, b);
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec8h maskz_sub(Vec8hb const f, Vec8h const a, Vec8h const b) {
+    return _mm_maskz_sub_ph (f, a, b);
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec8h maskz_mul(Vec8hb const f, Vec8h const a, Vec8h const b) {
+    return _mm_maskz_mul_ph (f, a, b);
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec8h maskz_div(Vec8hb const f, Vec8h const a, Vec8h const b) {
+    return _mm_maskz_div_ph (f, a, b);
+}
+
 // Sign functions
 
 // Function sign_bit: gives true for elements that have the sign bit set
@@ -634,6 +659,17 @@ static inline Vec8h nmul_add(Vec8h const a, Vec8h const b, Vec8h const c) {
     return _mm_fnmadd_ph(a, b, c);
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec8h if_fma(Vec8hb const f, Vec8h const a, Vec8h const b, Vec8h const c) {
+    return _mm_mask3_fmadd_ph(a, b, c, f);
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec8h maskz_fma(Vec8hb const f, Vec8h const a, Vec8h const b, Vec8h const c) {
+    return _mm_maskz_fmadd_ph(f, a, b, c);
+}
+
 // Math functions using fast bit manipulation
 
 // Extract the exponent as an integer
@@ -863,6 +899,11 @@ public:
         ymm = _mm256_load_ph (p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec16h & load_nt(void const * p) {
+        ymm = _mm256_castsi256_ph(load_nt_256(p));
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(void * p) const {
         _mm256_storeu_ph (p, ymm);
@@ -1164,6 +1205,26 @@ static inline Vec16h if_div(Vec16hb const f, Vec16h const a, Vec16h const b) {
     return _mm256_mask_div_ph (a, f, a, b);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec16h maskz_add(Vec16hb const f, Vec16h const a, Vec16h const b) {
+    return _mm256_maskz_add_ph (f, a, b);
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec16h maskz_sub(Vec16hb const f, Vec16h const a, Vec16h const b) {
+    return _mm256_maskz_sub_ph (f, a, b);
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec16h maskz_mul(Vec16hb const f, Vec16h const a, Vec16h const b) {
+    return _mm256_maskz_mul_ph (f, a, b);
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec16h maskz_div(Vec16hb const f, Vec16h const a, Vec16h const b) {
+    return _mm256_maskz_div_ph (f, a, b);
+}
+
 // Sign functions
 
 // Function sign_bit: gives true for elements that have the sign bit set
@@ -1386,6 +1447,17 @@ static inline Vec16h nmul_add(Vec16h const a, Vec16h const b, Vec16h const c) {
     return _mm256_fnmadd_ph(a, b, c);
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec16h if_fma(Vec16hb const f, Vec16h const a, Vec16h const b, Vec16h const c) {
+    return _mm256_mask3_fmadd_ph(a, b, c, f);
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec16h maskz_fma(Vec16hb const f, Vec16h const a, Vec16h const b, Vec16h const c) {
+    return _mm256_maskz_fmadd_ph(f, a, b, c);
+}
+
 // Math functions using fast bit manipulation
 
 // Extract the exponent as an integer
@@ -1619,6 +1691,11 @@ public:
         zmm = _mm512_load_ph (p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec32h & load_nt(void const * p) {
+        zmm = _mm512_castsi512_ph(load_nt_512(p));
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(void * p) const {
         _mm512_storeu_ph (p, zmm);
@@ -1920,6 +1997,26 @@ static inline Vec32h if_div(Vec32hb const f, Vec32h const a, Vec32h const b) {
     return _mm512_mask_div_ph (a, f, a, b);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec32h maskz_add(Vec32hb const f, Vec32h const a, Vec32h const b) {
+    return _mm512_maskz_add_ph (f, a, b);
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec32h maskz_sub(Vec32hb const f, Vec32h const a, Vec32h const b) {
+    return _mm512_maskz_sub_ph (f, a, b);
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec32h maskz_mul(Vec32hb const f, Vec32h const a, Vec32h const b) {
+    return _mm512_maskz_mul_ph (f, a, b);
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec32h maskz_div(Vec32hb const f, Vec32h const a, Vec32h const b) {
+    return _mm512_maskz_div_ph (f, a, b);
+}
+
 // Sign functions
 
 // Function sign_bit: gives true for elements that have the sign bit set
@@ -2140,6 +2237,17 @@ static inline Vec32h nmul_add(Vec32h const a, Vec32h const b, Vec32h const c) {
     return _mm512_fnmadd_ph(a, b, c);
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec32h if_fma(Vec32hb const f, Vec32h const a, Vec32h const b, Vec32h const c) {
+    return _mm512_mask3_fmadd_ph(a, b, c, f);
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec32h maskz_fma(Vec32hb const f, Vec32h const a, Vec32h const b, Vec32h const c) {
+    return _mm512_maskz_fmadd_ph(f, a, b, c);
+}
+
 // Math functions using fast bit manipulation
 
 // Extract the exponent as an integer
@@ -2663,6 +2771,22 @@ static inline Vec32h tanpi(Vec32h const x) {
 #endif  // MAX_VECTOR_SIZE >= 512
 
 
+/*****************************************************************************
+*
+*          vector_traits for the half precision vectors
+*
+*****************************************************************************/
+
+// Used by templates in vector_convert.h, such as first_n_true
+VCL_VECTOR_TRAITS(Vec8h,   Float16,  Vec8s,  Vec8us)
+#if MAX_VECTOR_SIZE >= 256
+VCL_VECTOR_TRAITS(Vec16h,  Float16,  Vec16s, Vec16us)
+#endif
+#if MAX_VECTOR_SIZE >= 512
+VCL_VECTOR_TRAITS(Vec32h,  Float16,  Vec32s, Vec32us)
+#endif
+
+
 #ifdef VCL_NAMESPACE
 }
 #endif
@@ -285,6 +285,11 @@ public:
         xmm = _mm_load_si128 ((const __m128i *)p);
         return *this;
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec8h & load_nt(void const * p) {
+        xmm = load_nt_128(p);
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(void * p) const {
         _mm_storeu_si128 ((__m128i *)p, xmm);
@@ -408,7 +413,7 @@ static Vec8h convert4f_8h (Vec4f x) {
     Vec4i   ee = _mm_srli_epi32(e, 23);                              // exponent at position 0
     Vec4ib  ii = ee == 0xFF;                                         // check for INF and NAN
     Vec4ib  uu = ee < 0x71;                                          // check for exponent underflow
-    __m128i pp = _mm_or_si128(j, _mm_set1_epi32(0x7C00));            // insert exponent if INF or NAN
+    Vec4i   pp = select(Vec4i(e) > 0x7F800000, Vec4i(0x7E00), Vec4i(0x7C00)) | j;  // insert exponent if INF or NAN. Set quiet bit so that NAN stays NAN
     // compute potential subnormal result
     __m128i ss = _mm_add_epi32(e, _mm_set1_epi32(24 << 23));         // add 24 to exponent
     __m128i tt = _mm_cvtps_epi32(_mm_castsi128_ps(ss));              // convert float to int with rounding
@@ -494,7 +499,9 @@ static Vec8h to_float16 (Vec8f x) {
     __m256i ee = _mm256_srli_epi32(e, 23);                           // exponent at position 0
     __m256i ii = _mm256_cmpeq_epi32(ee, _mm256_set1_epi32(0xFF));    // check for INF and NAN
     __m256i uu = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x71), ee);    // check for exponent underflow
-    __m256i pp = _mm256_or_si256(j, _mm256_set1_epi32(0x7C00));      // insert exponent if INF or NAN
+    __m256i nn = _mm256_cmpgt_epi32(e, _mm256_set1_epi32(0x7F800000));// check for NAN
+    __m256i qq = _mm256_blendv_epi8(_mm256_set1_epi32(0x7C00), _mm256_set1_epi32(0x7E00), nn); // set quiet bit so that NAN stays NAN
+    __m256i pp = _mm256_or_si256(j, qq);                             // insert exponent if INF or NAN
     // compute potential subnormal result
     __m256i ss = _mm256_add_epi32(e, _mm256_set1_epi32(24 << 23));   // add 24 to exponent
     __m256i tt = _mm256_cvtps_epi32(_mm256_castsi256_ps(ss));        // convert float to int with rounding
@@ -596,8 +603,8 @@ static Vec8h to_float16 (Vec8f x) {
     Vec4ib ii2 = ee2 == 0xFF;
     Vec4ib uu1 = ee1 < 0x71;                               // exponent underflow
     Vec4ib uu2 = ee2 < 0x71;
-    Vec4i  pp1 = Vec4i(0x7C00) | j1;                       // insert exponent if INF or NAN
-    Vec4i  pp2 = Vec4i(0x7C00) | j2;
+    Vec4i  pp1 = select(Vec4i(e1) > 0x7F800000, Vec4i(0x7E00), Vec4i(0x7C00)) | j1; // insert exponent if INF or NAN. Set quiet bit so that NAN stays NAN
+    Vec4i  pp2 = select(Vec4i(e2) > 0x7F800000, Vec4i(0x7E00), Vec4i(0x7C00)) | j2;
     // compute potential subnormal result
     Vec4ui ss1 = e1 + (24 << 23);                          // add 24 to exponent
     Vec4ui ss2 = e2 + (24 << 23);
@@ -858,6 +865,26 @@ static inline Vec8h if_div(Vec8hb const f, Vec8h const a, Vec8h const b) {
     return select(f, a/b, a);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec8h maskz_add(Vec8hb const f, Vec8h const a, Vec8h const b) {
+    return select(f, a + b, Vec8h(0.0f));
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec8h maskz_sub(Vec8hb const f, Vec8h const a, Vec8h const b) {
+    return select(f, a - b, Vec8h(0.0f));
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec8h maskz_mul(Vec8hb const f, Vec8h const a, Vec8h const b) {
+    return select(f, a * b, Vec8h(0.0f));
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec8h maskz_div(Vec8hb const f, Vec8h const a, Vec8h const b) {
+    return select(f, a / b, Vec8h(0.0f));
+}
+
 // Sign functions
 
 // Function sign_bit: gives true for elements that have the sign bit set
@@ -1076,6 +1103,17 @@ static inline Vec8h nmul_add(Vec8h const a, Vec8h const b, Vec8h const c) {
     return to_float16(nmul_add(to_float(a),to_float(b),to_float(c)));
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec8h if_fma(Vec8hb const f, Vec8h const a, Vec8h const b, Vec8h const c) {
+    return select(f, mul_add(a, b, c), c);
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec8h maskz_fma(Vec8hb const f, Vec8h const a, Vec8h const b, Vec8h const c) {
+    return select(f, mul_add(a, b, c), Vec8h(0.0f));
+}
+
 // Math functions using fast bit manipulation
 
 // Extract the exponent as an integer
@@ -1290,6 +1328,11 @@ public:
         Vec16s::load_a(p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec16h & load_nt(void const * p) {
+        Vec16s::load_nt(p);
+        return *this;
+    }
     // Member function to store into array (unaligned)
     // void store(void * p) const // inherited from Vec16s
 
@@ -1672,6 +1715,26 @@ static inline Vec16h if_div(Vec16hb const f, Vec16h const a, Vec16h const b) {
     return select(f, a/b, a);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec16h maskz_add(Vec16hb const f, Vec16h const a, Vec16h const b) {
+    return select(f, a + b, Vec16h(0.0f));
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec16h maskz_sub(Vec16hb const f, Vec16h const a, Vec16h const b) {
+    return select(f, a - b, Vec16h(0.0f));
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec16h maskz_mul(Vec16hb const f, Vec16h const a, Vec16h const b) {
+    return select(f, a * b, Vec16h(0.0f));
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec16h maskz_div(Vec16hb const f, Vec16h const a, Vec16h const b) {
+    return select(f, a / b, Vec16h(0.0f));
+}
+
 // Sign functions
 
 // Function sign_bit: gives true for elements that have the sign bit set
@@ -1887,6 +1950,17 @@ static inline Vec16h nmul_add(Vec16h const a, Vec16h const b, Vec16h const c) {
     return to_float16(nmul_add(to_float(a),to_float(b),to_float(c)));
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec16h if_fma(Vec16hb const f, Vec16h const a, Vec16h const b, Vec16h const c) {
+    return select(f, mul_add(a, b, c), c);
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec16h maskz_fma(Vec16hb const f, Vec16h const a, Vec16h const b, Vec16h const c) {
+    return select(f, mul_add(a, b, c), Vec16h(0.0f));
+}
+
 // Math functions using fast bit manipulation
 
 // Extract the exponent as an integer
@@ -2099,6 +2173,11 @@ public:
         Vec32s::load_a(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec32h & load_nt(void const * p) {
+        Vec32s::load_nt(p);
+        return *this;
+    }
     // Member function to store into array (unaligned)
     // void store(void * p) const // inherited from Vec32s
 
@@ -2450,6 +2529,26 @@ static inline Vec32h if_div(Vec32hb const f, Vec32h const a, Vec32h const b) {
     return select(f, a/b, a);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec32h maskz_add(Vec32hb const f, Vec32h const a, Vec32h const b) {
+    return select(f, a + b, Vec32h(0.0f));
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec32h maskz_sub(Vec32hb const f, Vec32h const a, Vec32h const b) {
+    return select(f, a - b, Vec32h(0.0f));
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec32h maskz_mul(Vec32hb const f, Vec32h const a, Vec32h const b) {
+    return select(f, a * b, Vec32h(0.0f));
+}
+
+// Conditional divide with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] / b[i]) : 0
+static inline Vec32h maskz_div(Vec32hb const f, Vec32h const a, Vec32h const b) {
+    return select(f, a / b, Vec32h(0.0f));
+}
+
 // Sign functions
 
 // Function sign_bit: gives true for elements that have the sign bit set
@@ -2660,6 +2759,17 @@ static inline Vec32h nmul_add(Vec32h const a, Vec32h const b, Vec32h const c) {
     return Vec32h(nmul_add(a.get_low(), b.get_low(), c.get_low()), nmul_add(a.get_high(), b.get_high(), c.get_high()));
 }
 
+// Conditional multiply and add: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : c[i]
+// This is useful for accumulating a sum of products in c
+static inline Vec32h if_fma(Vec32hb const f, Vec32h const a, Vec32h const b, Vec32h const c) {
+    return select(f, mul_add(a, b, c), c);
+}
+
+// Multiply and add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i] + c[i]) : 0
+static inline Vec32h maskz_fma(Vec32hb const f, Vec32h const a, Vec32h const b, Vec32h const c) {
+    return select(f, mul_add(a, b, c), Vec32h(0.0f));
+}
+
 // Math functions using fast bit manipulation
 
 // Extract the exponent as an integer
@@ -3241,6 +3351,20 @@ static inline Vec32h tanpi(Vec32h const x) {
 
 #endif  // MAX_VECTOR_SIZE >= 512
 
+/*****************************************************************************
+*
+*          vector_traits for the half precision vectors
+*
+*****************************************************************************/
+
+// Used by templates in vector_convert.h, such as first_n_true
+VCL_VECTOR_TRAITS(Vec8h,   Float16,  Vec8s,  Vec8us)
+#if MAX_VECTOR_SIZE >= 512
+VCL_VECTOR_TRAITS(Vec16h,  Float16,  Vec16s, Vec16us)
+VCL_VECTOR_TRAITS(Vec32h,  Float16,  Vec32s, Vec32us)
+#endif
+
+
 #ifdef VCL_NAMESPACE
 }
 #endif
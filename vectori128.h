@@ -773,6 +773,10 @@ public:
     void load_a(void const * p) {
         xmm = _mm_load_si128((__m128i const*)p);
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    void load_nt(void const * p) {
+        xmm = load_nt_128(p);
+    }
     // Member function to store into array (unaligned)
     void store(void * p) const {
         _mm_storeu_si128((__m128i*)p, xmm);
@@ -963,6 +967,11 @@ public:
         xmm = _mm_load_si128((__m128i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec16c & load_nt(void const * p) {
+        xmm = load_nt_128(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec16c & load_partial(int n, void const * p) {
 #if INSTRSET >= 10  // AVX512VL + AVX512BW
@@ -1470,6 +1479,33 @@ static inline Vec16c if_mul(Vec16cb const f, Vec16c const a, Vec16c const b) {
     return select(f, a * b, a);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec16c maskz_add(Vec16cb const f, Vec16c const a, Vec16c const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_add_epi8(f, a, b);
+#else
+    return Vec16c(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec16c maskz_sub(Vec16cb const f, Vec16c const a, Vec16c const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_sub_epi8(f, a, b);
+#else
+    return Vec16c(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec16c maskz_mul(Vec16cb const f, Vec16c const a, Vec16c const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_mov_epi8(f, a * b);
+#else
+    return Vec16c(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int32_t horizontal_add(Vec16c const a) {
     __m128i sum1 = _mm_sad_epu8(a, _mm_setzero_si128());
@@ -1623,6 +1659,11 @@ public:
         xmm = _mm_load_si128((__m128i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec16uc & load_nt(void const * p) {
+        xmm = load_nt_128(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec16uc const insert(int index, uint8_t value) {
         Vec16c::insert(index, (int8_t)value);
@@ -1788,6 +1829,33 @@ static inline Vec16uc if_mul(Vec16cb const f, Vec16uc const a, Vec16uc const b)
     return select(f, a * b, a);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec16uc maskz_add(Vec16cb const f, Vec16uc const a, Vec16uc const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_add_epi8(f, a, b);
+#else
+    return Vec16uc(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec16uc maskz_sub(Vec16cb const f, Vec16uc const a, Vec16uc const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_sub_epi8(f, a, b);
+#else
+    return Vec16uc(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec16uc maskz_mul(Vec16cb const f, Vec16uc const a, Vec16uc const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_mov_epi8(f, a * b);
+#else
+    return Vec16uc(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 // (Note: horizontal_add_x(Vec16uc) is slightly faster)
 static inline uint32_t horizontal_add(Vec16uc const a) {
@@ -1870,6 +1938,11 @@ public:
         xmm = _mm_load_si128((__m128i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec8s & load_nt(void const * p) {
+        xmm = load_nt_128(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec8s & load_partial(int n, void const * p) {
 #if INSTRSET >= 10  // AVX512VL + AVX512BW
@@ -2352,6 +2425,33 @@ static inline Vec8s if_mul(Vec8sb const f, Vec8s const a, Vec8s const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec8s maskz_add(Vec8sb const f, Vec8s const a, Vec8s const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_add_epi16(f, a, b);
+#else
+    return Vec8s(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec8s maskz_sub(Vec8sb const f, Vec8s const a, Vec8s const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_sub_epi16(f, a, b);
+#else
+    return Vec8s(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec8s maskz_mul(Vec8sb const f, Vec8s const a, Vec8s const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_mullo_epi16(f, a, b);
+#else
+    return Vec8s(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int16_t horizontal_add(Vec8s const a) {
 #ifdef __XOP__       // AMD XOP instruction set
@@ -2499,6 +2599,11 @@ public:
         xmm = _mm_load_si128((__m128i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec8us & load_nt(void const * p) {
+        xmm = load_nt_128(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     // Note: This function is inefficient. Use load function if changing more than one element
     Vec8us const insert(int index, uint16_t value) {
@@ -2674,6 +2779,33 @@ static inline Vec8us if_mul(Vec8sb const f, Vec8us const a, Vec8us const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec8us maskz_add(Vec8sb const f, Vec8us const a, Vec8us const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_add_epi16(f, a, b);
+#else
+    return Vec8us(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec8us maskz_sub(Vec8sb const f, Vec8us const a, Vec8us const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_sub_epi16(f, a, b);
+#else
+    return Vec8us(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec8us maskz_mul(Vec8sb const f, Vec8us const a, Vec8us const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_mullo_epi16(f, a, b);
+#else
+    return Vec8us(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements.
 // Overflow will wrap around
 static inline uint32_t horizontal_add(Vec8us const a) {
@@ -2816,6 +2948,11 @@ public:
         xmm = _mm_load_si128((__m128i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec4i & load_nt(void const * p) {
+        xmm = load_nt_128(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec4i & load_partial(int n, void const * p) {
 #if INSTRSET >= 10  // AVX512VL
@@ -3292,6 +3429,33 @@ static inline Vec4i if_mul(Vec4ib const f, Vec4i const a, Vec4i const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec4i maskz_add(Vec4ib const f, Vec4i const a, Vec4i const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_add_epi32(f, a, b);
+#else
+    return Vec4i(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec4i maskz_sub(Vec4ib const f, Vec4i const a, Vec4i const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_sub_epi32(f, a, b);
+#else
+    return Vec4i(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec4i maskz_mul(Vec4ib const f, Vec4i const a, Vec4i const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_mullo_epi32(f, a, b);
+#else
+    return Vec4i(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int32_t horizontal_add(Vec4i const a) {
 #ifdef __XOP__       // AMD XOP instruction set
@@ -3466,6 +3630,11 @@ public:
         xmm = _mm_load_si128((__m128i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec4ui & load_nt(void const * p) {
+        xmm = load_nt_128(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec4ui const insert(int index, uint32_t value) {
         Vec4i::insert(index, (int32_t)value);
@@ -3640,6 +3809,33 @@ static inline Vec4ui if_mul(Vec4ib const f, Vec4ui const a, Vec4ui const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec4ui maskz_add(Vec4ib const f, Vec4ui const a, Vec4ui const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_add_epi32(f, a, b);
+#else
+    return Vec4ui(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec4ui maskz_sub(Vec4ib const f, Vec4ui const a, Vec4ui const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_sub_epi32(f, a, b);
+#else
+    return Vec4ui(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec4ui maskz_mul(Vec4ib const f, Vec4ui const a, Vec4ui const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_mullo_epi32(f, a, b);
+#else
+    return Vec4ui(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint32_t horizontal_add(Vec4ui const a) {
     return (uint32_t)horizontal_add((Vec4i)a);
@@ -3746,6 +3942,11 @@ public:
         xmm = _mm_load_si128((__m128i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec2q & load_nt(void const * p) {
+        xmm = load_nt_128(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec2q & load_partial(int n, void const * p) {
 #if INSTRSET >= 10  // AVX512VL
@@ -4292,6 +4493,33 @@ static inline Vec2q if_mul(Vec2qb const f, Vec2q const a, Vec2q const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec2q maskz_add(Vec2qb const f, Vec2q const a, Vec2q const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_add_epi64(f, a, b);
+#else
+    return Vec2q(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec2q maskz_sub(Vec2qb const f, Vec2q const a, Vec2q const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_sub_epi64(f, a, b);
+#else
+    return Vec2q(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec2q maskz_mul(Vec2qb const f, Vec2q const a, Vec2q const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_mullo_epi64(f, a, b);
+#else
+    return Vec2q(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int64_t horizontal_add(Vec2q const a) {
     __m128i sum1 = _mm_unpackhi_epi64(a, a);               // high element
@@ -4394,6 +4622,11 @@ public:
         xmm = _mm_load_si128((__m128i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 16, with non-temporal hint
+    Vec2uq & load_nt(void const * p) {
+        xmm = load_nt_128(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec2uq const insert(int index, uint64_t value) {
         Vec2q::insert(index, (int64_t)value);
@@ -4576,6 +4809,33 @@ static inline Vec2uq if_mul(Vec2qb const f, Vec2uq const a, Vec2uq const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec2uq maskz_add(Vec2qb const f, Vec2uq const a, Vec2uq const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_add_epi64(f, a, b);
+#else
+    return Vec2uq(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec2uq maskz_sub(Vec2qb const f, Vec2uq const a, Vec2uq const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_sub_epi64(f, a, b);
+#else
+    return Vec2uq(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec2uq maskz_mul(Vec2qb const f, Vec2uq const a, Vec2uq const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm_maskz_mullo_epi64(f, a, b);
+#else
+    return Vec2uq(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint64_t horizontal_add(Vec2uq const a) {
     return (uint64_t)horizontal_add((Vec2q)a);
@@ -6232,6 +6492,12 @@ static inline Vec4ui compress_saturated(Vec2uq const low, Vec2uq const high) {
 * The division of a vector of 16-bit integers is faster than division of a vector
 * of other integer sizes.
 *
+* Vectors of 64-bit integers are divided with Divisor_q and Divisor_uq, or by
+* const_int, const_uint, divide_by_q<d> or divide_by_uq<d>. The instruction set has
+* no 64x64->128 bit multiplication, so the 64-bit method combines four 32x32->64 bit
+* multiplications. This is still much faster than dividing each element separately.
+* The signed division divides the absolute values with the unsigned method.
+*
 *
 * Mathematical formula, used for signed division with fixed or variable divisor:
 * (From T. Granlund and P. L. Montgomery: Division by Invariant Integers Using Multiplication,
@@ -6477,6 +6743,103 @@ public:
 };
 
 
+// Calculate floor((hi * 2^64 + lo) / d) for hi < d. Used for 64-bit division parameters
+constexpr uint64_t divide_u128_u64(uint64_t hi, uint64_t lo, uint64_t d) {
+    uint64_t q = 0;
+    for (int i = 0; i < 64; i++) {                         // long division, one bit at a time
+        bool carry = (hi >> 63) != 0;
+        hi = hi << 1 | lo >> 63;
+        lo <<= 1;
+        q <<= 1;
+        if (carry || hi >= d) {
+            hi -= d;
+            q |= 1;
+        }
+    }
+    return q;
+}
+
+// Multiplier for unsigned 64-bit division by d > 2, with L = ceil(log2(d))
+constexpr uint64_t divisor_uq_multiplier(uint64_t d, int L) {
+    uint64_t L2 = L < 64 ? uint64_t(1) << L : 0;           // 2^L, overflow to 0 if L = 64
+    return 1 + divide_u128_u64(L2 - d, 0, d);              // 1 + 2^64 * (2^L-d) / d
+}
+
+// encapsulate parameters for fast division on vector of 2 64-bit unsigned integers
+class Divisor_uq {
+protected:
+    __m128i multiplier;                                    // multiplier used in fast division
+    __m128i shift1;                                        // shift count 1 used in fast division
+    __m128i shift2;                                        // shift count 2 used in fast division
+public:
+    Divisor_uq() = default;                                // Default constructor
+    Divisor_uq(uint64_t d) {                               // Constructor with divisor
+        set(d);
+    }
+    Divisor_uq(uint64_t m, int s1, int s2) {               // Constructor with precalculated multiplier and shifts
+        multiplier = _mm_set1_epi64x((int64_t)m);
+        shift1 = _mm_setr_epi32(s1, 0, 0, 0);
+        shift2 = _mm_setr_epi32(s2, 0, 0, 0);
+    }
+    void set(uint64_t d) {                                 // Set or change divisor, calculate parameters
+        uint64_t m;
+        uint32_t L, sh1, sh2;
+        switch (d) {
+        case 0:
+            m = sh1 = sh2 = uint32_t(1 / d);               // provoke error for d = 0
+            break;
+        case 1:
+            m = 1; sh1 = sh2 = 0;                          // parameters for d = 1
+            break;
+        case 2:
+            m = 1; sh1 = 1; sh2 = 0;                       // parameters for d = 2
+            break;
+        default:                                           // general case for d > 2
+            L = bit_scan_reverse(d - 1) + 1;               // ceil(log2(d))
+            m = divisor_uq_multiplier(d, L);               // multiplier
+            sh1 = 1;  sh2 = L - 1;                         // shift counts
+        }
+        multiplier = _mm_set1_epi64x((int64_t)m);
+        shift1 = _mm_setr_epi32((int32_t)sh1, 0, 0, 0);
+        shift2 = _mm_setr_epi32((int32_t)sh2, 0, 0, 0);
+    }
+    __m128i getm() const {                                 // get multiplier
+        return multiplier;
+    }
+    __m128i gets1() const {                                // get shift count 1
+        return shift1;
+    }
+    __m128i gets2() const {                                // get shift count 2
+        return shift2;
+    }
+};
+
+// encapsulate parameters for fast division on vector of 2 64-bit signed integers
+class Divisor_q {
+protected:
+    Divisor_uq absd;                                       // parameters for unsigned division by abs(d)
+    __m128i sign;                                          // sign of divisor
+public:
+    Divisor_q() = default;                                 // Default constructor
+    Divisor_q(int64_t d) {                                 // Constructor with divisor
+        set(d);
+    }
+    Divisor_q(uint64_t m, int s1, int s2, int sgn) : absd(m, s1, s2) { // Constructor with precalculated parameters for abs(d) and sign
+        sign = _mm_set1_epi32(sgn);
+    }
+    void set(int64_t d) {                                  // Set or change divisor, calculate parameters
+        absd.set(d < 0 ? 0 - uint64_t(d) : uint64_t(d));   // parameters for abs(d)
+        if (d < 0) sign = _mm_set1_epi32(-1); else sign = _mm_set1_epi32(0);  // sign of divisor
+    }
+    Divisor_uq const & getabs() const {                    // get parameters for abs(d)
+        return absd;
+    }
+    __m128i getsign() const {                              // get sign of divisor
+        return sign;
+    }
+};
+
+
 // vector operator / : divide each element by divisor
 
 // vector of 4 32-bit signed integers
@@ -6608,6 +6971,50 @@ static inline Vec16uc & operator /= (Vec16uc & a, Divisor_us const d) {
     return a;
 }
 
+// high part of 64x64->128 bit unsigned multiplication of each element of a by m
+static inline __m128i mul_hi_epu64(__m128i const a, __m128i const m) {
+    __m128i ah   = _mm_srli_epi64(a, 32);                  // high halves in position for multiplication
+    __m128i mh   = _mm_srli_epi64(m, 32);
+    __m128i ll   = _mm_mul_epu32(a, m);                    // 32x32->64 bit products of the halves
+    __m128i hl   = _mm_mul_epu32(ah, m);
+    __m128i lh   = _mm_mul_epu32(a, mh);
+    __m128i hh   = _mm_mul_epu32(ah, mh);
+    __m128i t    = _mm_add_epi64(hl, _mm_srli_epi64(ll, 32)); // no carry possible
+    __m128i lo32 = _mm_set1_epi64x(0xFFFFFFFF);
+    __m128i mid  = _mm_add_epi64(lh, _mm_and_si128(t, lo32)); // no carry possible
+    __m128i hi   = _mm_add_epi64(hh, _mm_srli_epi64(t, 32));
+    return         _mm_add_epi64(hi, _mm_srli_epi64(mid, 32));
+}
+
+// vector of 2 64-bit unsigned integers
+static inline Vec2uq operator / (Vec2uq const a, Divisor_uq const d) {
+    __m128i t1 = mul_hi_epu64(a, d.getm());                // high part of a * m
+    __m128i t2 = _mm_sub_epi64(a, t1);                     // subtract
+    __m128i t3 = _mm_srl_epi64(t2, d.gets1());             // shift right logical
+    __m128i t4 = _mm_add_epi64(t1, t3);                    // add
+    return       _mm_srl_epi64(t4, d.gets2());             // shift right logical
+}
+
+// vector of 2 64-bit signed integers
+static inline Vec2q operator / (Vec2q const a, Divisor_q const d) {
+    Vec2q sgn = Vec2q(_mm_srai_epi32(_mm_shuffle_epi32(a, 0xF5), 31)); // sign of a
+    Vec2uq q = Vec2uq((a ^ sgn) - sgn) / d.getabs();      // abs(a) / abs(d)
+    sgn ^= Vec2q(d.getsign());                             // sign of result
+    return (Vec2q(q) ^ sgn) - sgn;                         // change sign
+}
+
+// vector operator /= : divide
+static inline Vec2uq & operator /= (Vec2uq & a, Divisor_uq const d) {
+    a = a / d;
+    return a;
+}
+
+// vector operator /= : divide
+static inline Vec2q & operator /= (Vec2q & a, Divisor_q const d) {
+    a = a / d;
+    return a;
+}
+
 /*****************************************************************************
 *
 *          Integer division 2: divisor is a compile-time constant
@@ -6915,6 +7322,104 @@ static inline Vec16uc & operator /= (Vec16uc & a, Const_int_t<d> b) {
 }
 
 
+// Divide Vec2uq by compile-time constant
+template <uint64_t d>
+static inline Vec2uq divide_by_uq(Vec2uq const x) {
+    static_assert(d != 0, "Integer division by zero");     // Error message if dividing by zero
+    if constexpr (d == 1) return x;                        // divide by 1
+    if constexpr ((d & (d - 1)) == 0) {
+        // d is a power of 2. use shift
+        return _mm_srli_epi64(x, bit_scan_reverse_const(d)); // x >> b
+    }
+    else {
+        // general case (d > 2)
+        constexpr int L = bit_scan_reverse_const(d - 1) + 1; // ceil(log2(d))
+        constexpr uint64_t mult = divisor_uq_multiplier(d, L); // multiplier
+        const Divisor_uq div(mult, 1, L - 1);
+        return x / div;
+    }
+}
+
+// Divide Vec2q by compile-time constant
+template <int64_t d>
+static inline Vec2q divide_by_q(Vec2q const x) {
+    static_assert(d != 0, "Integer division by zero");     // Error message if dividing by zero
+    constexpr uint64_t d1 = d > 0 ? uint64_t(d) : 0 - uint64_t(d); // compile-time abs(d)
+    if constexpr (d == 1) return  x;
+    if constexpr (d == -1) return -x;
+    if constexpr (d1 == 0x8000000000000000u) return select(x == Vec2q(int64_t(d1)), Vec2q(1), Vec2q(0)); // prevent overflow when changing sign
+    if constexpr ((d1 & (d1 - 1)) == 0) {
+        // d1 is a power of 2. use shift
+        constexpr int k = bit_scan_reverse_const(d1);
+        Vec2q sign = x >> 63;                              // sign of x
+        Vec2q bias = Vec2q(Vec2uq(sign) >> (64 - k));      // bias = x >= 0 ? 0 : d1-1
+        Vec2q q = (x + bias) >> k;                         // (x + bias) >> k
+        if constexpr (d > 0) return q;                     // d > 0: return  q
+        else return -q;                                    // d < 0: return -q
+    }
+    else {
+        // general case
+        constexpr int L = bit_scan_reverse_const(d1 - 1) + 1; // ceil(log2(d1))
+        constexpr uint64_t mult = divisor_uq_multiplier(d1, L); // multiplier
+        const Divisor_q div(mult, 1, L - 1, d < 0 ? -1 : 0);
+        return x / div;
+    }
+}
+
+// define Vec2q a / const_int(d)
+template <int32_t d>
+static inline Vec2q operator / (Vec2q const a, Const_int_t<d>) {
+    return divide_by_q<d>(a);
+}
+
+// define Vec2q a / const_uint(d)
+template <uint32_t d>
+static inline Vec2q operator / (Vec2q const a, Const_uint_t<d>) {
+    return divide_by_q<int64_t(d)>(a);                     // signed divide
+}
+
+// vector operator /= : divide
+template <int32_t d>
+static inline Vec2q & operator /= (Vec2q & a, Const_int_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// vector operator /= : divide
+template <uint32_t d>
+static inline Vec2q & operator /= (Vec2q & a, Const_uint_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// define Vec2uq a / const_uint(d)
+template <uint32_t d>
+static inline Vec2uq operator / (Vec2uq const a, Const_uint_t<d>) {
+    return divide_by_uq<d>(a);
+}
+
+// define Vec2uq a / const_int(d)
+template <int32_t d>
+static inline Vec2uq operator / (Vec2uq const a, Const_int_t<d>) {
+    static_assert(d >= 0, "Dividing unsigned integer by negative is ambiguous");
+    return divide_by_uq<d>(a);                             // unsigned divide
+}
+
+// vector operator /= : divide
+template <uint32_t d>
+static inline Vec2uq & operator /= (Vec2uq & a, Const_uint_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// vector operator /= : divide
+template <int32_t d>
+static inline Vec2uq & operator /= (Vec2uq & a, Const_int_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+
 /*****************************************************************************
 *
 *          Boolean <-> bitfield conversion functions
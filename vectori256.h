@@ -212,6 +212,11 @@ public:
         ymm = _mm256_load_si256((__m256i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec256b & load_nt(void const * p) {
+        ymm = load_nt_256(p);
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(void * p) const {
         _mm256_storeu_si256((__m256i*)p, ymm);
@@ -376,6 +381,11 @@ public:
         ymm = _mm256_load_si256((__m256i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec32c & load_nt(void const * p) {
+        ymm = load_nt_256(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec32c & load_partial(int n, void const * p) {
 #if INSTRSET >= 10  // AVX512VL
@@ -941,6 +951,33 @@ static inline Vec32c if_mul (Vec32cb const f, Vec32c const a, Vec32c const b) {
     return select(f, a*b, a);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec32c maskz_add (Vec32cb const f, Vec32c const a, Vec32c const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_add_epi8 (f, a, b);
+#else
+    return Vec32c(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec32c maskz_sub (Vec32cb const f, Vec32c const a, Vec32c const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_sub_epi8 (f, a, b);
+#else
+    return Vec32c(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec32c maskz_mul (Vec32cb const f, Vec32c const a, Vec32c const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_mov_epi8 (f, a * b);
+#else
+    return Vec32c(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int8_t horizontal_add (Vec32c const a) {
     __m256i sum1 = _mm256_sad_epu8(a,_mm256_setzero_si256());
@@ -1070,6 +1107,11 @@ public:
         ymm = _mm256_load_si256((__m256i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec32uc & load_nt(void const * p) {
+        ymm = load_nt_256(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec32uc const insert(int index, uint8_t value) {
         Vec32c::insert(index, (int8_t)value);
@@ -1243,6 +1285,33 @@ static inline Vec32uc if_mul (Vec32cb const f, Vec32uc const a, Vec32uc const b)
     return select(f, a*b, a);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec32uc maskz_add (Vec32cb const f, Vec32uc const a, Vec32uc const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_add_epi8 (f, a, b);
+#else
+    return Vec32uc(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec32uc maskz_sub (Vec32cb const f, Vec32uc const a, Vec32uc const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_sub_epi8 (f, a, b);
+#else
+    return Vec32uc(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec32uc maskz_mul (Vec32cb const f, Vec32uc const a, Vec32uc const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_mov_epi8 (f, a * b);
+#else
+    return Vec32uc(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 // (Note: horizontal_add_x(Vec32uc) is slightly faster)
 static inline uint8_t horizontal_add (Vec32uc const a) {
@@ -1337,6 +1406,11 @@ public:
         ymm = _mm256_load_si256((__m256i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec16s & load_nt(void const * p) {
+        ymm = load_nt_256(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec16s & load_partial(int n, void const * p) {
 #if INSTRSET >= 10  // AVX512VL
@@ -1817,6 +1891,33 @@ static inline Vec16s if_mul (Vec16sb const f, Vec16s const a, Vec16s const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec16s maskz_add (Vec16sb const f, Vec16s const a, Vec16s const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_add_epi16 (f, a, b);
+#else
+    return Vec16s(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec16s maskz_sub (Vec16sb const f, Vec16s const a, Vec16s const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_sub_epi16 (f, a, b);
+#else
+    return Vec16s(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec16s maskz_mul (Vec16sb const f, Vec16s const a, Vec16s const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_mullo_epi16 (f, a, b);
+#else
+    return Vec16s(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int16_t horizontal_add (Vec16s const a) {
     // The hadd instruction is inefficient, and may be split into two instructions for faster decoding
@@ -1928,6 +2029,11 @@ public:
         ymm = _mm256_load_si256((__m256i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec16us & load_nt(void const * p) {
+        ymm = load_nt_256(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec16us const insert(int index, uint16_t value) {
         Vec16s::insert(index, (int16_t)value);
@@ -2102,6 +2208,33 @@ static inline Vec16us if_mul (Vec16sb const f, Vec16us const a, Vec16us const b)
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec16us maskz_add (Vec16sb const f, Vec16us const a, Vec16us const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_add_epi16 (f, a, b);
+#else
+    return Vec16us(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec16us maskz_sub (Vec16sb const f, Vec16us const a, Vec16us const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_sub_epi16 (f, a, b);
+#else
+    return Vec16us(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec16us maskz_mul (Vec16sb const f, Vec16us const a, Vec16us const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_mullo_epi16 (f, a, b);
+#else
+    return Vec16us(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint16_t horizontal_add (Vec16us const a) {
     return (uint16_t)horizontal_add(Vec16s(a));
@@ -2190,6 +2323,11 @@ public:
         ymm = _mm256_load_si256((__m256i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec8i & load_nt(void const * p) {
+        ymm = load_nt_256(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec8i & load_partial(int n, void const * p) {
 #if INSTRSET >= 10  // AVX512VL
@@ -2661,6 +2799,33 @@ static inline Vec8i if_mul (Vec8ib const f, Vec8i const a, Vec8i const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec8i maskz_add (Vec8ib const f, Vec8i const a, Vec8i const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_add_epi32 (f, a, b);
+#else
+    return Vec8i(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec8i maskz_sub (Vec8ib const f, Vec8i const a, Vec8i const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_sub_epi32 (f, a, b);
+#else
+    return Vec8i(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec8i maskz_mul (Vec8ib const f, Vec8i const a, Vec8i const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_mullo_epi32 (f, a, b);
+#else
+    return Vec8i(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int32_t horizontal_add (Vec8i const a) {
     // The hadd instruction is inefficient, and may be split into two instructions for faster decoding
@@ -2781,6 +2946,11 @@ public:
         ymm = _mm256_load_si256((__m256i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec8ui & load_nt(void const * p) {
+        ymm = load_nt_256(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec8ui const insert(int index, uint32_t value) {
         Vec8i::insert(index, (int32_t)value);
@@ -2956,6 +3126,33 @@ static inline Vec8ui if_mul (Vec8ib const f, Vec8ui const a, Vec8ui const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec8ui maskz_add (Vec8ib const f, Vec8ui const a, Vec8ui const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_add_epi32 (f, a, b);
+#else
+    return Vec8ui(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec8ui maskz_sub (Vec8ib const f, Vec8ui const a, Vec8ui const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_sub_epi32 (f, a, b);
+#else
+    return Vec8ui(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec8ui maskz_mul (Vec8ib const f, Vec8ui const a, Vec8ui const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_mullo_epi32 (f, a, b);
+#else
+    return Vec8ui(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint32_t horizontal_add (Vec8ui const a) {
     return (uint32_t)horizontal_add((Vec8i)a);
@@ -3046,6 +3243,11 @@ public:
         ymm = _mm256_load_si256((__m256i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec4q & load_nt(void const * p) {
+        ymm = load_nt_256(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec4q & load_partial(int n, void const * p) {
 #if INSTRSET >= 10  // AVX512VL
@@ -3552,6 +3754,33 @@ static inline Vec4q if_mul (Vec4qb const f, Vec4q const a, Vec4q const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec4q maskz_add (Vec4qb const f, Vec4q const a, Vec4q const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_add_epi64 (f, a, b);
+#else
+    return Vec4q(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec4q maskz_sub (Vec4qb const f, Vec4q const a, Vec4q const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_sub_epi64 (f, a, b);
+#else
+    return Vec4q(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec4q maskz_mul (Vec4qb const f, Vec4q const a, Vec4q const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_mullo_epi64 (f, a, b);
+#else
+    return Vec4q(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int64_t horizontal_add (Vec4q const a) {
     __m256i sum1  = _mm256_shuffle_epi32(a,0x0E);                     // high element
@@ -3648,6 +3877,11 @@ public:
         ymm = _mm256_load_si256((__m256i const*)p);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec4uq & load_nt(void const * p) {
+        ymm = load_nt_256(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec4uq const insert(int index, uint64_t value) {
         Vec4q::insert(index, (int64_t)value);
@@ -3815,6 +4049,33 @@ static inline Vec4uq if_mul (Vec4qb const f, Vec4uq const a, Vec4uq const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec4uq maskz_add (Vec4qb const f, Vec4uq const a, Vec4uq const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_add_epi64 (f, a, b);
+#else
+    return Vec4uq(f) & (a + b);
+#endif
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec4uq maskz_sub (Vec4qb const f, Vec4uq const a, Vec4uq const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_sub_epi64 (f, a, b);
+#else
+    return Vec4uq(f) & (a - b);
+#endif
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec4uq maskz_mul (Vec4qb const f, Vec4uq const a, Vec4uq const b) {
+#if INSTRSET >= 10  // compact boolean vectors
+    return _mm256_maskz_mullo_epi64 (f, a, b);
+#else
+    return Vec4uq(f) & (a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint64_t horizontal_add (Vec4uq const a) {
     return (uint64_t)horizontal_add((Vec4q)a);
@@ -5510,6 +5771,51 @@ static inline Vec32uc & operator /= (Vec32uc & a, Divisor_us const d) {
     return a;
 }
 
+// high part of 64x64->128 bit unsigned multiplication of each element of a by m
+static inline __m256i mul_hi_epu64(__m256i const a, __m256i const m) {
+    __m256i ah   = _mm256_srli_epi64(a, 32);               // high halves in position for multiplication
+    __m256i mh   = _mm256_srli_epi64(m, 32);
+    __m256i ll   = _mm256_mul_epu32(a, m);                 // 32x32->64 bit products of the halves
+    __m256i hl   = _mm256_mul_epu32(ah, m);
+    __m256i lh   = _mm256_mul_epu32(a, mh);
+    __m256i hh   = _mm256_mul_epu32(ah, mh);
+    __m256i t    = _mm256_add_epi64(hl, _mm256_srli_epi64(ll, 32)); // no carry possible
+    __m256i lo32 = _mm256_set1_epi64x(0xFFFFFFFF);
+    __m256i mid  = _mm256_add_epi64(lh, _mm256_and_si256(t, lo32)); // no carry possible
+    __m256i hi   = _mm256_add_epi64(hh, _mm256_srli_epi64(t, 32));
+    return         _mm256_add_epi64(hi, _mm256_srli_epi64(mid, 32));
+}
+
+// vector of 4 64-bit unsigned integers
+static inline Vec4uq operator / (Vec4uq const a, Divisor_uq const d) {
+    __m256i m  = _mm256_broadcastq_epi64(d.getm());        // broadcast multiplier
+    __m256i t1 = mul_hi_epu64(a, m);                       // high part of a * m
+    __m256i t2 = _mm256_sub_epi64(a, t1);                  // subtract
+    __m256i t3 = _mm256_srl_epi64(t2, d.gets1());          // shift right logical
+    __m256i t4 = _mm256_add_epi64(t1, t3);                 // add
+    return       _mm256_srl_epi64(t4, d.gets2());          // shift right logical
+}
+
+// vector of 4 64-bit signed integers
+static inline Vec4q operator / (Vec4q const a, Divisor_q const d) {
+    Vec4q sgn = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a); // sign of a
+    Vec4uq q = Vec4uq((a ^ sgn) - sgn) / d.getabs();       // abs(a) / abs(d)
+    sgn ^= Vec4q(_mm256_broadcastq_epi64(d.getsign()));    // sign of result
+    return (Vec4q(q) ^ sgn) - sgn;                         // change sign
+}
+
+// vector operator /= : divide
+static inline Vec4uq & operator /= (Vec4uq & a, Divisor_uq const d) {
+    a = a / d;
+    return a;
+}
+
+// vector operator /= : divide
+static inline Vec4q & operator /= (Vec4q & a, Divisor_q const d) {
+    a = a / d;
+    return a;
+}
+
 
 /*****************************************************************************
 *
@@ -5810,6 +6116,104 @@ static inline Vec32uc & operator /= (Vec32uc & a, Const_int_t<d> b) {
 }
 
 
+// Divide Vec4uq by compile-time constant
+template <uint64_t d>
+static inline Vec4uq divide_by_uq(Vec4uq const x) {
+    static_assert(d != 0, "Integer division by zero");
+    if constexpr (d == 1) return x;                        // divide by 1
+    if constexpr ((d & (d - 1)) == 0) {
+        // d is a power of 2. use shift
+        return _mm256_srli_epi64(x, bit_scan_reverse_const(d)); // x >> b
+    }
+    else {
+        // general case (d > 2)
+        constexpr int L = bit_scan_reverse_const(d - 1) + 1; // ceil(log2(d))
+        constexpr uint64_t mult = divisor_uq_multiplier(d, L); // multiplier
+        const Divisor_uq div(mult, 1, L - 1);
+        return x / div;
+    }
+}
+
+// Divide Vec4q by compile-time constant
+template <int64_t d>
+static inline Vec4q divide_by_q(Vec4q const x) {
+    static_assert(d != 0, "Integer division by zero");
+    constexpr uint64_t d1 = d > 0 ? uint64_t(d) : 0 - uint64_t(d); // compile-time abs(d)
+    if constexpr (d == 1) return  x;
+    if constexpr (d == -1) return -x;
+    if constexpr (d1 == 0x8000000000000000u) return select(x == Vec4q(int64_t(d1)), Vec4q(1), Vec4q(0)); // prevent overflow when changing sign
+    if constexpr ((d1 & (d1 - 1)) == 0) {
+        // d1 is a power of 2. use shift
+        constexpr int k = bit_scan_reverse_const(d1);
+        Vec4q sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x); // sign of x
+        Vec4q bias = _mm256_srli_epi64(sign, 64 - k);      // bias = x >= 0 ? 0 : d1-1
+        Vec4q q = (x + bias) >> k;                         // (x + bias) >> k
+        if constexpr (d > 0) return q;                     // d > 0: return  q
+        else return -q;                                    // d < 0: return -q
+    }
+    else {
+        // general case
+        constexpr int L = bit_scan_reverse_const(d1 - 1) + 1; // ceil(log2(d1))
+        constexpr uint64_t mult = divisor_uq_multiplier(d1, L); // multiplier
+        const Divisor_q div(mult, 1, L - 1, d < 0 ? -1 : 0);
+        return x / div;
+    }
+}
+
+// define Vec4q a / const_int(d)
+template <int32_t d>
+static inline Vec4q operator / (Vec4q const a, Const_int_t<d>) {
+    return divide_by_q<d>(a);
+}
+
+// define Vec4q a / const_uint(d)
+template <uint32_t d>
+static inline Vec4q operator / (Vec4q const a, Const_uint_t<d>) {
+    return divide_by_q<int64_t(d)>(a);                     // signed divide
+}
+
+// vector operator /= : divide
+template <int32_t d>
+static inline Vec4q & operator /= (Vec4q & a, Const_int_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// vector operator /= : divide
+template <uint32_t d>
+static inline Vec4q & operator /= (Vec4q & a, Const_uint_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// define Vec4uq a / const_uint(d)
+template <uint32_t d>
+static inline Vec4uq operator / (Vec4uq const a, Const_uint_t<d>) {
+    return divide_by_uq<d>(a);
+}
+
+// define Vec4uq a / const_int(d)
+template <int32_t d>
+static inline Vec4uq operator / (Vec4uq const a, Const_int_t<d>) {
+    static_assert(d >= 0, "Dividing unsigned integer by negative is ambiguous");
+    return divide_by_uq<d>(a);                             // unsigned divide
+}
+
+// vector operator /= : divide
+template <uint32_t d>
+static inline Vec4uq & operator /= (Vec4uq & a, Const_uint_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// vector operator /= : divide
+template <int32_t d>
+static inline Vec4uq & operator /= (Vec4uq & a, Const_int_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+
 /*****************************************************************************
 *
 *          Boolean <-> bitfield conversion functions
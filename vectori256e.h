@@ -88,6 +88,12 @@ public:
         y1 = _mm_load_si128((__m128i const*)p + 1);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec256b & load_nt(void const * p) {
+        y0 = load_nt_128(p);
+        y1 = load_nt_128((__m128i const*)p + 1);
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(void * p) const {
         _mm_storeu_si128((__m128i*)p,     y0);
@@ -250,6 +256,12 @@ public:
         y1 = _mm_load_si128((__m128i const*)p + 1);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec32c & load_nt(void const * p) {
+        y0 = load_nt_128(p);
+        y1 = load_nt_128((__m128i const*)p + 1);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec32c & load_partial(int n, void const * p) {
         if (n <= 0) {
@@ -670,6 +682,21 @@ static inline Vec32c if_mul (Vec32cb const f, Vec32c const a, Vec32c const b) {
     return select(f, a*b, a);
 }
 
+// Conditional add with zeroing
+static inline Vec32c maskz_add (Vec32cb const f, Vec32c const a, Vec32c const b) {
+    return Vec32c(f) & (a + b);
+}
+
+// Conditional subtract with zeroing
+static inline Vec32c maskz_sub (Vec32cb const f, Vec32c const a, Vec32c const b) {
+    return Vec32c(f) & (a - b);
+}
+
+// Conditional multiply with zeroing
+static inline Vec32c maskz_mul (Vec32cb const f, Vec32c const a, Vec32c const b) {
+    return Vec32c(f) & (a * b);
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint8_t horizontal_add (Vec32c const a) {
     return (uint8_t)horizontal_add(a.get_low() + a.get_high());
@@ -765,6 +792,12 @@ public:
         y1 = _mm_load_si128((__m128i const*)p + 1);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec32uc & load_nt(void const * p) {
+        y0 = load_nt_128(p);
+        y1 = load_nt_128((__m128i const*)p + 1);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec32uc const insert(int index, uint8_t value) {
         Vec32c::insert(index, (int8_t)value);
@@ -916,6 +949,21 @@ static inline Vec32uc if_mul (Vec32cb const f, Vec32uc const a, Vec32uc const b)
     return select(f, a*b, a);
 }
 
+// Conditional add with zeroing
+static inline Vec32uc maskz_add (Vec32cb const f, Vec32uc const a, Vec32uc const b) {
+    return Vec32uc(f) & (a + b);
+}
+
+// Conditional subtract with zeroing
+static inline Vec32uc maskz_sub (Vec32cb const f, Vec32uc const a, Vec32uc const b) {
+    return Vec32uc(f) & (a - b);
+}
+
+// Conditional multiply with zeroing
+static inline Vec32uc maskz_mul (Vec32cb const f, Vec32uc const a, Vec32uc const b) {
+    return Vec32uc(f) & (a * b);
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 // (Note: horizontal_add_x(Vec32uc) is slightly faster)
 static inline uint32_t horizontal_add (Vec32uc const a) {
@@ -994,6 +1042,12 @@ public:
         y1 = _mm_load_si128((__m128i const*)p + 1);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec16s & load_nt(void const * p) {
+        y0 = load_nt_128(p);
+        y1 = load_nt_128((__m128i const*)p + 1);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec16s & load_partial(int n, void const * p) {
         if (n <= 0) {
@@ -1409,6 +1463,21 @@ static inline Vec16s if_mul (Vec16sb const f, Vec16s const a, Vec16s const b) {
     return select(f, a*b, a);
 }
 
+// Conditional add with zeroing
+static inline Vec16s maskz_add (Vec16sb const f, Vec16s const a, Vec16s const b) {
+    return Vec16s(f) & (a + b);
+}
+
+// Conditional subtract with zeroing
+static inline Vec16s maskz_sub (Vec16sb const f, Vec16s const a, Vec16s const b) {
+    return Vec16s(f) & (a - b);
+}
+
+// Conditional multiply with zeroing
+static inline Vec16s maskz_mul (Vec16sb const f, Vec16s const a, Vec16s const b) {
+    return Vec16s(f) & (a * b);
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int16_t horizontal_add (Vec16s const a) {
     return horizontal_add(a.get_low() + a.get_high());
@@ -1502,6 +1571,12 @@ public:
         y1 = _mm_load_si128((__m128i const*)p + 1);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec16us & load_nt(void const * p) {
+        y0 = load_nt_128(p);
+        y1 = load_nt_128((__m128i const*)p + 1);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec16us const insert(int index, uint16_t value) {
         Vec16s::insert(index, (int16_t)value);
@@ -1654,6 +1729,21 @@ static inline Vec16us if_mul (Vec16sb const f, Vec16us const a, Vec16us const b)
     return select(f, a*b, a);
 }
 
+// Conditional add with zeroing
+static inline Vec16us maskz_add (Vec16sb const f, Vec16us const a, Vec16us const b) {
+    return Vec16us(f) & (a + b);
+}
+
+// Conditional subtract with zeroing
+static inline Vec16us maskz_sub (Vec16sb const f, Vec16us const a, Vec16us const b) {
+    return Vec16us(f) & (a - b);
+}
+
+// Conditional multiply with zeroing
+static inline Vec16us maskz_mul (Vec16sb const f, Vec16us const a, Vec16us const b) {
+    return Vec16us(f) & (a * b);
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint32_t horizontal_add (Vec16us const a) {
     return horizontal_add(a.get_low() + a.get_high());
@@ -1730,6 +1820,12 @@ public:
         y1 = _mm_load_si128((__m128i const*)p + 1);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec8i & load_nt(void const * p) {
+        y0 = load_nt_128(p);
+        y1 = load_nt_128((__m128i const*)p + 1);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec8i & load_partial(int n, void const * p) {
         if (n <= 0) {
@@ -2146,6 +2242,21 @@ static inline Vec8i if_mul (Vec8ib const f, Vec8i const a, Vec8i const b) {
     return select(f, a*b, a);
 }
 
+// Conditional add with zeroing
+static inline Vec8i maskz_add (Vec8ib const f, Vec8i const a, Vec8i const b) {
+    return Vec8i(f) & (a + b);
+}
+
+// Conditional subtract with zeroing
+static inline Vec8i maskz_sub (Vec8ib const f, Vec8i const a, Vec8i const b) {
+    return Vec8i(f) & (a - b);
+}
+
+// Conditional multiply with zeroing
+static inline Vec8i maskz_mul (Vec8ib const f, Vec8i const a, Vec8i const b) {
+    return Vec8i(f) & (a * b);
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int32_t horizontal_add (Vec8i const a) {
     return horizontal_add(a.get_low() + a.get_high());
@@ -2238,6 +2349,12 @@ public:
         y1 = _mm_load_si128((__m128i const*)p + 1);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec8ui & load_nt(void const * p) {
+        y0 = load_nt_128(p);
+        y1 = load_nt_128((__m128i const*)p + 1);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec8ui const insert(int index, uint32_t value) {
         Vec8i::insert(index, (int32_t)value);
@@ -2395,6 +2512,21 @@ static inline Vec8ui if_mul (Vec8ib const f, Vec8ui const a, Vec8ui const b) {
     return select(f, a*b, a);
 }
 
+// Conditional add with zeroing
+static inline Vec8ui maskz_add (Vec8ib const f, Vec8ui const a, Vec8ui const b) {
+    return Vec8ui(f) & (a + b);
+}
+
+// Conditional subtract with zeroing
+static inline Vec8ui maskz_sub (Vec8ib const f, Vec8ui const a, Vec8ui const b) {
+    return Vec8ui(f) & (a - b);
+}
+
+// Conditional multiply with zeroing
+static inline Vec8ui maskz_mul (Vec8ib const f, Vec8ui const a, Vec8ui const b) {
+    return Vec8ui(f) & (a * b);
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint32_t horizontal_add (Vec8ui const a) {
     return (uint32_t)horizontal_add((Vec8i)a);
@@ -2471,6 +2603,12 @@ public:
         y1 = _mm_load_si128((__m128i const*)p + 1);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec4q & load_nt(void const * p) {
+        y0 = load_nt_128(p);
+        y1 = load_nt_128((__m128i const*)p + 1);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec4q & load_partial(int n, void const * p) {
         if (n <= 0) {
@@ -2755,6 +2893,17 @@ static inline Vec4q & operator *= (Vec4q & a, Vec4q const b) {
     return a;
 }
 
+// vector operator / : divide all elements by same integer
+static inline Vec4q operator / (Vec4q const a, Divisor_q const d) {
+    return Vec4q(a.get_low() / d, a.get_high() / d);
+}
+
+// vector operator /= : divide
+static inline Vec4q & operator /= (Vec4q & a, Divisor_q const d) {
+    a = a / d;
+    return a;
+}
+
 // vector operator << : shift left
 static inline Vec4q operator << (Vec4q const a, int32_t b) {
     return Vec4q(a.get_low() << b, a.get_high() << b);
@@ -2878,6 +3027,21 @@ static inline Vec4q if_mul (Vec4qb const f, Vec4q const a, Vec4q const b) {
     return select(f, a*b, a);
 }
 
+// Conditional add with zeroing
+static inline Vec4q maskz_add (Vec4qb const f, Vec4q const a, Vec4q const b) {
+    return Vec4q(f) & (a + b);
+}
+
+// Conditional subtract with zeroing
+static inline Vec4q maskz_sub (Vec4qb const f, Vec4q const a, Vec4q const b) {
+    return Vec4q(f) & (a - b);
+}
+
+// Conditional multiply with zeroing
+static inline Vec4q maskz_mul (Vec4qb const f, Vec4q const a, Vec4q const b) {
+    return Vec4q(f) & (a * b);
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int64_t horizontal_add (Vec4q const a) {
     return horizontal_add(a.get_low() + a.get_high());
@@ -2954,6 +3118,12 @@ public:
         y1 = _mm_load_si128((__m128i const*)p + 1);
         return *this;
     }
+    // Member function to load from array, aligned by 32, with non-temporal hint
+    Vec4uq & load_nt(void const * p) {
+        y0 = load_nt_128(p);
+        y1 = load_nt_128((__m128i const*)p + 1);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec4uq const insert(int index, uint64_t value) {
         Vec4q::insert(index, (int64_t)value);
@@ -2997,6 +3167,17 @@ static inline Vec4uq operator * (Vec4uq const a, Vec4uq const b) {
     return Vec4uq (Vec4q(a) * Vec4q(b));
 }
 
+// vector operator / : divide all elements by same integer
+static inline Vec4uq operator / (Vec4uq const a, Divisor_uq const d) {
+    return Vec4uq(a.get_low() / d, a.get_high() / d);
+}
+
+// vector operator /= : divide
+static inline Vec4uq & operator /= (Vec4uq & a, Divisor_uq const d) {
+    a = a / d;
+    return a;
+}
+
 // vector operator >> : shift right logical all elements
 static inline Vec4uq operator >> (Vec4uq const a, uint32_t b) {
     return Vec4uq(a.get_low() >> b, a.get_high() >> b);
@@ -3094,6 +3275,21 @@ static inline Vec4uq if_mul (Vec4qb const f, Vec4uq const a, Vec4uq const b) {
     return select(f, a*b, a);
 }
 
+// Conditional add with zeroing
+static inline Vec4uq maskz_add (Vec4qb const f, Vec4uq const a, Vec4uq const b) {
+    return Vec4uq(f) & (a + b);
+}
+
+// Conditional subtract with zeroing
+static inline Vec4uq maskz_sub (Vec4qb const f, Vec4uq const a, Vec4uq const b) {
+    return Vec4uq(f) & (a - b);
+}
+
+// Conditional multiply with zeroing
+static inline Vec4uq maskz_mul (Vec4qb const f, Vec4uq const a, Vec4uq const b) {
+    return Vec4uq(f) & (a * b);
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint64_t horizontal_add (Vec4uq const a) {
     return (uint64_t)horizontal_add((Vec4q)a);
@@ -3960,6 +4156,71 @@ static inline Vec32uc & operator /= (Vec32uc & a, Const_int_t<d> b) {
     return a;
 }
 
+// Divide Vec4q by compile-time constant
+template <int64_t d>
+static inline Vec4q divide_by_q(Vec4q const a) {
+    return Vec4q(divide_by_q<d>(a.get_low()), divide_by_q<d>(a.get_high()));
+}
+
+// define Vec4q a / const_int(d)
+template <int32_t d>
+static inline Vec4q operator / (Vec4q const a, Const_int_t<d>) {
+    return divide_by_q<d>(a);
+}
+
+// define Vec4q a / const_uint(d)
+template <uint32_t d>
+static inline Vec4q operator / (Vec4q const a, Const_uint_t<d>) {
+    return divide_by_q<int64_t(d)>(a);                               // signed divide
+}
+
+// vector operator /= : divide
+template <int32_t d>
+static inline Vec4q & operator /= (Vec4q & a, Const_int_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// vector operator /= : divide
+template <uint32_t d>
+static inline Vec4q & operator /= (Vec4q & a, Const_uint_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// Divide Vec4uq by compile-time constant
+template <uint64_t d>
+static inline Vec4uq divide_by_uq(Vec4uq const a) {
+    return Vec4uq(divide_by_uq<d>(a.get_low()), divide_by_uq<d>(a.get_high()));
+}
+
+// define Vec4uq a / const_uint(d)
+template <uint32_t d>
+static inline Vec4uq operator / (Vec4uq const a, Const_uint_t<d>) {
+    return divide_by_uq<d>(a);
+}
+
+// define Vec4uq a / const_int(d)
+template <int32_t d>
+static inline Vec4uq operator / (Vec4uq const a, Const_int_t<d>) {
+    static_assert(d >= 0, "Dividing unsigned integer by negative is ambiguous");
+    return divide_by_uq<d>(a);                                       // unsigned divide
+}
+
+// vector operator /= : divide
+template <uint32_t d>
+static inline Vec4uq & operator /= (Vec4uq & a, Const_uint_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// vector operator /= : divide
+template <int32_t d>
+static inline Vec4uq & operator /= (Vec4uq & a, Const_int_t<d> b) {
+    a = a / b;
+    return a;
+}
+
 /*****************************************************************************
 *
 *          Boolean <-> bitfield conversion functions
@@ -115,6 +115,11 @@ public:
         zmm = _mm512_load_si512(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec512b & load_nt(void const * p) {
+        zmm = load_nt_512(p);
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(void * p) const {
         _mm512_storeu_si512(p, zmm);
@@ -246,6 +251,11 @@ public:
         zmm = _mm512_load_si512(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec16i & load_nt(void const * p) {
+        zmm = load_nt_512(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec16i & load_partial(int n, void const * p) {
         zmm = _mm512_maskz_loadu_epi32(__mmask16((1u << n) - 1), p);
@@ -464,6 +474,21 @@ static inline Vec16i if_mul (Vec16ib const f, Vec16i const a, Vec16i const b) {
     return _mm512_mask_mullo_epi32(a, f, a, b);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec16i maskz_add (Vec16ib const f, Vec16i const a, Vec16i const b) {
+    return _mm512_maskz_add_epi32(f, a, b);
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec16i maskz_sub (Vec16ib const f, Vec16i const a, Vec16i const b) {
+    return _mm512_maskz_sub_epi32(f, a, b);
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec16i maskz_mul (Vec16ib const f, Vec16i const a, Vec16i const b) {
+    return _mm512_maskz_mullo_epi32(f, a, b);
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int32_t horizontal_add (Vec16i const a) {
 #if defined(__INTEL_COMPILER)
@@ -572,6 +597,11 @@ public:
         Vec16i::load_a(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec16ui & load_nt(void const * p) {
+        Vec16i::load_nt(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec16ui const insert(int index, uint32_t value) {
         Vec16i::insert(index, (int32_t)value);
@@ -711,6 +741,21 @@ static inline Vec16ui if_mul (Vec16ib const f, Vec16ui const a, Vec16ui const b)
     return Vec16ui(if_mul(f, Vec16i(a), Vec16i(b)));
 }
 
+// Conditional add with zeroing
+static inline Vec16ui maskz_add (Vec16ib const f, Vec16ui const a, Vec16ui const b) {
+    return Vec16ui(maskz_add(f, Vec16i(a), Vec16i(b)));
+}
+
+// Conditional subtract with zeroing
+static inline Vec16ui maskz_sub (Vec16ib const f, Vec16ui const a, Vec16ui const b) {
+    return Vec16ui(maskz_sub(f, Vec16i(a), Vec16i(b)));
+}
+
+// Conditional multiply with zeroing
+static inline Vec16ui maskz_mul (Vec16ib const f, Vec16ui const a, Vec16ui const b) {
+    return Vec16ui(maskz_mul(f, Vec16i(a), Vec16i(b)));
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint32_t horizontal_add (Vec16ui const a) {
     return (uint32_t)horizontal_add((Vec16i)a);
@@ -787,6 +832,11 @@ public:
         zmm = _mm512_load_si512(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec8q & load_nt(void const * p) {
+        zmm = load_nt_512(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec8q & load_partial(int n, void const * p) {
         zmm = _mm512_maskz_loadu_epi64(__mmask16((1 << n) - 1), p);
@@ -1028,6 +1078,25 @@ static inline Vec8q if_mul (Vec8qb const f, Vec8q const a, Vec8q const b) {
 #endif
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec8q maskz_add (Vec8qb const f, Vec8q const a, Vec8q const b) {
+    return _mm512_maskz_add_epi64((uint8_t)f, a, b);
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec8q maskz_sub (Vec8qb const f, Vec8q const a, Vec8q const b) {
+    return _mm512_maskz_sub_epi64((uint8_t)f, a, b);
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec8q maskz_mul (Vec8qb const f, Vec8q const a, Vec8q const b) {
+#if INSTRSET >= 10
+    return _mm512_maskz_mullo_epi64((uint8_t)f, a, b);  // AVX512DQ
+#else
+    return _mm512_maskz_mov_epi64((uint8_t)f, a * b);
+#endif
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int64_t horizontal_add (Vec8q const a) {
 #if defined(__INTEL_COMPILER)
@@ -1130,6 +1199,11 @@ public:
         Vec8q::load_a(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec8uq & load_nt(void const * p) {
+        Vec8q::load_nt(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec8uq const insert(int index, uint64_t value) {
         Vec8q::insert(index, (int64_t)value);
@@ -1262,6 +1336,21 @@ static inline Vec8uq if_mul (Vec8qb const f, Vec8uq const a, Vec8uq const b) {
 #endif
 }
 
+// Conditional add with zeroing
+static inline Vec8uq maskz_add (Vec8qb const f, Vec8uq const a, Vec8uq const b) {
+    return Vec8uq(maskz_add(f, Vec8q(a), Vec8q(b)));
+}
+
+// Conditional subtract with zeroing
+static inline Vec8uq maskz_sub (Vec8qb const f, Vec8uq const a, Vec8uq const b) {
+    return Vec8uq(maskz_sub(f, Vec8q(a), Vec8q(b)));
+}
+
+// Conditional multiply with zeroing
+static inline Vec8uq maskz_mul (Vec8qb const f, Vec8uq const a, Vec8uq const b) {
+    return Vec8uq(maskz_mul(f, Vec8q(a), Vec8q(b)));
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint64_t horizontal_add (Vec8uq const a) {
     return (uint64_t)horizontal_add(Vec8q(a));
@@ -1306,7 +1395,7 @@ static inline Vec8q permute8(Vec8q const a) {
 
         if constexpr ((flags & perm_largeblock) != 0) {    // use larger permutation
             constexpr EList<int, 4> L = largeblock_perm<8>(indexs); // permutation pattern
-            constexpr uint8_t  ppat = (L.a[0] & 3) | (L.a[1]<<2 & 0xC) | (L.a[2]<<4 & 0x30) | (L.a[3]<<6 & 0xC0);
+            constexpr uint8_t  ppat = (L.a[0] & 3) | (L.a[1] & 3) << 2 | (L.a[2] & 3) << 4 | (L.a[3] & 3) << 6;
             y = _mm512_shuffle_i64x2(a, a, ppat);
         }
         else if constexpr ((flags & perm_same_pattern) != 0) {  // same pattern in all lanes
@@ -2026,6 +2115,52 @@ static inline Vec16ui & operator /= (Vec16ui & a, Divisor_ui const d) {
     return a;
 }
 
+// high part of 64x64->128 bit unsigned multiplication of each element of a by m
+static inline __m512i mul_hi_epu64(__m512i const a, __m512i const m) {
+    __m512i ah   = _mm512_srli_epi64(a, 32);               // high halves in position for multiplication
+    __m512i mh   = _mm512_srli_epi64(m, 32);
+    __m512i ll   = _mm512_mul_epu32(a, m);                 // 32x32->64 bit products of the halves
+    __m512i hl   = _mm512_mul_epu32(ah, m);
+    __m512i lh   = _mm512_mul_epu32(a, mh);
+    __m512i hh   = _mm512_mul_epu32(ah, mh);
+    __m512i t    = _mm512_add_epi64(hl, _mm512_srli_epi64(ll, 32)); // no carry possible
+    __m512i lo32 = _mm512_set1_epi64(0xFFFFFFFF);
+    __m512i mid  = _mm512_add_epi64(lh, _mm512_and_si512(t, lo32)); // no carry possible
+    __m512i hi   = _mm512_add_epi64(hh, _mm512_srli_epi64(t, 32));
+    return         _mm512_add_epi64(hi, _mm512_srli_epi64(mid, 32));
+}
+
+// vector of 8 64-bit unsigned integers
+static inline Vec8uq operator / (Vec8uq const a, Divisor_uq const d) {
+    __m512i m  = _mm512_broadcast_i32x4(d.getm());         // broadcast multiplier
+    __m512i t1 = mul_hi_epu64(a, m);                       // high part of a * m
+    __m512i t2 = _mm512_sub_epi64(a, t1);                  // subtract
+    __m512i t3 = _mm512_srl_epi64(t2, d.gets1());          // shift right logical
+    __m512i t4 = _mm512_add_epi64(t1, t3);                 // add
+    return       _mm512_srl_epi64(t4, d.gets2());          // shift right logical
+}
+
+// vector of 8 64-bit signed integers
+static inline Vec8q operator / (Vec8q const a, Divisor_q const d) {
+    __m512i sgn = _mm512_srai_epi64(a, 63);                // sign of a
+    __m512i aa  = _mm512_sub_epi64(_mm512_xor_si512(a, sgn), sgn); // abs(a)
+    __m512i q   = Vec8uq(aa) / d.getabs();                 // abs(a) / abs(d)
+    sgn = _mm512_xor_si512(sgn, _mm512_broadcast_i32x4(d.getsign())); // sign of result
+    return _mm512_sub_epi64(_mm512_xor_si512(q, sgn), sgn);// change sign
+}
+
+// vector operator /= : divide
+static inline Vec8uq & operator /= (Vec8uq & a, Divisor_uq const d) {
+    a = a / d;
+    return a;
+}
+
+// vector operator /= : divide
+static inline Vec8q & operator /= (Vec8q & a, Divisor_q const d) {
+    a = a / d;
+    return a;
+}
+
 
 /*****************************************************************************
 *
@@ -2149,6 +2284,103 @@ static inline Vec16ui & operator /= (Vec16ui & a, Const_int_t<d> b) {
     return a;
 }
 
+// Divide Vec8uq by compile-time constant
+template <uint64_t d>
+static inline Vec8uq divide_by_uq(Vec8uq const x) {
+    static_assert(d != 0, "Integer division by zero");
+    if constexpr (d == 1) return x;                        // divide by 1
+    if constexpr ((d & (d - 1)) == 0) {
+        // d is a power of 2. use shift
+        return _mm512_srli_epi64(x, bit_scan_reverse_const(d)); // x >> b
+    }
+    else {
+        // general case (d > 2)
+        constexpr int L = bit_scan_reverse_const(d - 1) + 1; // ceil(log2(d))
+        constexpr uint64_t mult = divisor_uq_multiplier(d, L); // multiplier
+        const Divisor_uq div(mult, 1, L - 1);
+        return x / div;
+    }
+}
+
+// Divide Vec8q by compile-time constant
+template <int64_t d>
+static inline Vec8q divide_by_q(Vec8q const x) {
+    static_assert(d != 0, "Integer division by zero");
+    constexpr uint64_t d1 = d > 0 ? uint64_t(d) : 0 - uint64_t(d); // compile-time abs(d)
+    if constexpr (d == 1) return  x;
+    if constexpr (d == -1) return -x;
+    if constexpr (d1 == 0x8000000000000000u) return select(x == Vec8q(int64_t(d1)), Vec8q(1), Vec8q(0)); // prevent overflow when changing sign
+    if constexpr ((d1 & (d1 - 1)) == 0) {
+        // d1 is a power of 2. use shift
+        constexpr int k = bit_scan_reverse_const(d1);
+        __m512i sign = _mm512_srai_epi64(x, 63);           // sign of x
+        __m512i bias = _mm512_srli_epi64(sign, 64 - k);    // bias = x >= 0 ? 0 : d1-1
+        Vec8q q = _mm512_srai_epi64(_mm512_add_epi64(x, bias), k); // (x + bias) >> k
+        if constexpr (d > 0) return q;                     // d > 0: return  q
+        else return -q;                                    // d < 0: return -q
+    }
+    else {
+        // general case
+        constexpr int L = bit_scan_reverse_const(d1 - 1) + 1; // ceil(log2(d1))
+        constexpr uint64_t mult = divisor_uq_multiplier(d1, L); // multiplier
+        const Divisor_q div(mult, 1, L - 1, d < 0 ? -1 : 0);
+        return x / div;
+    }
+}
+
+// define Vec8q a / const_int(d)
+template <int32_t d>
+static inline Vec8q operator / (Vec8q const a, Const_int_t<d>) {
+    return divide_by_q<d>(a);
+}
+
+// define Vec8q a / const_uint(d)
+template <uint32_t d>
+static inline Vec8q operator / (Vec8q const a, Const_uint_t<d>) {
+    return divide_by_q<int64_t(d)>(a);                     // signed divide
+}
+
+// vector operator /= : divide
+template <int32_t d>
+static inline Vec8q & operator /= (Vec8q & a, Const_int_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// vector operator /= : divide
+template <uint32_t d>
+static inline Vec8q & operator /= (Vec8q & a, Const_uint_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// define Vec8uq a / const_uint(d)
+template <uint32_t d>
+static inline Vec8uq operator / (Vec8uq const a, Const_uint_t<d>) {
+    return divide_by_uq<d>(a);
+}
+
+// define Vec8uq a / const_int(d)
+template <int32_t d>
+static inline Vec8uq operator / (Vec8uq const a, Const_int_t<d>) {
+    static_assert(d >= 0, "Dividing unsigned integer by negative is ambiguous");
+    return divide_by_uq<d>(a);                             // unsigned divide
+}
+
+// vector operator /= : divide
+template <uint32_t d>
+static inline Vec8uq & operator /= (Vec8uq & a, Const_uint_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// vector operator /= : divide
+template <int32_t d>
+static inline Vec8uq & operator /= (Vec8uq & a, Const_int_t<d> b) {
+    a = a / b;
+    return a;
+}
+
 #ifdef VCL_NAMESPACE
 }
 #endif
@@ -76,6 +76,12 @@ public:
         z1 = Vec8i().load_a((int32_t const*)p+8);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec512b & load_nt(void const * p) {
+        z0 = Vec8i().load_nt(p);
+        z1 = Vec8i().load_nt((int32_t const*)p+8);
+        return *this;
+    }
     // Member function to store into array (unaligned)
     void store(void * p) const {
         Vec8i(z0).store(p);
@@ -690,6 +696,11 @@ public:
         Vec512b::load_a(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec16i & load_nt(void const * p) {
+        Vec512b::load_nt(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec16i & load_partial(int n, void const * p) {
         if (n < 8) {
@@ -944,6 +955,21 @@ static inline Vec16i if_mul (Vec16ib const f, Vec16i const a, Vec16i const b) {
     return Vec16i(if_mul(f.get_low(), a.get_low(), b.get_low()), if_mul(f.get_high(), a.get_high(), b.get_high()));
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec16i maskz_add (Vec16ib const f, Vec16i const a, Vec16i const b) {
+    return Vec16i(maskz_add(f.get_low(), a.get_low(), b.get_low()), maskz_add(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec16i maskz_sub (Vec16ib const f, Vec16i const a, Vec16i const b) {
+    return Vec16i(maskz_sub(f.get_low(), a.get_low(), b.get_low()), maskz_sub(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec16i maskz_mul (Vec16ib const f, Vec16i const a, Vec16i const b) {
+    return Vec16i(maskz_mul(f.get_low(), a.get_low(), b.get_low()), maskz_mul(f.get_high(), a.get_high(), b.get_high()));
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int32_t horizontal_add (Vec16i const a) {
     return horizontal_add(a.get_low() + a.get_high());
@@ -1031,6 +1057,11 @@ public:
         Vec16i::load_a(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec16ui & load_nt(void const * p) {
+        Vec16i::load_nt(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec16ui const insert(int index, uint32_t value) {
         Vec16i::insert(index, (int32_t)value);
@@ -1171,6 +1202,21 @@ static inline Vec16ui if_mul (Vec16ib const f, Vec16ui const a, Vec16ui const b)
     return Vec16ui(if_mul(f, Vec16i(a), Vec16i(b)));
 }
 
+// Conditional add with zeroing
+static inline Vec16ui maskz_add (Vec16ib const f, Vec16ui const a, Vec16ui const b) {
+    return Vec16ui(maskz_add(f, Vec16i(a), Vec16i(b)));
+}
+
+// Conditional subtract with zeroing
+static inline Vec16ui maskz_sub (Vec16ib const f, Vec16ui const a, Vec16ui const b) {
+    return Vec16ui(maskz_sub(f, Vec16i(a), Vec16i(b)));
+}
+
+// Conditional multiply with zeroing
+static inline Vec16ui maskz_mul (Vec16ib const f, Vec16ui const a, Vec16ui const b) {
+    return Vec16ui(maskz_mul(f, Vec16i(a), Vec16i(b)));
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint32_t horizontal_add (Vec16ui const a) {
     return (uint32_t)horizontal_add((Vec16i)a);
@@ -1246,6 +1292,12 @@ public:
         z1 = Vec4q().load_a((int64_t const*)p+4);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec8q & load_nt(void const * p) {
+        z0 = Vec4q().load_nt(p);
+        z1 = Vec4q().load_nt((int64_t const*)p+4);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec8q & load_partial(int n, void const * p) {
         if (n < 4) {
@@ -1496,6 +1548,21 @@ static inline Vec8q if_mul (Vec8qb const f, Vec8q const a, Vec8q const b) {
     return Vec8q(if_mul(f.get_low(), a.get_low(), b.get_low()), if_mul(f.get_high(), a.get_high(), b.get_high()));
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec8q maskz_add (Vec8qb const f, Vec8q const a, Vec8q const b) {
+    return Vec8q(maskz_add(f.get_low(), a.get_low(), b.get_low()), maskz_add(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec8q maskz_sub (Vec8qb const f, Vec8q const a, Vec8q const b) {
+    return Vec8q(maskz_sub(f.get_low(), a.get_low(), b.get_low()), maskz_sub(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec8q maskz_mul (Vec8qb const f, Vec8q const a, Vec8q const b) {
+    return Vec8q(maskz_mul(f.get_low(), a.get_low(), b.get_low()), maskz_mul(f.get_high(), a.get_high(), b.get_high()));
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int64_t horizontal_add (Vec8q const a) {
     return horizontal_add(a.get_low() + a.get_high());
@@ -1596,6 +1663,11 @@ public:
         Vec8q::load_a(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec8uq & load_nt(void const * p) {
+        Vec8q::load_nt(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec8uq const insert(int index, uint64_t value) {
         Vec8q::insert(index, (int64_t)value);
@@ -1729,6 +1801,21 @@ static inline Vec8uq if_mul (Vec8qb const f, Vec8uq const a, Vec8uq const b) {
     return Vec8uq(if_mul(f.get_low(), a.get_low(), b.get_low()), if_mul(f.get_high(), a.get_high(), b.get_high()));
 }
 
+// Conditional add with zeroing
+static inline Vec8uq maskz_add (Vec8qb const f, Vec8uq const a, Vec8uq const b) {
+    return Vec8uq(maskz_add(f.get_low(), a.get_low(), b.get_low()), maskz_add(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional subtract with zeroing
+static inline Vec8uq maskz_sub (Vec8qb const f, Vec8uq const a, Vec8uq const b) {
+    return Vec8uq(maskz_sub(f.get_low(), a.get_low(), b.get_low()), maskz_sub(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional multiply with zeroing
+static inline Vec8uq maskz_mul (Vec8qb const f, Vec8uq const a, Vec8uq const b) {
+    return Vec8uq(maskz_mul(f.get_low(), a.get_low(), b.get_low()), maskz_mul(f.get_high(), a.get_high(), b.get_high()));
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline uint64_t horizontal_add (Vec8uq const a) {
     return (uint64_t)horizontal_add(Vec8q(a));
@@ -2259,6 +2346,28 @@ static inline Vec16ui & operator /= (Vec16ui & a, Divisor_ui const d) {
     return a;
 }
 
+// vector operator / : divide all elements by same integer
+static inline Vec8q operator / (Vec8q const a, Divisor_q const d) {
+    return Vec8q(a.get_low() / d, a.get_high() / d);
+}
+
+// vector operator /= : divide
+static inline Vec8q & operator /= (Vec8q & a, Divisor_q const d) {
+    a = a / d;
+    return a;
+}
+
+// vector operator / : divide all elements by same integer
+static inline Vec8uq operator / (Vec8uq const a, Divisor_uq const d) {
+    return Vec8uq(a.get_low() / d, a.get_high() / d);
+}
+
+// vector operator /= : divide
+static inline Vec8uq & operator /= (Vec8uq & a, Divisor_uq const d) {
+    a = a / d;
+    return a;
+}
+
 
 /*****************************************************************************
 *
@@ -2332,6 +2441,71 @@ static inline Vec16ui & operator /= (Vec16ui & a, Const_int_t<d> b) {
     return a;
 }
 
+// Divide Vec8q by compile-time constant
+template <int64_t d>
+static inline Vec8q divide_by_q(Vec8q const a) {
+    return Vec8q(divide_by_q<d>(a.get_low()), divide_by_q<d>(a.get_high()));
+}
+
+// define Vec8q a / const_int(d)
+template <int32_t d>
+static inline Vec8q operator / (Vec8q const a, Const_int_t<d>) {
+    return divide_by_q<d>(a);
+}
+
+// define Vec8q a / const_uint(d)
+template <uint32_t d>
+static inline Vec8q operator / (Vec8q const a, Const_uint_t<d>) {
+    return divide_by_q<int64_t(d)>(a);                               // signed divide
+}
+
+// vector operator /= : divide
+template <int32_t d>
+static inline Vec8q & operator /= (Vec8q & a, Const_int_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// vector operator /= : divide
+template <uint32_t d>
+static inline Vec8q & operator /= (Vec8q & a, Const_uint_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// Divide Vec8uq by compile-time constant
+template <uint64_t d>
+static inline Vec8uq divide_by_uq(Vec8uq const a) {
+    return Vec8uq(divide_by_uq<d>(a.get_low()), divide_by_uq<d>(a.get_high()));
+}
+
+// define Vec8uq a / const_uint(d)
+template <uint32_t d>
+static inline Vec8uq operator / (Vec8uq const a, Const_uint_t<d>) {
+    return divide_by_uq<d>(a);
+}
+
+// define Vec8uq a / const_int(d)
+template <int32_t d>
+static inline Vec8uq operator / (Vec8uq const a, Const_int_t<d>) {
+    static_assert(d >= 0, "Dividing unsigned integer by negative is ambiguous");
+    return divide_by_uq<d>(a);                                       // unsigned divide
+}
+
+// vector operator /= : divide
+template <uint32_t d>
+static inline Vec8uq & operator /= (Vec8uq & a, Const_uint_t<d> b) {
+    a = a / b;
+    return a;
+}
+
+// vector operator /= : divide
+template <int32_t d>
+static inline Vec8uq & operator /= (Vec8uq & a, Const_int_t<d> b) {
+    a = a / b;
+    return a;
+}
+
 
 /*****************************************************************************
 *
@@ -106,6 +106,11 @@ public:
         zmm = _mm512_load_si512(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec64c & load_nt(void const * p) {
+        zmm = load_nt_512(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec64c & load_partial(int n, void const * p) {
         if (n >= 64) {
@@ -559,6 +564,21 @@ static inline Vec64c if_mul (Vec64cb const f, Vec64c const a, Vec64c const b) {
     return select(f, m, a);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec64c maskz_add (Vec64cb const f, Vec64c const a, Vec64c const b) {
+    return _mm512_maskz_add_epi8(f, a, b);
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec64c maskz_sub (Vec64cb const f, Vec64c const a, Vec64c const b) {
+    return _mm512_maskz_sub_epi8(f, a, b);
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec64c maskz_mul (Vec64cb const f, Vec64c const a, Vec64c const b) {
+    return _mm512_maskz_mov_epi8(f, a * b);
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int8_t horizontal_add (Vec64c const a) {
     __m512i sum1 = _mm512_sad_epu8(a,_mm512_setzero_si512());
@@ -668,6 +688,11 @@ public:
         Vec64c::load_a(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec64uc & load_nt(void const * p) {
+        Vec64c::load_nt(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec64uc const insert(int index, uint8_t value) {
         Vec64c::insert(index, (int8_t)value);
@@ -809,6 +834,21 @@ static inline Vec64uc if_mul (Vec64cb const f, Vec64uc const a, Vec64uc const b)
     return select(f, m, a);
 }
 
+// Conditional add with zeroing
+static inline Vec64uc maskz_add (Vec64cb const f, Vec64uc const a, Vec64uc const b) {
+    return Vec64uc(maskz_add(f, Vec64c(a), Vec64c(b)));
+}
+
+// Conditional subtract with zeroing
+static inline Vec64uc maskz_sub (Vec64cb const f, Vec64uc const a, Vec64uc const b) {
+    return Vec64uc(maskz_sub(f, Vec64c(a), Vec64c(b)));
+}
+
+// Conditional multiply with zeroing
+static inline Vec64uc maskz_mul (Vec64cb const f, Vec64uc const a, Vec64uc const b) {
+    return Vec64uc(maskz_mul(f, Vec64c(a), Vec64c(b)));
+}
+
 // function add_saturated: add element by element, unsigned with saturation
 static inline Vec64uc add_saturated(Vec64uc const a, Vec64uc const b) {
     return _mm512_adds_epu8(a, b);
@@ -888,6 +928,11 @@ public:
         zmm = _mm512_load_si512(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec32s & load_nt(void const * p) {
+        zmm = load_nt_512(p);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec32s & load_partial(int n, void const * p) {
         zmm = _mm512_maskz_loadu_epi16(__mmask32(((uint64_t)1 << n) - 1), p);
@@ -1126,6 +1171,21 @@ static inline Vec32s if_mul (Vec32sb const f, Vec32s const a, Vec32s const b) {
     return _mm512_mask_mullo_epi16(a, f, a, b);
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec32s maskz_add (Vec32sb const f, Vec32s const a, Vec32s const b) {
+    return _mm512_maskz_add_epi16(f, a, b);
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec32s maskz_sub (Vec32sb const f, Vec32s const a, Vec32s const b) {
+    return _mm512_maskz_sub_epi16(f, a, b);
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec32s maskz_mul (Vec32sb const f, Vec32s const a, Vec32s const b) {
+    return _mm512_maskz_mullo_epi16(f, a, b);
+}
+
 // Horizontal add: Calculates the sum of all vector elements.
 // Overflow will wrap around
 static inline int16_t horizontal_add (Vec32s const a) {
@@ -1224,6 +1284,11 @@ public:
         Vec32s::load_a(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec32us & load_nt(void const * p) {
+        Vec32s::load_nt(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec32us const insert(int index, uint16_t value) {
         Vec32s::insert(index, (int16_t)value);
@@ -1361,6 +1426,21 @@ static inline Vec32us if_mul (Vec32sb const f, Vec32us const a, Vec32us const b)
     return _mm512_mask_mullo_epi16(a, f, a, b);
 }
 
+// Conditional add with zeroing
+static inline Vec32us maskz_add (Vec32sb const f, Vec32us const a, Vec32us const b) {
+    return Vec32us(maskz_add(f, Vec32s(a), Vec32s(b)));
+}
+
+// Conditional subtract with zeroing
+static inline Vec32us maskz_sub (Vec32sb const f, Vec32us const a, Vec32us const b) {
+    return Vec32us(maskz_sub(f, Vec32s(a), Vec32s(b)));
+}
+
+// Conditional multiply with zeroing
+static inline Vec32us maskz_mul (Vec32sb const f, Vec32us const a, Vec32us const b) {
+    return Vec32us(maskz_mul(f, Vec32s(a), Vec32s(b)));
+}
+
 // function add_saturated: add element by element, unsigned with saturation
 static inline Vec32us add_saturated(Vec32us const a, Vec32us const b) {
     return _mm512_adds_epu16(a, b);
@@ -132,6 +132,13 @@ public:
         z1 = x.get_high();
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec64c & load_nt(void const * p) {
+        Vec16i x = Vec16i().load_nt(p);
+        z0 = x.get_low();
+        z1 = x.get_high();
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec64c & load_partial(int n, void const * p) {
         Vec32c lo, hi;
@@ -582,6 +589,21 @@ static inline Vec64c if_mul (Vec64cb const f, Vec64c const a, Vec64c const b) {
     return Vec64c(if_mul(f.get_low(), a.get_low(), b.get_low()), if_mul(f.get_high(), a.get_high(), b.get_high()));
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec64c maskz_add (Vec64cb const f, Vec64c const a, Vec64c const b) {
+    return Vec64c(maskz_add(f.get_low(), a.get_low(), b.get_low()), maskz_add(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec64c maskz_sub (Vec64cb const f, Vec64c const a, Vec64c const b) {
+    return Vec64c(maskz_sub(f.get_low(), a.get_low(), b.get_low()), maskz_sub(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec64c maskz_mul (Vec64cb const f, Vec64c const a, Vec64c const b) {
+    return Vec64c(maskz_mul(f.get_low(), a.get_low(), b.get_low()), maskz_mul(f.get_high(), a.get_high(), b.get_high()));
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int8_t horizontal_add (Vec64c const a) {
     return (int8_t)horizontal_add(a.get_low() + a.get_high());
@@ -694,6 +716,11 @@ public:
         Vec64c::load_a(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec64uc & load_nt(void const * p) {
+        Vec64c::load_nt(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     // Note: This function is inefficient. Use load function if changing more than one element
     Vec64uc const insert(int index, uint8_t value) {
@@ -832,6 +859,21 @@ static inline Vec64uc if_mul (Vec64cb const f, Vec64uc const a, Vec64uc const b)
     return Vec64uc(if_mul(f.get_low(), a.get_low(), b.get_low()), if_mul(f.get_high(), a.get_high(), b.get_high()));
 }
 
+// Conditional add with zeroing
+static inline Vec64uc maskz_add (Vec64cb const f, Vec64uc const a, Vec64uc const b) {
+    return Vec64uc(maskz_add(f.get_low(), a.get_low(), b.get_low()), maskz_add(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional subtract with zeroing
+static inline Vec64uc maskz_sub (Vec64cb const f, Vec64uc const a, Vec64uc const b) {
+    return Vec64uc(maskz_sub(f.get_low(), a.get_low(), b.get_low()), maskz_sub(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional multiply with zeroing
+static inline Vec64uc maskz_mul (Vec64cb const f, Vec64uc const a, Vec64uc const b) {
+    return Vec64uc(maskz_mul(f.get_low(), a.get_low(), b.get_low()), maskz_mul(f.get_high(), a.get_high(), b.get_high()));
+}
+
 // function add_saturated: add element by element, unsigned with saturation
 static inline Vec64uc add_saturated(Vec64uc const a, Vec64uc const b) {
     return Vec64uc(add_saturated(a.get_low(), b.get_low()), add_saturated(a.get_high(), b.get_high()));
@@ -919,6 +961,12 @@ public:
         z1 = Vec16s().load_a((int16_t*)p + 16);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec32s & load_nt(void const * p) {
+        z0 = Vec16s().load_nt(p);
+        z1 = Vec16s().load_nt((int16_t*)p + 16);
+        return *this;
+    }
     // Partial load. Load n elements and set the rest to 0
     Vec32s & load_partial(int n, void const * p) {
         if (uint32_t(n) < 16) {
@@ -1333,6 +1381,21 @@ static inline Vec32s if_mul (Vec32sb const f, Vec32s const a, Vec32s const b) {
     return Vec32s(if_mul(f.get_low(), a.get_low(), b.get_low()), if_mul(f.get_high(), a.get_high(), b.get_high()));
 }
 
+// Conditional add with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] + b[i]) : 0
+static inline Vec32s maskz_add (Vec32sb const f, Vec32s const a, Vec32s const b) {
+    return Vec32s(maskz_add(f.get_low(), a.get_low(), b.get_low()), maskz_add(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional subtract with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] - b[i]) : 0
+static inline Vec32s maskz_sub (Vec32sb const f, Vec32s const a, Vec32s const b) {
+    return Vec32s(maskz_sub(f.get_low(), a.get_low(), b.get_low()), maskz_sub(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional multiply with zeroing: For all vector elements i: result[i] = f[i] ? (a[i] * b[i]) : 0
+static inline Vec32s maskz_mul (Vec32sb const f, Vec32s const a, Vec32s const b) {
+    return Vec32s(maskz_mul(f.get_low(), a.get_low(), b.get_low()), maskz_mul(f.get_high(), a.get_high(), b.get_high()));
+}
+
 // Horizontal add: Calculates the sum of all vector elements. Overflow will wrap around
 static inline int16_t horizontal_add (Vec32s const a) {
     Vec16s s = a.get_low() + a.get_high();
@@ -1441,6 +1504,11 @@ public:
         Vec32s::load_a(p);
         return *this;
     }
+    // Member function to load from array, aligned by 64, with non-temporal hint
+    Vec32us & load_nt(void const * p) {
+        Vec32s::load_nt(p);
+        return *this;
+    }
     // Member function to change a single element in vector
     Vec32us const insert(int index, uint16_t value) {
         Vec32s::insert(index, (int16_t)value);
@@ -1577,6 +1645,21 @@ static inline Vec32us if_mul (Vec32sb const f, Vec32us const a, Vec32us const b)
     return Vec32us(if_mul(f.get_low(), a.get_low(), b.get_low()), if_mul(f.get_high(), a.get_high(), b.get_high()));
 }
 
+// Conditional add with zeroing
+static inline Vec32us maskz_add (Vec32sb const f, Vec32us const a, Vec32us const b) {
+    return Vec32us(maskz_add(f.get_low(), a.get_low(), b.get_low()), maskz_add(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional subtract with zeroing
+static inline Vec32us maskz_sub (Vec32sb const f, Vec32us const a, Vec32us const b) {
+    return Vec32us(maskz_sub(f.get_low(), a.get_low(), b.get_low()), maskz_sub(f.get_high(), a.get_high(), b.get_high()));
+}
+
+// Conditional multiply with zeroing
+static inline Vec32us maskz_mul (Vec32sb const f, Vec32us const a, Vec32us const b) {
+    return Vec32us(maskz_mul(f.get_low(), a.get_low(), b.get_low()), maskz_mul(f.get_high(), a.get_high(), b.get_high()));
+}
+
 // function add_saturated: add element by element, unsigned with saturation
 static inline Vec32us add_saturated(Vec32us const a, Vec32us const b) {
     return Vec32us(add_saturated(a.get_low(), b.get_low()), add_saturated(a.get_high(), b.get_high()));
@@ -0,0 +1,502 @@
+/**************************  vectormath_benchmark.cpp   ************************
+Author:        VCL contributors
+Date created:  2026-10-14
+Last modified: 2026-10-14
+Version:       2.03.00
+Project:       vector class library
+Description:   Benchmark of the mathematical functions.
+               Measures the throughput and latency of each function for each
+               vector size, and the error in ULP relative to a long double
+               reference calculated with the standard library.
+
+The program tests the inline functions in vectormath_exp.h, vectormath_trig.h,
+and vectormath_hyp.h, or the SVML functions in vectormath_lib.h if
+VCL_BENCHMARK_SVML is defined. Half precision vectors (Vec8h, Vec16h, Vec32h)
+are tested with the functions in vectorfp16.h unless VCL_BENCHMARK_NO_FP16 is
+defined.
+
+Compile the program once for each instruction set to compare. The program
+reports the instruction set it was compiled for, and exits if the CPU does not
+support it. Example with Gnu or Clang compiler:
+
+g++ -O2 -std=c++17 -msse4.1 vectormath_benchmark.cpp instrset_detect.cpp -obench_sse41
+g++ -O2 -std=c++17 -mavx2 -mfma -mf16c vectormath_benchmark.cpp instrset_detect.cpp -obench_avx2
+g++ -O2 -std=c++17 -mavx512f -mavx512vl -mavx512bw -mavx512dq -mfma vectormath_benchmark.cpp instrset_detect.cpp -obench_avx512
+g++ -O2 -std=c++17 -march=sapphirerapids vectormath_benchmark.cpp instrset_detect.cpp -obench_fp16
+
+# With SVML. The path and names of the SVML libraries depend on the installation:
+g++ -O2 -std=c++17 -mavx2 -mfma -DVCL_BENCHMARK_SVML vectormath_benchmark.cpp instrset_detect.cpp -L/opt/intel/lib -lsvml -lirc -obench_svml
+
+Run the program:
+./bench_avx2                 all functions
+./bench_avx2 exp sin         only the functions named exp and sin
+./bench_avx2 -csv            comma separated output, for comparing versions
+
+The output columns are:
+throughput:  clock counts per vector element, calling the function for many
+             independent vectors in the level-1 cache
+latency:     clock counts per function call, when the input of each call
+             depends on the result of the previous call
+max ulp:     maximum error in units in the last place, for random
+             arguments in the ranges given in the function lists below
+mean ulp:    average error in units in the last place
+
+The clock counts are measured with the time stamp counter. This may differ
+from the core clock frequency, depending on the CPU and its power state.
+The timing is the minimum of several repetitions. Do not compile with
+-ffast-math, because the latency measurement relies on multiplication by
+zero.
+
+(c) Copyright 2026 VCL contributors.
+Apache License version 2.0 or later.
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+
+#ifdef VCL_BENCHMARK_SVML
+#include "vectormath_lib.h"
+#else
+#include "vectormath_exp.h"
+#include "vectormath_trig.h"
+#include "vectormath_hyp.h"
+#endif
+#ifndef VCL_BENCHMARK_NO_FP16
+#include "vectorfp16.h"
+#endif
+
+#ifdef VCL_NAMESPACE
+using namespace VCL_NAMESPACE;
+#endif
+
+// Number of elements in the arrays used for throughput and accuracy
+const int array_size = 1024;
+
+// Number of random arguments for accuracy test
+const int accuracy_count = 1 << 16;
+
+// Repetitions of each timing
+const int timing_repeat = 16;
+
+// Zero that the compiler cannot see, used in the latency chain
+volatile double zero_volatile = 0.;
+
+// Options from the command line
+static bool csv_output = false;
+static std::vector<char const *> selected;   // names of functions to test. Empty for all
+
+
+/******************************************************************************
+*          Vector types
+******************************************************************************/
+
+// Precision of each element type
+struct Precision {
+    int digits;                                  // bits in the significand, including the hidden bit
+    int min_exponent;                            // exponent of the smallest normal number, as frexp
+};
+
+// Information about vector class V:
+// S = type of the scalar arrays: float for Vec*f and Vec*h, double for Vec*d
+template <typename V> struct Bench_vector;
+
+template <typename V>
+struct Bench_float {
+    typedef float S;
+    static constexpr Precision precision = {24, -125};
+    static V load(S const * p) {return V().load(p);}
+    static void store(V const x, S * p) {x.store(p);}
+};
+
+template <typename V>
+struct Bench_double {
+    typedef double S;
+    static constexpr Precision precision = {53, -1021};
+    static V load(S const * p) {return V().load(p);}
+    static void store(V const x, S * p) {x.store(p);}
+};
+
+template <> struct Bench_vector<Vec4f> : Bench_float<Vec4f> {static char const * name() {return "Vec4f";}};
+template <> struct Bench_vector<Vec2d> : Bench_double<Vec2d> {static char const * name() {return "Vec2d";}};
+#if MAX_VECTOR_SIZE >= 256
+template <> struct Bench_vector<Vec8f> : Bench_float<Vec8f> {static char const * name() {return "Vec8f";}};
+template <> struct Bench_vector<Vec4d> : Bench_double<Vec4d> {static char const * name() {return "Vec4d";}};
+#endif
+#if MAX_VECTOR_SIZE >= 512
+template <> struct Bench_vector<Vec16f> : Bench_float<Vec16f> {static char const * name() {return "Vec16f";}};
+template <> struct Bench_vector<Vec8d> : Bench_double<Vec8d> {static char const * name() {return "Vec8d";}};
+#endif
+
+#ifdef VECTORFP16_H
+// Half precision vectors are converted from and to float
+template <typename V>
+static inline V load_half(float const * p) {
+    if constexpr (V::size() == 8) {
+        return to_float16(Vec8f().load(p));
+    }
+    else {
+        typedef decltype(V().get_low()) H;
+        return V(load_half<H>(p), load_half<H>(p + H::size()));
+    }
+}
+
+template <typename V>
+static inline void store_half(V const x, float * p) {
+    if constexpr (V::size() == 8) {
+        to_float(x).store(p);
+    }
+    else {
+        store_half(x.get_low(), p);
+        store_half(x.get_high(), p + V::size() / 2);
+    }
+}
+
+template <typename V>
+struct Bench_half {
+    typedef float S;
+    static constexpr Precision precision = {11, -13};
+    static V load(S const * p) {return load_half<V>(p);}
+    static void store(V const x, S * p) {store_half(x, p);}
+};
+
+template <> struct Bench_vector<Vec8h> : Bench_half<Vec8h> {static char const * name() {return "Vec8h";}};
+#if MAX_VECTOR_SIZE >= 256
+template <> struct Bench_vector<Vec16h> : Bench_half<Vec16h> {static char const * name() {return "Vec16h";}};
+#endif
+#if MAX_VECTOR_SIZE >= 512
+template <> struct Bench_vector<Vec32h> : Bench_half<Vec32h> {static char const * name() {return "Vec32h";}};
+#endif
+#endif // VECTORFP16_H
+
+
+/******************************************************************************
+*          Measurements
+******************************************************************************/
+
+// Read the time stamp counter
+static inline uint64_t bench_clock() {
+    return __rdtsc();
+}
+
+// Simple random number generator, giving the same sequence on all platforms
+struct Bench_random {
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    double next() {                              // uniform in [0, 1)
+        state = state * 6364136223846793005u + 1442695040888963407u;
+        return double(state >> 11) * (1. / 9007199254740992.);
+    }
+};
+
+// Error of result relative to ref in units in the last place of precision p
+static double ulp_error(long double result, long double ref, Precision const p) {
+    if (isnan(ref) || isinf(ref)) {
+        return (isnan(result) && isnan(ref)) || result == ref ? 0. : INFINITY;
+    }
+    if (isnan(result) || isinf(result)) return INFINITY;
+    int e;
+    frexpl(ref, &e);
+    if (e < p.min_exponent) e = p.min_exponent;  // subnormal
+    return double(fabsl(result - ref) / ldexpl(1.L, e - p.digits));
+}
+
+// Results of one function and vector class
+struct Bench_result {
+    double throughput;                           // clock counts per element
+    double latency;                              // clock counts per call
+    double max_ulp;                              // maximum error
+    double mean_ulp;                             // average error
+    double worst_x, worst_y;                     // arguments with the maximum error
+};
+
+// Measure function f with vector class V. f(x, y) ignores y if the function has one
+// argument. ref(x, y) is the reference function in long double precision.
+// x is taken from the interval [x0, x1] and y from [y0, y1]
+template <typename V, typename F, typename R>
+static Bench_result bench_function(F f, R ref, double x0, double x1, double y0, double y1) {
+    typedef Bench_vector<V> B;
+    typedef typename B::S S;
+    constexpr int N = V::size();
+    Bench_result r;
+    Bench_random rnd;
+    std::vector<S> x(array_size), y(array_size), z(array_size);
+
+    // random number in the interval [a, b]. Logarithmic distribution for wide positive intervals
+    auto draw = [&rnd](double a, double b) {
+        if (a > 0. && b > a * 1000.) return a * pow(b / a, rnd.next());
+        return a + (b - a) * rnd.next();
+    };
+
+    // accuracy
+    r.max_ulp = 0.;  r.worst_x = r.worst_y = 0.;
+    double sum_ulp = 0.;
+    for (int k = 0; k < accuracy_count; k += array_size) {
+        for (int i = 0; i < array_size; i++) {
+            x[i] = S(draw(x0, x1));
+            y[i] = S(draw(y0, y1));
+        }
+        for (int i = 0; i < array_size; i += N) {
+            V a = B::load(&x[i]), b = B::load(&y[i]);
+            B::store(a, &x[i]);                  // rounded to the precision of V
+            B::store(b, &y[i]);
+            B::store(f(a, b), &z[i]);
+        }
+        for (int i = 0; i < array_size; i++) {
+            double e = ulp_error(z[i], ref((long double)x[i], (long double)y[i]), B::precision);
+            sum_ulp += e;
+            if (e > r.max_ulp) {
+                r.max_ulp = e;  r.worst_x = x[i];  r.worst_y = y[i];
+            }
+        }
+    }
+    r.mean_ulp = sum_ulp / accuracy_count;
+
+    // throughput
+    uint64_t best = ~uint64_t(0);
+    for (int t = 0; t < timing_repeat; t++) {
+        uint64_t c0 = bench_clock();
+        for (int i = 0; i < array_size; i += N) {
+            B::store(f(B::load(&x[i]), B::load(&y[i])), &z[i]);
+        }
+        uint64_t c1 = bench_clock();
+        if (c1 - c0 < best) best = c1 - c0;
+    }
+    r.throughput = double(best) / array_size;
+
+    // latency. The argument of each call is zero * result + x, so that it depends on the
+    // previous result without changing the value
+    const int chain = 256;
+    V a = B::load(&x[0]), b = B::load(&y[0]);
+    V zero = a * S(zero_volatile);
+    uint64_t best_chain = ~uint64_t(0), best_empty = ~uint64_t(0);
+    for (int t = 0; t < timing_repeat; t++) {
+        V u = a;
+        uint64_t c0 = bench_clock();
+        for (int i = 0; i < chain; i++) u = f(u, b) * zero + a;
+        uint64_t c1 = bench_clock();
+        B::store(u, &z[0]);
+        if (c1 - c0 < best_chain) best_chain = c1 - c0;
+        // the same chain without the function
+        u = a;
+        c0 = bench_clock();
+        for (int i = 0; i < chain; i++) u = u * zero + a;
+        c1 = bench_clock();
+        B::store(u, &z[0]);
+        if (c1 - c0 < best_empty) best_empty = c1 - c0;
+    }
+    r.latency = (double(best_chain) - double(best_empty)) / chain;
+    if (r.latency < 0.) r.latency = 0.;
+    return r;
+}
+
+// Test if function name is selected on the command line
+static bool is_selected(char const * name) {
+    if (selected.empty()) return true;
+    for (char const * s : selected) {
+        if (strcmp(s, name) == 0) return true;
+    }
+    return false;
+}
+
+// Print the header of the output table
+static void print_header() {
+    if (csv_output) {
+        printf("function,vector,instrset,library,throughput,latency,max_ulp,mean_ulp\n");
+    }
+    else {
+        printf("\n%-12s %-8s %12s %10s %10s %10s   %s\n",
+            "function", "vector", "throughput", "latency", "max ulp", "mean ulp", "worst argument");
+    }
+}
+
+// Names of the instruction sets
+static char const * instrset_name(int i) {
+    static char const * const names[] = {"80386", "SSE", "SSE2", "SSE3", "SSSE3", "SSE4.1",
+        "SSE4.2", "AVX", "AVX2", "AVX512F", "AVX512BW/DQ/VL"};
+    return i >= 0 && i <= 10 ? names[i] : "?";
+}
+
+// Name of the math function library
+static char const * library_name() {
+#ifdef VCL_BENCHMARK_SVML
+    return "SVML";
+#else
+    return "VCL";
+#endif
+}
+
+// Measure and print one function with vector class V
+template <typename V, typename F, typename R>
+static void bench(char const * name, F f, R ref, double x0, double x1, double y0 = 0., double y1 = 0.) {
+    if (!is_selected(name)) return;
+    Bench_result r = bench_function<V>(f, ref, x0, x1, y0, y1);
+    if (csv_output) {
+        printf("%s,%s,%s,%s,%.3f,%.1f,%.2f,%.4f\n", name, Bench_vector<V>::name(), instrset_name(INSTRSET),
+            library_name(), r.throughput, r.latency, r.max_ulp, r.mean_ulp);
+    }
+    else {
+        printf("%-12s %-8s %12.3f %10.1f %10.2f %10.4f   %.9g", name, Bench_vector<V>::name(),
+            r.throughput, r.latency, r.max_ulp, r.mean_ulp, r.worst_x);
+        if (y0 != y1) printf(", %.9g", r.worst_y);
+        printf("\n");
+    }
+}
+
+
+/******************************************************************************
+*          Reference functions
+******************************************************************************/
+
+static const long double pi_l = 3.141592653589793238462643383279502884L;
+
+// sin(pi*x) and cos(pi*x). The reduction to [-0.5,0.5] is exact, so the reference
+// keeps full relative precision near the zeros
+static long double ref_sinpi(long double x) {
+    long double r = x - 2.L * nearbyintl(0.5L * x);   // r in [-1,1]
+    if (r > 0.5L) r = 1.L - r;                       // sin(pi*r) = sin(pi*(1-r))
+    if (r < -0.5L) r = -1.L - r;
+    return sinl(pi_l * r);
+}
+
+static long double ref_cospi(long double x) {
+    long double r = x - 2.L * nearbyintl(0.5L * x);   // r in [-1,1]
+    return ref_sinpi(0.5L - fabsl(r));               // cos(pi*r) = sin(pi*(0.5-|r|))
+}
+
+#ifdef VECTORMATH_LIB_H
+// Inverse of the cumulative normal distribution, by Newton iteration
+static long double ref_cdfnorminv(long double p) {
+    if (p <= 0.L) return -INFINITY;
+    if (p >= 1.L) return INFINITY;
+    long double x = 0.L;
+    for (int i = 0; i < 100; i++) {
+        long double f = 0.5L * erfcl(-x / sqrtl(2.L)) - p;
+        long double d = expl(-0.5L * x * x) / sqrtl(2.L * pi_l);
+        long double dx = f / d;
+        if (dx > 1.L) dx = 1.L;                  // limit the steps far from the root
+        if (dx < -1.L) dx = -1.L;
+        x -= dx;
+        if (fabsl(dx) <= fabsl(x) * 1E-19L) break;
+    }
+    return x;
+}
+#endif
+
+// Functions with one argument. The reference is the long double function ref of x
+#define BENCH1(V, name, ref, x0, x1) \
+    bench<V>(#name, [](V const x, V const) {return name(x);}, [](long double x, long double) {return ref;}, x0, x1)
+
+// Functions with two arguments
+#define BENCH2(V, name, ref, x0, x1, y0, y1) \
+    bench<V>(#name, [](V const x, V const y) {return name(x, y);}, [](long double x, long double y) {return ref;}, x0, x1, y0, y1)
+
+
+/******************************************************************************
+*          Function lists
+******************************************************************************/
+
+// Single and double precision
+template <typename V>
+static void bench_vector() {
+    BENCH1(V, exp,    expl(x),       -80., 80.);
+    BENCH1(V, expm1,  expm1l(x),     -2., 2.);
+    BENCH1(V, exp2,   exp2l(x),      -120., 120.);
+    BENCH1(V, exp10,  powl(10.L, x), -35., 35.);
+    BENCH1(V, log,    logl(x),       1E-30, 1E30);
+    BENCH1(V, log1p,  log1pl(x),     -0.5, 2.);
+    BENCH1(V, log2,   log2l(x),      1E-30, 1E30);
+    BENCH1(V, log10,  log10l(x),     1E-30, 1E30);
+    BENCH1(V, cbrt,   cbrtl(x),      -1E30, 1E30);
+    BENCH2(V, pow,    powl(x, y),    0.01, 100., -15., 15.);
+    BENCH1(V, sin,    sinl(x),       -100., 100.);
+    BENCH1(V, cos,    cosl(x),       -100., 100.);
+    BENCH1(V, tan,    tanl(x),       -1.5, 1.5);
+    BENCH1(V, sinpi,  ref_sinpi(x), -10., 10.);
+    BENCH1(V, cospi,  ref_cospi(x), -10., 10.);
+    BENCH1(V, asin,   asinl(x),      -1., 1.);
+    BENCH1(V, acos,   acosl(x),      -1., 1.);
+    BENCH1(V, atan,   atanl(x),      -100., 100.);
+    BENCH2(V, atan2,  atan2l(x, y),  -10., 10., -10., 10.);
+    BENCH1(V, sinh,   sinhl(x),      -80., 80.);
+    BENCH1(V, cosh,   coshl(x),      -80., 80.);
+    BENCH1(V, tanh,   tanhl(x),      -10., 10.);
+    BENCH1(V, asinh,  asinhl(x),     -1E10, 1E10);
+    BENCH1(V, acosh,  acoshl(x),     1., 1E10);
+    BENCH1(V, atanh,  atanhl(x),     -0.99, 0.99);
+#ifdef VECTORMATH_LIB_H
+    // these functions are only available in SVML
+    BENCH1(V, erf,    erfl(x),       -5., 5.);
+    BENCH1(V, erfc,   erfcl(x),      -5., 9.);
+    BENCH1(V, cdfnorminv, ref_cdfnorminv(x), 1E-6, 1. - 1E-6);
+#endif
+}
+
+#ifdef VECTORFP16_H
+// Half precision
+template <typename V>
+static void bench_vector_half() {
+    BENCH1(V, exp,    expl(x),       -10., 10.);
+    BENCH1(V, expm1,  expm1l(x),     -2., 2.);
+    BENCH1(V, exp2,   exp2l(x),      -14., 15.);
+    BENCH1(V, exp10,  powl(10.L, x), -4., 4.);
+    BENCH1(V, sin,    sinl(x),       -10., 10.);
+    BENCH1(V, cos,    cosl(x),       -10., 10.);
+    BENCH1(V, tan,    tanl(x),       -1.5, 1.5);
+    BENCH1(V, sinpi,  ref_sinpi(x), -10., 10.);
+    BENCH1(V, cospi,  ref_cospi(x), -10., 10.);
+}
+#endif
+
+
+/******************************************************************************
+*          Main
+******************************************************************************/
+
+int main(int argc, char * argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-csv") == 0) csv_output = true;
+        else selected.push_back(argv[i]);
+    }
+    int supported = instrset_detect();
+    if (supported < INSTRSET) {
+        printf("Error: compiled for %s, but the CPU supports only %s\n",
+            instrset_name(INSTRSET), instrset_name(supported));
+        return 1;
+    }
+    if (!csv_output) {
+        printf("Benchmark of %s math functions compiled for %s",
+            library_name(), instrset_name(INSTRSET));
+#ifdef __AVX512FP16__
+        printf(" with AVX512FP16");
+#endif
+        printf("\nThroughput in clock counts per element, latency in clock counts per call");
+    }
+    print_header();
+    bench_vector<Vec4f>();
+#if MAX_VECTOR_SIZE >= 256
+    bench_vector<Vec8f>();
+#endif
+#if MAX_VECTOR_SIZE >= 512
+    bench_vector<Vec16f>();
+#endif
+    bench_vector<Vec2d>();
+#if MAX_VECTOR_SIZE >= 256
+    bench_vector<Vec4d>();
+#endif
+#if MAX_VECTOR_SIZE >= 512
+    bench_vector<Vec8d>();
+#endif
+#ifdef VECTORFP16_H
+    bench_vector_half<Vec8h>();
+#if MAX_VECTOR_SIZE >= 256
+    bench_vector_half<Vec16h>();
+#endif
+#if MAX_VECTOR_SIZE >= 512
+    bench_vector_half<Vec32h>();
+#endif
+#endif
+    return 0;
+}
@@ -21,6 +21,8 @@
 #endif
 
 #include <cmath>
+#include <array>
+#include <type_traits>
 
 #ifndef VECTORCLASS_H
 #include "vectorclass.h"
@@ -163,33 +165,126 @@ Using Estrin's scheme to make shorter dependency chains and use FMA, starting
 longest dependency chains first.
 ******************************************************************************/
 
+// The general polynomial functions calculate c0 + c1*x + c2*x^2 + ... + cn*x^n
+// for any number of coefficients. The coefficients are given as a parameter list
+// or as a std::array with c0 first:
+// polynomial(x, c0, c1, ..., cn)           Horner's scheme for degree < 3, otherwise Estrin's scheme
+// polynomial(x, std::array c)              Same, with coefficients in an array
+// polynomial_estrin(x, c0, c1, ..., cn)    Estrin's scheme
+// polynomial_horner(x, c0, c1, ..., cn)    Horner's scheme
+// Estrin's scheme splits the polynomial recursively into hi(x)*x^m + lo(x), where m
+// is the biggest power of 2 less than the number of coefficients. The dependency
+// chain grows with log2 of the degree, rather than with the degree as in Horner's
+// scheme. Estrin's scheme uses log2(n) extra multiplications for the powers of x.
+// This is faster for degree 3 and higher, whether FMA instructions are available
+// or not. Horner's scheme may be faster when the throughput rather than the latency
+// is limiting, e.g. when many independent polynomials are calculated in a loop.
+
+// Integer part of log2(n) for n > 0
+constexpr int polynomial_log2(size_t n) {
+    return n > 1 ? 1 + polynomial_log2(n >> 1) : 0;
+}
+
+// Horner's scheme for coefficients c[I] .. c[N-1]
+template <size_t I, class VTYPE, class CTYPE, size_t N>
+static inline VTYPE polynomial_horner_part(VTYPE const x, std::array<CTYPE, N> const & c) {
+    if constexpr (I == N - 1) {
+        return VTYPE(c[I]);
+    }
+    else {
+        return mul_add(polynomial_horner_part<I + 1>(x, c), x, VTYPE(c[I]));
+    }
+}
+
+// Calculate xp[k] = x^(2^k) for k = 1 .. K-1
+template <int K, int k = 1, class VTYPE>
+static inline void polynomial_powers(VTYPE xp[]) {
+    if constexpr (k < K) {
+        xp[k] = xp[k-1] * xp[k-1];
+        polynomial_powers<K, k + 1>(xp);
+    }
+}
+
+// Estrin's scheme for the M coefficients c[B] .. c[B+M-1]. xp[k] = x^(2^k)
+template <size_t B, size_t M, class VTYPE, class CTYPE, size_t N>
+static inline VTYPE polynomial_estrin_part(VTYPE const xp[], std::array<CTYPE, N> const & c) {
+    if constexpr (M == 1) {
+        return VTYPE(c[B]);
+    }
+    else {
+        constexpr int K = polynomial_log2(M - 1);        // split at x^(2^K)
+        constexpr size_t L = size_t(1) << K;             // number of coefficients in low part
+        return mul_add(polynomial_estrin_part<B + L, M - L>(xp, c), xp[K], polynomial_estrin_part<B, L>(xp, c));
+    }
+}
+
+template <class VTYPE, class CTYPE, size_t N>
+static inline VTYPE polynomial_horner(VTYPE const x, std::array<CTYPE, N> const & c) {
+    static_assert(N > 0, "polynomial needs at least one coefficient");
+    return polynomial_horner_part<0>(x, c);
+}
+
+template <class VTYPE, class CTYPE, size_t N>
+static inline VTYPE polynomial_estrin(VTYPE const x, std::array<CTYPE, N> const & c) {
+    static_assert(N > 0, "polynomial needs at least one coefficient");
+    constexpr int K = N > 1 ? polynomial_log2(N - 1) + 1 : 1;  // number of powers needed
+    VTYPE xp[K];                                 // x, x^2, x^4, x^8, ...
+    xp[0] = x;
+    polynomial_powers<K>(xp);
+    return polynomial_estrin_part<0, N>(xp, c);
+}
+
+template <class VTYPE, class CTYPE, size_t N>
+static inline VTYPE polynomial(VTYPE const x, std::array<CTYPE, N> const & c) {
+    if constexpr (N <= 3) {
+        return polynomial_horner(x, c);
+    }
+    else {
+        return polynomial_estrin(x, c);
+    }
+}
+
+// Versions with coefficients as a parameter list. CTYPE is a scalar type
+template <class VTYPE, class ... CTYPE>
+static inline VTYPE polynomial_horner(VTYPE const x, CTYPE ... c) {
+    typedef typename std::common_type<CTYPE...>::type C;
+    return polynomial_horner(x, std::array<C, sizeof...(CTYPE)>{C(c)...});
+}
+
+template <class VTYPE, class ... CTYPE>
+static inline VTYPE polynomial_estrin(VTYPE const x, CTYPE ... c) {
+    typedef typename std::common_type<CTYPE...>::type C;
+    return polynomial_estrin(x, std::array<C, sizeof...(CTYPE)>{C(c)...});
+}
+
+template <class VTYPE, class ... CTYPE>
+static inline VTYPE polynomial(VTYPE const x, CTYPE ... c) {
+    typedef typename std::common_type<CTYPE...>::type C;
+    return polynomial(x, std::array<C, sizeof...(CTYPE)>{C(c)...});
+}
+
+// The following functions have a fixed number of coefficients
+
 // template <typedef VECTYPE, typedef CTYPE>
 template <class VTYPE, class CTYPE>
 static inline VTYPE polynomial_2(VTYPE const x, CTYPE c0, CTYPE c1, CTYPE c2) {
     // calculates polynomial c2*x^2 + c1*x + c0
     // VTYPE may be a vector type, CTYPE is a scalar type
-    VTYPE x2 = x * x;
-    //return = x2 * c2 + (x * c1 + c0);
-    return mul_add(x2, c2, mul_add(x, c1, c0));
+    return polynomial_estrin(x, std::array<CTYPE, 3>{c0, c1, c2});
 }
 
 template<class VTYPE, class CTYPE>
 static inline VTYPE polynomial_3(VTYPE const x, CTYPE c0, CTYPE c1, CTYPE c2, CTYPE c3) {
     // calculates polynomial c3*x^3 + c2*x^2 + c1*x + c0
     // VTYPE may be a vector type, CTYPE is a scalar type
-    VTYPE x2 = x * x;
-    //return (c2 + c3*x)*x2 + (c1*x + c0);
-    return mul_add(mul_add(c3, x, c2), x2, mul_add(c1, x, c0));
+    return polynomial_estrin(x, std::array<CTYPE, 4>{c0, c1, c2, c3});
 }
 
 template<class VTYPE, class CTYPE>
 static inline VTYPE polynomial_4(VTYPE const x, CTYPE c0, CTYPE c1, CTYPE c2, CTYPE c3, CTYPE c4) {
     // calculates polynomial c4*x^4 + c3*x^3 + c2*x^2 + c1*x + c0
     // VTYPE may be a vector type, CTYPE is a scalar type
-    VTYPE x2 = x * x;
-    VTYPE x4 = x2 * x2;
-    //return (c2+c3*x)*x2 + ((c0+c1*x) + c4*x4);
-    return mul_add(mul_add(c3, x, c2), x2, mul_add(c1, x, c0) + c4*x4);
+    return polynomial_estrin(x, std::array<CTYPE, 5>{c0, c1, c2, c3, c4});
 }
 
 template<class VTYPE, class CTYPE>
@@ -206,10 +301,7 @@ template<class VTYPE, class CTYPE>
 static inline VTYPE polynomial_5(VTYPE const x, CTYPE c0, CTYPE c1, CTYPE c2, CTYPE c3, CTYPE c4, CTYPE c5) {
     // calculates polynomial c5*x^5 + c4*x^4 + c3*x^3 + c2*x^2 + c1*x + c0
     // VTYPE may be a vector type, CTYPE is a scalar type
-    VTYPE x2 = x * x;
-    VTYPE x4 = x2 * x2;
-    //return (c2+c3*x)*x2 + ((c4+c5*x)*x4 + (c0+c1*x));
-    return mul_add(mul_add(c3, x, c2), x2, mul_add(mul_add(c5, x, c4), x4, mul_add(c1, x, c0)));
+    return polynomial_estrin(x, std::array<CTYPE, 6>{c0, c1, c2, c3, c4, c5});
 }
 
 template<class VTYPE, class CTYPE>
@@ -226,10 +318,7 @@ template<class VTYPE, class CTYPE>
 static inline VTYPE polynomial_6(VTYPE const x, CTYPE c0, CTYPE c1, CTYPE c2, CTYPE c3, CTYPE c4, CTYPE c5, CTYPE c6) {
     // calculates polynomial c6*x^6 + c5*x^5 + c4*x^4 + c3*x^3 + c2*x^2 + c1*x + c0
     // VTYPE may be a vector type, CTYPE is a scalar type
-    VTYPE x2 = x * x;
-    VTYPE x4 = x2 * x2;
-    //return  (c4+c5*x+c6*x2)*x4 + ((c2+c3*x)*x2 + (c0+c1*x));
-    return mul_add(mul_add(c6, x2, mul_add(c5, x, c4)), x4, mul_add(mul_add(c3, x, c2), x2, mul_add(c1, x, c0)));
+    return polynomial_estrin(x, std::array<CTYPE, 7>{c0, c1, c2, c3, c4, c5, c6});
 }
 
 template<class VTYPE, class CTYPE>
@@ -246,64 +335,35 @@ template<class VTYPE, class CTYPE>
 static inline VTYPE polynomial_7(VTYPE const x, CTYPE c0, CTYPE c1, CTYPE c2, CTYPE c3, CTYPE c4, CTYPE c5, CTYPE c6, CTYPE c7) {
     // calculates polynomial c7*x^7 + c6*x^6 + c5*x^5 + c4*x^4 + c3*x^3 + c2*x^2 + c1*x + c0
     // VTYPE may be a vector type, CTYPE is a scalar type
-    VTYPE x2 = x * x;
-    VTYPE x4 = x2 * x2;
-    //return  ((c6+c7*x)*x2 + (c4+c5*x))*x4 + ((c2+c3*x)*x2 + (c0+c1*x));
-    return mul_add(mul_add(mul_add(c7, x, c6), x2, mul_add(c5, x, c4)), x4, mul_add(mul_add(c3, x, c2), x2, mul_add(c1, x, c0)));
+    return polynomial_estrin(x, std::array<CTYPE, 8>{c0, c1, c2, c3, c4, c5, c6, c7});
 }
 
 template<class VTYPE, class CTYPE>
 static inline VTYPE polynomial_8(VTYPE const x, CTYPE c0, CTYPE c1, CTYPE c2, CTYPE c3, CTYPE c4, CTYPE c5, CTYPE c6, CTYPE c7, CTYPE c8) {
     // calculates polynomial c8*x^8 + c7*x^7 + c6*x^6 + c5*x^5 + c4*x^4 + c3*x^3 + c2*x^2 + c1*x + c0
     // VTYPE may be a vector type, CTYPE is a scalar type
-    VTYPE x2 = x  * x;
-    VTYPE x4 = x2 * x2;
-    VTYPE x8 = x4 * x4;
-    //return  ((c6+c7*x)*x2 + (c4+c5*x))*x4 + (c8*x8 + (c2+c3*x)*x2 + (c0+c1*x));
-    return mul_add(mul_add(mul_add(c7, x, c6), x2, mul_add(c5, x, c4)), x4,
-        mul_add(mul_add(c3, x, c2), x2, mul_add(c1, x, c0) + c8*x8));
+    return polynomial_estrin(x, std::array<CTYPE, 9>{c0, c1, c2, c3, c4, c5, c6, c7, c8});
 }
 
 template<class VTYPE, class CTYPE>
 static inline VTYPE polynomial_9(VTYPE const x, CTYPE c0, CTYPE c1, CTYPE c2, CTYPE c3, CTYPE c4, CTYPE c5, CTYPE c6, CTYPE c7, CTYPE c8, CTYPE c9) {
     // calculates polynomial c9*x^9 + c8*x^8 + c7*x^7 + c6*x^6 + c5*x^5 + c4*x^4 + c3*x^3 + c2*x^2 + c1*x + c0
     // VTYPE may be a vector type, CTYPE is a scalar type
-    VTYPE x2 = x  * x;
-    VTYPE x4 = x2 * x2;
-    VTYPE x8 = x4 * x4;
-    //return  (((c6+c7*x)*x2 + (c4+c5*x))*x4 + (c8+c9*x)*x8) + ((c2+c3*x)*x2 + (c0+c1*x));
-    return mul_add(mul_add(c9, x, c8), x8, mul_add(
-        mul_add(mul_add(c7, x, c6), x2, mul_add(c5, x, c4)), x4,
-        mul_add(mul_add(c3, x, c2), x2, mul_add(c1, x, c0))));
+    return polynomial_estrin(x, std::array<CTYPE, 10>{c0, c1, c2, c3, c4, c5, c6, c7, c8, c9});
 }
 
 template<class VTYPE, class CTYPE>
 static inline VTYPE polynomial_10(VTYPE const x, CTYPE c0, CTYPE c1, CTYPE c2, CTYPE c3, CTYPE c4, CTYPE c5, CTYPE c6, CTYPE c7, CTYPE c8, CTYPE c9, CTYPE c10) {
     // calculates polynomial c10*x^10 + c9*x^9 + c8*x^8 + c7*x^7 + c6*x^6 + c5*x^5 + c4*x^4 + c3*x^3 + c2*x^2 + c1*x + c0
     // VTYPE may be a vector type, CTYPE is a scalar type
-    VTYPE x2 = x  * x;
-    VTYPE x4 = x2 * x2;
-    VTYPE x8 = x4 * x4;
-    //return  (((c6+c7*x)*x2 + (c4+c5*x))*x4 + (c8+c9*x+c10*x2)*x8) + ((c2+c3*x)*x2 + (c0+c1*x));
-    return mul_add(mul_add(x2, c10, mul_add(c9, x, c8)), x8,
-        mul_add(mul_add(mul_add(c7, x, c6), x2, mul_add(c5, x, c4)), x4,
-            mul_add(mul_add(c3, x, c2), x2, mul_add(c1, x, c0))));
+    return polynomial_estrin(x, std::array<CTYPE, 11>{c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10});
 }
 
 template<class VTYPE, class CTYPE>
 static inline VTYPE polynomial_13(VTYPE const x, CTYPE c0, CTYPE c1, CTYPE c2, CTYPE c3, CTYPE c4, CTYPE c5, CTYPE c6, CTYPE c7, CTYPE c8, CTYPE c9, CTYPE c10, CTYPE c11, CTYPE c12, CTYPE c13) {
     // calculates polynomial c13*x^13 + c12*x^12 + ... + c1*x + c0
     // VTYPE may be a vector type, CTYPE is a scalar type
-    VTYPE x2 = x  * x;
-    VTYPE x4 = x2 * x2;
-    VTYPE x8 = x4 * x4;
-    return mul_add(
-        mul_add(
-            mul_add(c13, x, c12), x4,
-            mul_add(mul_add(c11, x, c10), x2, mul_add(c9, x, c8))), x8,
-        mul_add(
-            mul_add(mul_add(c7, x, c6), x2, mul_add(c5, x, c4)), x4,
-            mul_add(mul_add(c3, x, c2), x2, mul_add(c1, x, c0))));
+    return polynomial_estrin(x, std::array<CTYPE, 14>{c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13});
 }
 
 
@@ -0,0 +1,862 @@
+/****************************  vectormath_fast.h   ******************************
+* Author:        VCL contributors
+* Date created:  2026-10-14
+* Last modified: 2026-10-14
+* Version:       2.03.00
+* Project:       vector class library
+* Description:
+* Header file containing faster versions with reduced accuracy of the exponential,
+* logarithm, power, and trigonometric functions in vectormath_exp.h and
+* vectormath_trig.h. The functions are placed in the namespace fast:
+*
+* fast::exp, fast::exp2, fast::exp10, fast::log, fast::log2, fast::log10,
+* fast::pow, fast::sin, fast::cos, fast::sincos, fast::tan
+*
+* The functions use shorter minimax polynomials and they do not check for special
+* cases. A template parameter ACC selects the accuracy:
+*
+* ACC = 0 (default): Maximum error a few ulp. Intended for applications that
+*                    need nearly full precision.
+* ACC = 1:           Relative error less than 1E-4. Intended for applications
+*                    such as neuron activation functions and audio processing.
+*
+* Example:
+* Vec8f a = fast::exp(x);          // a few ulp
+* Vec8f b = fast::exp<1>(x);       // relative error < 1E-4
+*
+* The following limitations apply:
+* Denormal inputs and results are treated as 0.
+* fast::exp, exp2, exp10: Overflow gives INF slightly before the overflow limit of
+*                  the standard functions. Underflow gives 0. NAN gives NAN.
+* fast::log, log2, log10: x must be a positive normal number. The result is
+*                  unspecified for x <= 0, denormal x, INF, and NAN.
+* fast::pow:       Calculated as exp(y*log(x)) with the same limitations. The error
+*                  increases with abs(y*log(x)). It is approximately
+*                  (2 + 2*abs(y*log(x))) ulp for ACC = 0.
+* fast::sin, cos, sincos, tan: The result is inaccurate for abs(x) > 1E5 (float)
+*                  or abs(x) > 1E13 (double). INF and NAN give NAN.
+*
+* For detailed instructions see vcl_manual.pdf
+*
+* (c) Copyright 2026 VCL contributors.
+* Apache License version 2.0 or later.
+******************************************************************************/
+
+#ifndef VECTORMATH_FAST_H
+#define VECTORMATH_FAST_H  20300
+
+#include "vectormath_exp.h"
+#include "vectormath_trig.h"
+
+#ifdef VCL_NAMESPACE
+namespace VCL_NAMESPACE {
+#endif
+
+/******************************************************************************
+*                 Exponential functions
+******************************************************************************/
+
+// Template for fast exp function, single precision
+// Template parameters:
+// VTYPE:  float vector type
+// BA:  0 for exp, 2 for pow(2,x), 10 for pow(10,x)
+// ACC: 0 for a few ulp, 1 for relative error < 1E-4
+template<typename VTYPE, int BA, int ACC>
+static inline VTYPE exp_fast_f(VTYPE const initial_x) {
+
+    // minimax coefficients for (exp(x)-1-x)/x^2, abs(x) <= log(2)/2
+    const float P0expf  =  4.999923179E-1f;
+    const float P1expf  =  1.666711447E-1f;
+    const float P2expf  =  4.189011315E-2f;
+    const float P3expf  =  8.312524864E-3f;
+    const float Q0expf  =  5.000511602E-1f;    // lower accuracy
+    const float Q1expf  =  1.675351391E-1f;
+    const float Q2expf  =  4.127774758E-2f;
+
+    VTYPE  x, r, z, n2;                          // data vectors
+
+    // Limit x so that 2^r gives 0 for underflow and INF for overflow.
+    // The constant is the first operand of min and max so that NAN propagates
+    if constexpr (BA == 0) {                     // exp(x)
+        const float ln2f_hi  =  0.693359375f;
+        const float ln2f_lo  = -2.12194440e-4f;
+        x = max(VTYPE(-88.0f), min(VTYPE(88.5f), initial_x));
+        r = round(x*float(VM_LOG2E));
+        if constexpr (ACC == 0) {
+            x = nmul_add(r, VTYPE(ln2f_hi), x);  //  x -= r * ln2f_hi;
+            x = nmul_add(r, VTYPE(ln2f_lo), x);  //  x -= r * ln2f_lo;
+        }
+        else {
+            x = nmul_add(r, VTYPE(float(VM_LN2)), x);
+        }
+    }
+    else if constexpr (BA == 2) {                // pow(2,x)
+        x = max(VTYPE(-127.0f), min(VTYPE(128.0f), initial_x));
+        r = round(x);
+        x = (x - r) * float(VM_LN2);
+    }
+    else if constexpr (BA == 10) {               // pow(10,x)
+        const float log10_2_hi = 0.301025391f;   // log10(2) in two parts
+        const float log10_2_lo = 4.60503907E-6f;
+        x = max(VTYPE(-38.2f), min(VTYPE(38.6f), initial_x));
+        r = round(x*float(VM_LOG210));
+        if constexpr (ACC == 0) {
+            x = nmul_add(r, VTYPE(log10_2_hi), x);   //  x -= r * log10_2_hi;
+            x = nmul_add(r, VTYPE(log10_2_lo), x);   //  x -= r * log10_2_lo;
+        }
+        else {
+            x = nmul_add(r, VTYPE(float(VM_LN2/VM_LN10)), x);
+        }
+        x = x * float(VM_LN10);
+    }
+    else  {  // undefined value of BA
+        return 0.;
+    }
+
+    if constexpr (ACC == 0) {
+        z = polynomial_3(x, P0expf, P1expf, P2expf, P3expf);
+    }
+    else {
+        z = polynomial_2(x, Q0expf, Q1expf, Q2expf);
+    }
+    z = mul_add(z, x*x, x);                      // z *= x2;  z += x;
+
+    // multiply by power of 2
+    n2 = vm_pow2n(r);
+    return (z + 1.0f) * n2;
+}
+
+// Template for fast exp function, double precision
+// Template parameters:
+// VTYPE:  double vector type
+// BA:  0 for exp, 2 for pow(2,x), 10 for pow(10,x)
+// ACC: 0 for a few ulp, 1 for relative error < 1E-4
+template<typename VTYPE, int BA, int ACC>
+static inline VTYPE exp_fast_d(VTYPE const initial_x) {
+
+    // minimax coefficients for (exp(x)-1-x)/x^2, abs(x) <= log(2)/2
+    const double p0 = 4.999999999999832056E-1;
+    const double p1 = 1.666666666661155087E-1;
+    const double p2 = 4.166666666813848373E-2;
+    const double p3 = 8.333333370871544150E-3;
+    const double p4 = 1.388888851583888441E-3;
+    const double p5 = 1.984118523454358555E-4;
+    const double p6 = 2.480193203905965508E-5;
+    const double p7 = 2.763499140657238536E-6;
+    const double p8 = 2.747670090366069686E-7;
+    const double q0 = 5.000511602E-1;            // lower accuracy
+    const double q1 = 1.675351391E-1;
+    const double q2 = 4.127774758E-2;
+
+    VTYPE  x, r, z, n2;                          // data vectors
+
+    // Limit x so that 2^r gives 0 for underflow and INF for overflow.
+    // The constant is the first operand of min and max so that NAN propagates
+    if constexpr (BA == 0) {                     // exp(x)
+        const double ln2d_hi = 0.693145751953125;
+        const double ln2d_lo = 1.42860682030941723212E-6;
+        x = max(VTYPE(-709.0), min(VTYPE(709.8), initial_x));
+        r = round(x*VM_LOG2E);
+        if constexpr (ACC == 0) {
+            x = nmul_add(r, ln2d_hi, x);         //  x -= r * ln2d_hi;
+            x = nmul_add(r, ln2d_lo, x);         //  x -= r * ln2d_lo;
+        }
+        else {
+            x = nmul_add(r, VM_LN2, x);
+        }
+    }
+    else if constexpr (BA == 2) {                // pow(2,x)
+        x = max(VTYPE(-1023.0), min(VTYPE(1024.0), initial_x));
+        r = round(x);
+        x = (x - r) * VM_LN2;
+    }
+    else if constexpr (BA == 10) {               // pow(10,x)
+        const double log10_2_hi = 0.30102999554947019; // log10(2) in two parts
+        const double log10_2_lo = 1.1451100899212592E-10;
+        x = max(VTYPE(-307.9), min(VTYPE(308.3), initial_x));
+        r = round(x*VM_LOG210);
+        if constexpr (ACC == 0) {
+            x = nmul_add(r, log10_2_hi, x);      //  x -= r * log10_2_hi;
+            x = nmul_add(r, log10_2_lo, x);      //  x -= r * log10_2_lo;
+        }
+        else {
+            x = nmul_add(r, VM_LN2/VM_LN10, x);
+        }
+        x *= VM_LN10;
+    }
+    else  {  // undefined value of BA
+        return 0.;
+    }
+
+    if constexpr (ACC == 0) {
+        z = polynomial_8(x, p0, p1, p2, p3, p4, p5, p6, p7, p8);
+    }
+    else {
+        z = polynomial_2(x, q0, q1, q2);
+    }
+    z = mul_add(z, x*x, x);                      // z *= x2;  z += x;
+
+    // multiply by power of 2
+    n2 = vm_pow2n(r);
+    return (z + 1.0) * n2;
+}
+
+
+/******************************************************************************
+*                 Logarithm functions
+******************************************************************************/
+
+// Template for fast log function, single precision
+// Template parameters:
+// VTYPE:  float vector type
+// ACC: 0 for a few ulp, 1 for relative error < 1E-4
+template<typename VTYPE, int ACC>
+static inline VTYPE log_fast_f(VTYPE const initial_x) {
+
+    // minimax coefficients for (log(1+x)-x+x^2/2)/x^3, sqrt(0.5) <= 1+x <= sqrt(2)
+    const float ln2f_hi =  0.693359375f;
+    const float ln2f_lo = -2.12194440E-4f;
+    const float P0logf  =  3.333391074E-1f;
+    const float P1logf  = -2.500133704E-1f;
+    const float P2logf  =  1.996306384E-1f;
+    const float P3logf  = -1.657758464E-1f;
+    const float P4logf  =  1.491476743E-1f;
+    const float P5logf  = -1.426748722E-1f;
+    const float P6logf  =  8.700437674E-2f;
+    const float Q0logf  =  3.328547100E-1f;      // lower accuracy
+    const float Q1logf  = -2.524499711E-1f;
+    const float Q2logf  =  2.177651062E-1f;
+    const float Q3logf  = -1.459251891E-1f;
+
+    VTYPE  x, res, x2, fe;                       // data vectors
+
+    // separate mantissa from exponent
+    x = fraction_2(initial_x);
+    auto e = exponent(initial_x);                // integer vector
+
+    auto blend = x > float(VM_SQRT2*0.5);        // boolean vector
+    x  = if_add(!blend, x, x);                   // conditional add
+    e  = if_add(decltype(e>e)(blend),  e, decltype(e)(1));  // conditional add
+    fe = to_float(e);
+    x -= 1.0f;                                   // expand around 1.0
+
+    if constexpr (ACC == 0) {
+        res = polynomial_6(x, P0logf, P1logf, P2logf, P3logf, P4logf, P5logf, P6logf);
+    }
+    else {
+        res = polynomial_3(x, Q0logf, Q1logf, Q2logf, Q3logf);
+    }
+    x2  = x*x;
+    res *= x2*x;
+
+    // add exponent
+    if constexpr (ACC == 0) {
+        res  = mul_add(fe, ln2f_lo, res);        // res += ln2f_lo  * fe;
+        res += nmul_add(x2, 0.5f, x);            // res += x - 0.5f * x2;
+        res  = mul_add(fe, ln2f_hi, res);        // res += ln2f_hi  * fe;
+    }
+    else {
+        res += nmul_add(x2, 0.5f, x);            // res += x - 0.5f * x2;
+        res  = mul_add(fe, float(VM_LN2), res);  // res += ln2 * fe;
+    }
+    return res;
+}
+
+// Template for fast log function, double precision
+// Template parameters:
+// VTYPE:  double vector type
+// ACC: 0 for a few ulp, 1 for relative error < 1E-4
+template<typename VTYPE, int ACC>
+static inline VTYPE log_fast_d(VTYPE const initial_x) {
+
+    // rational approximation, same as log_d
+    const double ln2_hi =  0.693359375;
+    const double ln2_lo = -2.121944400546905827679E-4;
+    const double P0log  =  7.70838733755885391666E0;
+    const double P1log  =  1.79368678507819816313E1;
+    const double P2log  =  1.44989225341610930846E1;
+    const double P3log  =  4.70579119878881725854E0;
+    const double P4log  =  4.97494994976747001425E-1;
+    const double P5log  =  1.01875663804580931796E-4;
+    const double Q0log  =  2.31251620126765340583E1;
+    const double Q1log  =  7.11544750618563894466E1;
+    const double Q2log  =  8.29875266912776603211E1;
+    const double Q3log  =  4.52279145837532221105E1;
+    const double Q4log  =  1.12873587189167450590E1;
+    // minimax polynomial with lower accuracy, same as log_fast_f
+    const double R0log  =  3.328547100E-1;
+    const double R1log  = -2.524499711E-1;
+    const double R2log  =  2.177651062E-1;
+    const double R3log  = -1.459251891E-1;
+
+    VTYPE  x, x2, px, qx, res, fe;               // data vectors
+
+    // separate mantissa from exponent
+    x  = fraction_2(initial_x);
+    fe = exponent_f(initial_x);
+
+    auto blend = x > VM_SQRT2*0.5;               // boolean vector
+    x  = if_add(!blend, x, x);                   // conditional add
+    fe = if_add(blend, fe, 1.);                  // conditional add
+    x -= 1.0;                                    // expand around 1.0
+    x2 = x * x;
+
+    if constexpr (ACC == 0) {
+        // rational form
+        px  = polynomial_5 (x, P0log, P1log, P2log, P3log, P4log, P5log);
+        px *= x * x2;
+        qx  = polynomial_5n(x, Q0log, Q1log, Q2log, Q3log, Q4log);
+        res = px / qx ;
+        // add exponent
+        res  = mul_add(fe, ln2_lo, res);         // res += fe * ln2_lo;
+        res += nmul_add(x2, 0.5, x);             // res += x  - 0.5 * x2;
+        res  = mul_add(fe, ln2_hi, res);         // res += fe * ln2_hi;
+    }
+    else {
+        res  = polynomial_3(x, R0log, R1log, R2log, R3log) * (x * x2);
+        res += nmul_add(x2, 0.5, x);             // res += x  - 0.5 * x2;
+        res  = mul_add(fe, VM_LN2, res);         // res += fe * ln2;
+    }
+    return res;
+}
+
+
+/******************************************************************************
+*                 Trigonometric functions
+******************************************************************************/
+
+// Template for fast sin, cos, sincos, and tan, single precision
+// Template parameters:
+// VTYPE:  float vector type
+// SC:  1 = sin, 2 = cos, 3 = sincos, 4 = tan
+// ACC: 0 for a few ulp, 1 for relative error < 1E-4
+// Parameters:
+// xx = input x (radians)
+// cosret = return pointer (only if SC = 3)
+template<typename VTYPE, int SC, int ACC>
+static inline VTYPE sincos_fast_f(VTYPE * cosret, VTYPE const xx) {
+
+    // define constants
+    const float DP1F = 0.78515625f * 2.f;
+    const float DP2F = 2.4187564849853515625E-4f * 2.f;
+    const float DP3F = 3.77489497744594108E-8f * 2.f;
+
+    // same coefficients as sincos_f
+    const float P0sinf = -1.6666654611E-1f;
+    const float P1sinf = 8.3321608736E-3f;
+    const float P2sinf = -1.9515295891E-4f;
+    const float P0cosf = 4.166664568298827E-2f;
+    const float P1cosf = -1.388731625493765E-3f;
+    const float P2cosf = 2.443315711809948E-5f;
+    // lower accuracy
+    const float Q0sinf = -1.666339038E-1f;
+    const float Q1sinf = 8.163281921E-3f;
+    const float Q0cosf = 4.166107131E-2f;
+    const float Q1cosf = -1.364871437E-3f;
+
+    typedef decltype(roundi(xx)) ITYPE;          // integer vector type
+    typedef decltype(xx < xx) BVTYPE;            // boolean vector type
+
+    VTYPE  xa, x, y, x2, s, c, sin1, cos1;       // data vectors
+    ITYPE  q, signsin, signcos;                  // integer vectors
+    BVTYPE swap;                                 // boolean vector
+
+    // Find quadrant. There is no check for overflow
+    xa = abs(xx);
+    y = round(xa * (float)(2. / VM_PI));         // quadrant, as float
+    q = roundi(y);                               // quadrant, as integer
+
+    // Reduce by extended precision modular arithmetic
+#if INSTRSET < 8  // no FMA
+    x = ((xa - y * DP1F) - y * DP2F) - y * DP3F;
+#else
+    x = nmul_add(y, DP3F, nmul_add(y, DP2F + DP1F, xa));
+#endif
+
+    // Expansion of sin and cos, valid for -pi/4 <= x <= pi/4
+    x2 = x * x;
+    if constexpr (ACC == 0) {
+        s = polynomial_2(x2, P0sinf, P1sinf, P2sinf);
+        c = polynomial_2(x2, P0cosf, P1cosf, P2cosf);
+    }
+    else {
+        s = mul_add(x2, Q1sinf, Q0sinf);
+        c = mul_add(x2, Q1cosf, Q0cosf);
+    }
+    s = mul_add(x * x2, s, x);                                       // s = x + (x * x2) * s;
+    c = mul_add(x2 * x2, c, nmul_add(x2, 0.5f, 1.0f));               // c = 1.0 - x2 * 0.5 + (x2 * x2) * c;
+
+    // swap sin and cos if odd quadrant
+    swap = BVTYPE((q & 1) != 0);
+
+    if constexpr ((SC & 5) != 0) {  // calculate sin
+        sin1 = select(swap, c, s);
+        signsin = ((q << 30) ^ ITYPE(reinterpret_i(xx)));
+        sin1 = sign_combine(sin1, reinterpret_f(signsin));
+    }
+    if constexpr ((SC & 6) != 0) {  // calculate cos
+        cos1 = select(swap, s, c);
+        signcos = ((q + 1) & 2) << 30;
+        cos1 ^= reinterpret_f(signcos);
+    }
+    if constexpr (SC == 1) return sin1;
+    else if constexpr (SC == 2) return cos1;
+    else if constexpr (SC == 3) {   // calculate both. cos returned through pointer
+        *cosret = cos1;
+        return sin1;
+    }
+    else {                          // SC == 4. tan
+        return sin1 / cos1;
+    }
+}
+
+// Template for fast sin, cos, sincos, and tan, double precision
+// Template parameters:
+// VTYPE:  double vector type
+// SC:  1 = sin, 2 = cos, 3 = sincos, 4 = tan
+// ACC: 0 for a few ulp, 1 for relative error < 1E-4
+// Parameters:
+// xx = input x (radians)
+// cosret = return pointer (only if SC = 3)
+template<typename VTYPE, int SC, int ACC>
+static inline VTYPE sincos_fast_d(VTYPE * cosret, VTYPE const xx) {
+
+    // same coefficients as sincos_d
+    const double P0sin = -1.66666666666666307295E-1;
+    const double P1sin = 8.33333333332211858878E-3;
+    const double P2sin = -1.98412698295895385996E-4;
+    const double P3sin = 2.75573136213857245213E-6;
+    const double P4sin = -2.50507477628578072866E-8;
+    const double P5sin = 1.58962301576546568060E-10;
+
+    const double P0cos = 4.16666666666665929218E-2;
+    const double P1cos = -1.38888888888730564116E-3;
+    const double P2cos = 2.48015872888517045348E-5;
+    const double P3cos = -2.75573141792967388112E-7;
+    const double P4cos = 2.08757008419747316778E-9;
+    const double P5cos = -1.13585365213876817300E-11;
+
+    // lower accuracy, same as sincos_fast_f
+    const double Q0sin = -1.666339038E-1;
+    const double Q1sin = 8.163281921E-3;
+    const double Q0cos = 4.166107131E-2;
+    const double Q1cos = -1.364871437E-3;
+
+    const double DP1 = 7.853981554508209228515625E-1 * 2.;
+    const double DP2 = 7.94662735614792836714E-9 * 2.;
+    const double DP3 = 3.06161699786838294307E-17 * 2.;
+
+    typedef decltype(roundi(xx)) ITYPE;          // integer vector type
+    typedef decltype(xx < xx) BVTYPE;            // boolean vector type
+
+    VTYPE  xa, x, y, x2, s, c, sin1, cos1;       // data vectors
+    ITYPE  q, signsin, signcos;                  // integer vectors, 64 bit
+    BVTYPE swap;                                 // boolean vector
+
+    // Find quadrant. There is no check for overflow
+    xa = abs(xx);
+    y = round(xa * (double)(2. / VM_PI));        // quadrant, as float
+    q = roundi(y);                               // quadrant, as integer
+
+    // Reduce by extended precision modular arithmetic
+#if INSTRSET < 8  // no FMA
+    x = ((xa - y * DP1) - y * DP2) - y * DP3;
+#else
+    x = nmul_add(y, DP3, nmul_add(y, DP2 + DP1, xa));
+#endif
+
+    // Expansion of sin and cos, valid for -pi/4 <= x <= pi/4
+    x2 = x * x;
+    if constexpr (ACC == 0) {
+        s = polynomial_5(x2, P0sin, P1sin, P2sin, P3sin, P4sin, P5sin);
+        c = polynomial_5(x2, P0cos, P1cos, P2cos, P3cos, P4cos, P5cos);
+    }
+    else {
+        s = mul_add(x2, Q1sin, Q0sin);
+        c = mul_add(x2, Q1cos, Q0cos);
+    }
+    s = mul_add(x * x2, s, x);                                       // s = x + (x * x2) * s;
+    c = mul_add(x2 * x2, c, nmul_add(x2, 0.5, 1.0));                 // c = 1.0 - x2 * 0.5 + (x2 * x2) * c;
+
+    // swap sin and cos if odd quadrant
+    swap = BVTYPE((q & 1) != 0);
+
+    if constexpr ((SC & 5) != 0) {  // calculate sin
+        sin1 = select(swap, c, s);
+        signsin = ((q << 62) ^ ITYPE(reinterpret_i(xx)));
+        sin1 = sign_combine(sin1, reinterpret_d(signsin));
+    }
+    if constexpr ((SC & 6) != 0) {  // calculate cos
+        cos1 = select(swap, s, c);
+        signcos = ((q + 1) & 2) << 62;
+        cos1 ^= reinterpret_d(signcos);
+    }
+    if constexpr (SC == 1) return sin1;
+    else if constexpr (SC == 2) return cos1;
+    else if constexpr (SC == 3) {   // calculate both. cos returned through pointer
+        *cosret = cos1;
+        return sin1;
+    }
+    else {                          // SC == 4. tan
+        return sin1 / cos1;
+    }
+}
+
+
+/******************************************************************************
+*                 Instances of fast templates in namespace fast
+******************************************************************************/
+
+namespace fast {
+
+// 128 bit vectors
+
+template <int ACC = 0>
+static inline Vec4f exp(Vec4f const x) {
+    return exp_fast_f<Vec4f, 0, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec4f exp2(Vec4f const x) {
+    return exp_fast_f<Vec4f, 2, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec4f exp10(Vec4f const x) {
+    return exp_fast_f<Vec4f, 10, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec4f log(Vec4f const x) {
+    return log_fast_f<Vec4f, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec4f log2(Vec4f const x) {
+    return float(VM_LOG2E) * log_fast_f<Vec4f, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec4f log10(Vec4f const x) {
+    return float(VM_LOG10E) * log_fast_f<Vec4f, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec4f pow(Vec4f const x, Vec4f const y) {
+    return exp_fast_f<Vec4f, 0, ACC>(y * log_fast_f<Vec4f, ACC>(x));
+}
+
+template <int ACC = 0>
+static inline Vec4f sin(Vec4f const x) {
+    return sincos_fast_f<Vec4f, 1, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec4f cos(Vec4f const x) {
+    return sincos_fast_f<Vec4f, 2, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec4f sincos(Vec4f * cosret, Vec4f const x) {
+    return sincos_fast_f<Vec4f, 3, ACC>(cosret, x);
+}
+
+template <int ACC = 0>
+static inline Vec4f tan(Vec4f const x) {
+    return sincos_fast_f<Vec4f, 4, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec2d exp(Vec2d const x) {
+    return exp_fast_d<Vec2d, 0, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec2d exp2(Vec2d const x) {
+    return exp_fast_d<Vec2d, 2, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec2d exp10(Vec2d const x) {
+    return exp_fast_d<Vec2d, 10, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec2d log(Vec2d const x) {
+    return log_fast_d<Vec2d, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec2d log2(Vec2d const x) {
+    return VM_LOG2E * log_fast_d<Vec2d, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec2d log10(Vec2d const x) {
+    return VM_LOG10E * log_fast_d<Vec2d, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec2d pow(Vec2d const x, Vec2d const y) {
+    return exp_fast_d<Vec2d, 0, ACC>(y * log_fast_d<Vec2d, ACC>(x));
+}
+
+template <int ACC = 0>
+static inline Vec2d sin(Vec2d const x) {
+    return sincos_fast_d<Vec2d, 1, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec2d cos(Vec2d const x) {
+    return sincos_fast_d<Vec2d, 2, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec2d sincos(Vec2d * cosret, Vec2d const x) {
+    return sincos_fast_d<Vec2d, 3, ACC>(cosret, x);
+}
+
+template <int ACC = 0>
+static inline Vec2d tan(Vec2d const x) {
+    return sincos_fast_d<Vec2d, 4, ACC>(0, x);
+}
+
+#if MAX_VECTOR_SIZE >= 256
+
+// 256 bit vectors
+
+template <int ACC = 0>
+static inline Vec8f exp(Vec8f const x) {
+    return exp_fast_f<Vec8f, 0, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec8f exp2(Vec8f const x) {
+    return exp_fast_f<Vec8f, 2, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec8f exp10(Vec8f const x) {
+    return exp_fast_f<Vec8f, 10, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec8f log(Vec8f const x) {
+    return log_fast_f<Vec8f, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec8f log2(Vec8f const x) {
+    return float(VM_LOG2E) * log_fast_f<Vec8f, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec8f log10(Vec8f const x) {
+    return float(VM_LOG10E) * log_fast_f<Vec8f, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec8f pow(Vec8f const x, Vec8f const y) {
+    return exp_fast_f<Vec8f, 0, ACC>(y * log_fast_f<Vec8f, ACC>(x));
+}
+
+template <int ACC = 0>
+static inline Vec8f sin(Vec8f const x) {
+    return sincos_fast_f<Vec8f, 1, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec8f cos(Vec8f const x) {
+    return sincos_fast_f<Vec8f, 2, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec8f sincos(Vec8f * cosret, Vec8f const x) {
+    return sincos_fast_f<Vec8f, 3, ACC>(cosret, x);
+}
+
+template <int ACC = 0>
+static inline Vec8f tan(Vec8f const x) {
+    return sincos_fast_f<Vec8f, 4, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec4d exp(Vec4d const x) {
+    return exp_fast_d<Vec4d, 0, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec4d exp2(Vec4d const x) {
+    return exp_fast_d<Vec4d, 2, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec4d exp10(Vec4d const x) {
+    return exp_fast_d<Vec4d, 10, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec4d log(Vec4d const x) {
+    return log_fast_d<Vec4d, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec4d log2(Vec4d const x) {
+    return VM_LOG2E * log_fast_d<Vec4d, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec4d log10(Vec4d const x) {
+    return VM_LOG10E * log_fast_d<Vec4d, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec4d pow(Vec4d const x, Vec4d const y) {
+    return exp_fast_d<Vec4d, 0, ACC>(y * log_fast_d<Vec4d, ACC>(x));
+}
+
+template <int ACC = 0>
+static inline Vec4d sin(Vec4d const x) {
+    return sincos_fast_d<Vec4d, 1, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec4d cos(Vec4d const x) {
+    return sincos_fast_d<Vec4d, 2, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec4d sincos(Vec4d * cosret, Vec4d const x) {
+    return sincos_fast_d<Vec4d, 3, ACC>(cosret, x);
+}
+
+template <int ACC = 0>
+static inline Vec4d tan(Vec4d const x) {
+    return sincos_fast_d<Vec4d, 4, ACC>(0, x);
+}
+
+#endif // MAX_VECTOR_SIZE >= 256
+
+#if MAX_VECTOR_SIZE >= 512
+
+// 512 bit vectors
+
+template <int ACC = 0>
+static inline Vec16f exp(Vec16f const x) {
+    return exp_fast_f<Vec16f, 0, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec16f exp2(Vec16f const x) {
+    return exp_fast_f<Vec16f, 2, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec16f exp10(Vec16f const x) {
+    return exp_fast_f<Vec16f, 10, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec16f log(Vec16f const x) {
+    return log_fast_f<Vec16f, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec16f log2(Vec16f const x) {
+    return float(VM_LOG2E) * log_fast_f<Vec16f, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec16f log10(Vec16f const x) {
+    return float(VM_LOG10E) * log_fast_f<Vec16f, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec16f pow(Vec16f const x, Vec16f const y) {
+    return exp_fast_f<Vec16f, 0, ACC>(y * log_fast_f<Vec16f, ACC>(x));
+}
+
+template <int ACC = 0>
+static inline Vec16f sin(Vec16f const x) {
+    return sincos_fast_f<Vec16f, 1, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec16f cos(Vec16f const x) {
+    return sincos_fast_f<Vec16f, 2, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec16f sincos(Vec16f * cosret, Vec16f const x) {
+    return sincos_fast_f<Vec16f, 3, ACC>(cosret, x);
+}
+
+template <int ACC = 0>
+static inline Vec16f tan(Vec16f const x) {
+    return sincos_fast_f<Vec16f, 4, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec8d exp(Vec8d const x) {
+    return exp_fast_d<Vec8d, 0, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec8d exp2(Vec8d const x) {
+    return exp_fast_d<Vec8d, 2, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec8d exp10(Vec8d const x) {
+    return exp_fast_d<Vec8d, 10, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec8d log(Vec8d const x) {
+    return log_fast_d<Vec8d, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec8d log2(Vec8d const x) {
+    return VM_LOG2E * log_fast_d<Vec8d, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec8d log10(Vec8d const x) {
+    return VM_LOG10E * log_fast_d<Vec8d, ACC>(x);
+}
+
+template <int ACC = 0>
+static inline Vec8d pow(Vec8d const x, Vec8d const y) {
+    return exp_fast_d<Vec8d, 0, ACC>(y * log_fast_d<Vec8d, ACC>(x));
+}
+
+template <int ACC = 0>
+static inline Vec8d sin(Vec8d const x) {
+    return sincos_fast_d<Vec8d, 1, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec8d cos(Vec8d const x) {
+    return sincos_fast_d<Vec8d, 2, ACC>(0, x);
+}
+
+template <int ACC = 0>
+static inline Vec8d sincos(Vec8d * cosret, Vec8d const x) {
+    return sincos_fast_d<Vec8d, 3, ACC>(cosret, x);
+}
+
+template <int ACC = 0>
+static inline Vec8d tan(Vec8d const x) {
+    return sincos_fast_d<Vec8d, 4, ACC>(0, x);
+}
+
+#endif // MAX_VECTOR_SIZE >= 512
+
+}  // namespace fast
+
+#ifdef VCL_NAMESPACE
+}
+#endif
+
+#endif  // VECTORMATH_FAST_H